@@ -0,0 +1,50 @@
+include(FetchContent)
+
+set(BENCHMARK_ENABLE_TESTING Off CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_GTEST_TESTS Off CACHE BOOL "" FORCE)
+
+FetchContent_Declare(
+  googlebenchmark
+  GIT_REPOSITORY https://github.com/google/benchmark.git
+  GIT_TAG        v1.9.0
+  FIND_PACKAGE_ARGS NAMES benchmark
+)
+
+FetchContent_MakeAvailable(googlebenchmark)
+
+function(add_ydb_benchmark)
+  set(opts "")
+  set(oneval_args NAME)
+  set(multival_args INCLUDE_DIRS SOURCES LINK_LIBRARIES)
+  cmake_parse_arguments(YDB_BENCHMARK
+    "${opts}"
+    "${oneval_args}"
+    "${multival_args}"
+    ${ARGN}
+  )
+
+  add_executable(${YDB_BENCHMARK_NAME})
+  target_include_directories(${YDB_BENCHMARK_NAME} PRIVATE ${YDB_BENCHMARK_INCLUDE_DIRS})
+  target_link_libraries(${YDB_BENCHMARK_NAME} PRIVATE
+    ${YDB_BENCHMARK_LINK_LIBRARIES}
+    benchmark::benchmark_main
+  )
+  target_sources(${YDB_BENCHMARK_NAME} PRIVATE ${YDB_BENCHMARK_SOURCES})
+
+  if (CMAKE_SYSTEM_NAME STREQUAL "Linux")
+    target_link_options(${YDB_BENCHMARK_NAME} PRIVATE
+      -ldl
+      -lrt
+      -Wl,--no-as-needed
+      -lpthread
+    )
+  elseif (CMAKE_SYSTEM_NAME STREQUAL "Darwin")
+    target_link_options(${YDB_BENCHMARK_NAME} PRIVATE
+      -Wl,-platform_version,macos,11.0,11.0
+      -framework
+      CoreFoundation
+    )
+  endif()
+
+  vcs_info(${YDB_BENCHMARK_NAME})
+endfunction()
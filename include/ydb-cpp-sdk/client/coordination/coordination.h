@@ -249,6 +249,10 @@ struct TSessionSettings : public TRequestSettings<TSessionSettings> {
     FLUENT_SETTING_DEFAULT(double, ReconnectSessionTimeoutMultiplier, 2.0);
 
     FLUENT_SETTING_DEFAULT(TDuration, ConnectTimeout, TDuration::Zero());
+
+    //! How long an unused semaphore lease stays acquired before it is released on the server.
+    //! Zero releases the semaphore as soon as the last local holder releases it.
+    FLUENT_SETTING_DEFAULT(TDuration, SemaphoreLeaseIdleTimeout, TDuration::MilliSeconds(100));
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -348,6 +352,26 @@ public:
 
     TAsyncResult<bool> ReleaseSemaphore(const std::string& name);
 
+    //! Acquires semaphore through a client-side lease.
+    //! The first local acquirer sends AcquireSemaphore with its settings, later
+    //! acquirers with the same count reuse that acquisition without a round-trip.
+    //! Every local holder takes one unit of the acquired count, so up to Count acquirers
+    //! hold the lease at once (one for an exclusive lease). The others are queued and get
+    //! the lease in turn on ReleaseSemaphoreLease, or give up after their Timeout.
+    //! An unused lease with a different count is released and acquired again with the new count,
+    //! a lease in use can't change its count.
+    //! Returns the id of the local hold, or 0 if the semaphore was not acquired.
+    //! After the last local holder calls ReleaseSemaphoreLease the semaphore stays
+    //! acquired for TSessionSettings::SemaphoreLeaseIdleTimeout and is released
+    //! on the server only if nobody acquires it again during that time.
+    //! Leased semaphores must not be acquired or released with AcquireSemaphore/ReleaseSemaphore.
+    TAsyncResult<uint64_t> AcquireSemaphoreLease(const std::string& name,
+        const TAcquireSemaphoreSettings& settings);
+
+    //! Releases the hold returned by AcquireSemaphoreLease.
+    //! Returns false if holdId doesn't hold the semaphore lease.
+    TAsyncResult<bool> ReleaseSemaphoreLease(const std::string& name, uint64_t holdId);
+
     TAsyncDescribeSemaphoreResult DescribeSemaphore(const std::string& name,
         const TDescribeSemaphoreSettings& settings = TDescribeSemaphoreSettings());
 
@@ -65,6 +65,14 @@ public:
     //! Max number of requests in queue waiting for discovery if "Async" mode chosen
     //! default: 100
     TDriverConfig& SetMaxQueuedRequests(size_t sz);
+    //! Max number of requests of the given priority class in queue waiting for discovery if "Async" mode chosen
+    //! default: value of SetMaxQueuedRequests(size_t)
+    TDriverConfig& SetMaxQueuedRequests(ERequestPriority priority, size_t sz);
+    //! Weight of the priority class in response dispatching.
+    //! When responses of several classes are waiting for a client thread,
+    //! each class gets share of the threads proportional to its weight.
+    //! default: Interactive - 8, Batch - 2, Background - 1
+    TDriverConfig& SetRequestPriorityWeight(ERequestPriority priority, uint32_t weight);
     //! Limit using of memory for grpc buffer pool. 0 means disabled.
     //! If enabled the size must be greater than size of recieved message.
     //! default: 0
@@ -116,6 +124,34 @@ public:
     //! default: 0
     TDriverConfig& SetMaxMessageSize(uint64_t maxMessageSize);
 
+    //! Set directory for the persistent discovery cache.
+    //! The last successful discovery result of every database is stored there and used
+    //! to balance requests right after restart, while the real discovery runs in background.
+    //! Empty path disables the cache.
+    //! default: empty
+    TDriverConfig& SetDiscoveryCachePath(const std::string& path);
+    //! Set number of best endpoints to pre-connect after each discovery update.
+    //! Channels to these endpoints are created and start connecting in background,
+    //! so the first requests don't pay for TCP and TLS handshakes.
+    //! 0 disables warm-up.
+    //! default: 0
+    TDriverConfig& SetWarmUpEndpointsCount(size_t count);
+    //! Set number of TCP connections opened to every endpoint.
+    //! Each request goes over the connection with the least outstanding requests,
+    //! so high QPS traffic is not limited by a single HTTP/2 connection window.
+    //! default: 1
+    TDriverConfig& SetChannelsPerEndpoint(size_t count);
+    //! Use dedicated connections for streaming calls (ReadTable, StreamExecuteScanQuery, topic sessions etc.),
+    //! so large streams don't delay latency-sensitive unary calls.
+    //! default: false
+    TDriverConfig& SetSeparateStreamingChannels(bool separate);
+    //! Export per-phase latency histograms (Request/Phase/*) next to Request/Latency:
+    //! admission to the request queue, credentials, transport, wait in the response queue,
+    //! user callback and session acquisition in session pools.
+    //! Takes effect only when the metric registry is set.
+    //! default: false
+    TDriverConfig& SetCollectRequestPhases(bool collect);
+
     //! Log backend.
     TDriverConfig& SetLog(std::unique_ptr<TLogBackend>&& log);
 private:
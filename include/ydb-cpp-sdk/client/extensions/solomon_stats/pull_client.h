@@ -3,11 +3,14 @@
 #include <ydb-cpp-sdk/client/extension_common/extension.h>
 
 #include <library/cpp/monlib/metrics/metric_consumer.h>
+#include <library/cpp/monlib/encode/format.h>
 #include <library/cpp/monlib/encode/json/json.h>
 #include <library/cpp/monlib/metrics/metric_registry.h>
 #include <library/cpp/monlib/service/pages/mon_page.h>
 #include <library/cpp/monlib/service/monservice.h>
 
+#include <memory>
+
 namespace NSolomonStatExtension::inline V3 {
 
 class TSolomonStatPullExtension: public NYdb::IExtension {
@@ -33,25 +36,35 @@ public:
         NMonitoring::TLabels Labels_;
     };
 
+    //! Serves the metrics on two pages:
+    //! /stats in JSON, or in Prometheus text or spack format if the Accept header asks for it;
+    //! /metrics always in Prometheus text format.
     TSolomonStatPullExtension(const TParams& params, IApi* api);
     ~TSolomonStatPullExtension();
 
 private:
+    class TEncodedStatsCache;
+
     class TSolomonStatPage: public NMonitoring::IMonPage {
         friend class TSolomonStatPullExtension;
     public:
-        TSolomonStatPage(const std::string& title, const std::string& path, IApi* api);
+        TSolomonStatPage(const std::string& title, const std::string& path, std::shared_ptr<TEncodedStatsCache> cache,
+            NMonitoring::EFormat format = NMonitoring::EFormat::UNKNOWN);
 
         void Output(NMonitoring::IMonHttpRequest& request) override ;
 
     private:
-        IApi* Api_;
+        std::shared_ptr<TEncodedStatsCache> Cache_;
+        // Format negotiated by the Accept header if unknown
+        NMonitoring::EFormat Format_;
     };
 
 private:
     std::shared_ptr<NMonitoring::TMetricRegistry> MetricRegistry_;
     NMonitoring::TMonService2 MonService_;
+    std::shared_ptr<TEncodedStatsCache> Cache_;
     TIntrusivePtr<TSolomonStatPage> Page_;
+    TIntrusivePtr<TSolomonStatPage> PrometheusPage_;
 };
 
 } // namespace NSolomonStatExtension
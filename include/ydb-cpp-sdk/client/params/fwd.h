@@ -5,5 +5,7 @@ namespace NYdb::inline V3 {
 class TParams;
 class TParamValueBuilder;
 class TParamsBuilder;
+class TParamsTemplate;
+class TTemplateParamsBuilder;
 
 }  // namespace NYdb
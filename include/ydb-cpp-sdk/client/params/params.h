@@ -36,6 +36,7 @@ namespace NQuery {
 
 class TParams {
     friend class TParamsBuilder;
+    friend class TTemplateParamsBuilder;
     friend class NTable::TTableClient;
     friend class NTable::TSession;
     friend class NTable::TDataQuery;
@@ -96,4 +97,73 @@ private:
     std::unique_ptr<TImpl> Impl_;
 };
 
+//! Names and types of a parameter set which is executed many times with different values.
+//! Types are checked and converted once, builders created from the template only fill values.
+class TParamsTemplate {
+    friend class TTemplateParamsBuilder;
+public:
+    TParamsTemplate(const std::map<std::string, TType>& typeInfo);
+
+    //! Index of the parameter in the builders of the template
+    size_t GetSlot(const std::string& name) const;
+    size_t GetSlotsCount() const;
+
+    TTemplateParamsBuilder CreateBuilder() const;
+
+private:
+    class TImpl;
+    std::shared_ptr<const TImpl> Impl_;
+};
+
+//! Values of the template parameters, addressed by slots. The builder keeps a parameters map
+//! with the template types, primitive and Optional<primitive> values are set in it in place,
+//! other ones from TValue with a type check. Unset optional parameters are null.
+//! Build() hands the map out, so the same builder can be used for the next execution.
+//! The next execution copies the map from the template unless the previous TParams is
+//! given back with Recycle(), e.g. after executing it by const reference.
+class TTemplateParamsBuilder : public TMoveOnly {
+    friend class TParamsTemplate;
+public:
+    TTemplateParamsBuilder(TTemplateParamsBuilder&&);
+    ~TTemplateParamsBuilder();
+
+    TTemplateParamsBuilder& Bool(size_t slot, bool value);
+    TTemplateParamsBuilder& Int8(size_t slot, int8_t value);
+    TTemplateParamsBuilder& Uint8(size_t slot, uint8_t value);
+    TTemplateParamsBuilder& Int16(size_t slot, int16_t value);
+    TTemplateParamsBuilder& Uint16(size_t slot, uint16_t value);
+    TTemplateParamsBuilder& Int32(size_t slot, int32_t value);
+    TTemplateParamsBuilder& Uint32(size_t slot, uint32_t value);
+    TTemplateParamsBuilder& Int64(size_t slot, int64_t value);
+    TTemplateParamsBuilder& Uint64(size_t slot, uint64_t value);
+    TTemplateParamsBuilder& Float(size_t slot, float value);
+    TTemplateParamsBuilder& Double(size_t slot, double value);
+    TTemplateParamsBuilder& Date(size_t slot, const TInstant& value);
+    TTemplateParamsBuilder& Datetime(size_t slot, const TInstant& value);
+    TTemplateParamsBuilder& Timestamp(size_t slot, const TInstant& value);
+    TTemplateParamsBuilder& Interval(size_t slot, int64_t value);
+    TTemplateParamsBuilder& String(size_t slot, const std::string& value);
+    TTemplateParamsBuilder& Utf8(size_t slot, const std::string& value);
+    TTemplateParamsBuilder& Yson(size_t slot, const std::string& value);
+    TTemplateParamsBuilder& Json(size_t slot, const std::string& value);
+    TTemplateParamsBuilder& JsonDocument(size_t slot, const std::string& value);
+
+    //! Null value of an optional parameter
+    TTemplateParamsBuilder& Null(size_t slot);
+
+    TTemplateParamsBuilder& Value(size_t slot, const TValue& value);
+
+    TParams Build();
+
+    //! Reuses the map of params built by a builder of the same template for the next Build().
+    //! Other params are just released. Params moved to a request (TParams&&) are empty and are not reused.
+    void Recycle(TParams&& params);
+
+private:
+    TTemplateParamsBuilder(std::shared_ptr<const TParamsTemplate::TImpl> paramsTemplate);
+
+    class TImpl;
+    std::unique_ptr<TImpl> Impl_;
+};
+
 } // namespace NYdb
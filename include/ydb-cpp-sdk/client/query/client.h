@@ -45,6 +45,10 @@ struct TSessionPoolSettings {
     // Min number of session in session pool.
     // Sessions will not be closed by CloseIdleThreshold if the number of sessions less then this limit.
     FLUENT_SETTING_DEFAULT(uint32_t, MinPoolSize, 10);
+
+    // Number of sessions created in background right after client creation,
+    // so the first requests don't wait for CreateSession. Limited by MaxActiveSessions.
+    FLUENT_SETTING_DEFAULT(uint32_t, WarmUpSessions, 0);
 };
 
 struct TClientSettings : public TCommonClientSettingsBase<TClientSettings> {
@@ -79,12 +83,18 @@ public:
     TAsyncExecuteQueryResult ExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TParams& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
+    TAsyncExecuteQueryResult ExecuteQuery(const std::string& query, const TTxControl& txControl,
+        TParams&& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
+
     TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
     TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TParams& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
+    TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
+        TParams&& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
+
     TAsyncExecuteQueryResult RetryQuery(TQueryResultFunc&& queryFunc, TRetryOperationSettings settings = TRetryOperationSettings());
 
     TAsyncStatus RetryQuery(TQueryFunc&& queryFunc, TRetryOperationSettings settings = TRetryOperationSettings());
@@ -136,12 +146,18 @@ public:
     TAsyncExecuteQueryResult ExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TParams& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
+    TAsyncExecuteQueryResult ExecuteQuery(const std::string& query, const TTxControl& txControl,
+        TParams&& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
+
     TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
     TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
         const TParams& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
 
+    TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
+        TParams&& params, const TExecuteQuerySettings& settings = TExecuteQuerySettings());
+
     TAsyncBeginTransactionResult BeginTransaction(const TTxSettings& txSettings,
         const TBeginTxSettings& settings = TBeginTxSettings());
 
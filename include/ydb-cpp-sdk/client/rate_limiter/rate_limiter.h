@@ -3,6 +3,7 @@
 #include <ydb-cpp-sdk/client/driver/driver.h>
 
 #include <chrono>
+#include <functional>
 #include <unordered_map>
 #include <variant>
 
@@ -229,6 +230,51 @@ struct TAcquireResourceSettings : public TOperationRequestSettings<TAcquireResou
     FLUENT_SETTING_FLAG(IsUsedAmount);
 };
 
+// Settings for local quota cache of a resource.
+struct TLocalQuotaSettings {
+    using TSelf = TLocalQuotaSettings;
+
+    // Units acquired from coordination node with one acquire resource request.
+    FLUENT_SETTING_DEFAULT(uint64_t, BatchSize, 100);
+
+    // Background refill starts when less than this number of units is left in the local bucket.
+    // Default value is a quarter of BatchSize.
+    FLUENT_SETTING_OPTIONAL(uint64_t, RefillWatermark);
+
+    // Settings for batch acquire resource requests.
+    // Amount and IsUsedAmount are ignored.
+    FLUENT_SETTING(TAcquireResourceSettings, AcquireSettings);
+};
+
+// Client-side cache of resource units.
+// Units are acquired from coordination node in batches of BatchSize and then
+// served locally from a lock-free bucket without a request per acquisition.
+// The bucket is refilled asynchronously when it runs low.
+// Coordination node has no way to take back acquired units, so at most
+// one batch of units may be left unused when the quota is destroyed.
+class TLocalQuota {
+public:
+    using TAcquireBatch = std::function<TAsyncStatus(uint64_t amount)>;
+
+    // acquireBatch is called to get more units, it is never called concurrently.
+    TLocalQuota(TAcquireBatch acquireBatch, const TLocalQuotaSettings& settings = {});
+
+    // Takes units from the local bucket without waiting.
+    // Returns false if there are not enough units locally, refill is started in this case.
+    bool TryAcquire(uint64_t amount = 1);
+
+    // Takes units from the local bucket, waits for refill if there are not enough units.
+    // Waiting acquisitions are served in order, the result is an error if refill fails.
+    TAsyncStatus Acquire(uint64_t amount = 1);
+
+    // Units left in the local bucket.
+    uint64_t GetAvailable() const;
+
+private:
+    class TImpl;
+    std::shared_ptr<TImpl> Impl_;
+};
+
 using TAsyncListResourcesResult = NThreading::TFuture<TListResourcesResult>;
 
 // Result for describe resource request.
@@ -319,6 +365,10 @@ public:
     // CancelAfter should be less than OperationTimeout.
     TAsyncStatus AcquireResource(const std::string& coordinationNodePath, const std::string& resourcePath, const TAcquireResourceSettings& = {});
 
+    // Create local quota cache for resource's units.
+    // Units are acquired in batches with AcquireResource and served locally, see TLocalQuota.
+    TLocalQuota CreateLocalQuota(const std::string& coordinationNodePath, const std::string& resourcePath, const TLocalQuotaSettings& = {});
+
 private:
     class TImpl;
     std::shared_ptr<TImpl> Impl_;
@@ -10,6 +10,10 @@ namespace Ydb {
     class ResultSet;
 }
 
+namespace google::protobuf {
+    class Arena;
+}
+
 namespace NYdb::inline V3 {
 
 class TProtoAccessor;
@@ -36,6 +40,8 @@ class TResultSet {
 public:
     TResultSet(const Ydb::ResultSet& proto);
     TResultSet(Ydb::ResultSet&& proto);
+    //! Result set allocated on the arena, the arena is kept alive while the result set is used
+    TResultSet(Ydb::ResultSet* proto, std::shared_ptr<google::protobuf::Arena> arena);
 
     //! Returns number of columns
     size_t ColumnsCount() const;
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "fwd.h"
+
+#include <ydb-cpp-sdk/client/types/fluent_settings_helpers.h>
+
+#include <util/stream/output.h>
+
+#include <memory>
+#include <string>
+
+namespace NYdb::inline V3 {
+
+//! Writes rows of result sets to a stream. A writer is fed with the parts of one result:
+//! the result sets of TExecuteQueryIterator parts with the same result set index, scan query parts
+//! or ReadTable parts. All parts must have the same columns.
+//!
+//! Values are formatted directly from the result set protobuf by per-column formatters
+//! chosen once for the column type, without TValueParser:
+//! Date, Datetime and Timestamp are written in ISO 8601 UTC, Interval as a number of microseconds,
+//! Decimal and Uuid in their text form, containers as JSON.
+class IResultSetWriter {
+public:
+    virtual ~IResultSetWriter() = default;
+
+    virtual void Write(const TResultSet& resultSet) = 0;
+};
+
+//! RFC 4180 CSV, fields containing the delimiter, quotes or line breaks are quoted
+struct TCsvWriterSettings {
+    using TSelf = TCsvWriterSettings;
+
+    FLUENT_SETTING_DEFAULT(char, Delimiter, ',');
+    //! Write the column names before the first row
+    FLUENT_SETTING_DEFAULT(bool, Header, true);
+    //! Text written for NULL values
+    FLUENT_SETTING_DEFAULT(std::string, NullValue, "");
+};
+
+//! One JSON object per row, keyed by the column names
+struct TJsonLinesWriterSettings {
+    using TSelf = TJsonLinesWriterSettings;
+
+    //! Write String and Yson values in base64 instead of as they are, they may be not valid UTF-8
+    FLUENT_SETTING_DEFAULT(bool, BinaryAsBase64, false);
+};
+
+std::unique_ptr<IResultSetWriter> CreateCsvWriter(IOutputStream& out, const TCsvWriterSettings& settings = {});
+std::unique_ptr<IResultSetWriter> CreateJsonLinesWriter(IOutputStream& out, const TJsonLinesWriterSettings& settings = {});
+
+} // namespace NYdb
@@ -1,10 +1,66 @@
 #pragma once
 
 #include <ydb-cpp-sdk/client/types/fluent_settings_helpers.h>
+#include <ydb-cpp-sdk/client/types/status_codes.h>
 #include <util/datetime/base.h>
 
+#include <memory>
+#include <string>
+
 namespace NYdb::inline V3::NRetry {
 
+enum class ERetryDecision {
+    Allow,
+    BudgetExhausted,
+    CircuitOpen,
+};
+
+struct TRetryBudgetSettings {
+    using TSelf = TRetryBudgetSettings;
+
+    //! Tokens deposited by every successful operation, every retry takes one token.
+    FLUENT_SETTING_DEFAULT(double, RetryRatio, 0.1);
+    //! Tokens deposited per second regardless of traffic.
+    FLUENT_SETTING_DEFAULT(double, MinRetriesPerSecond, 10.0);
+    //! Limit of accumulated tokens, budget starts full.
+    FLUENT_SETTING_DEFAULT(double, MaxTokens, 100.0);
+    //! Consecutive failures with the same status on the same endpoint that open circuit breaker.
+    //! Zero disables circuit breaker.
+    FLUENT_SETTING_DEFAULT(uint32_t, CircuitBreakerThreshold, 20);
+    //! Retries of failures with the status on the endpoint are denied while circuit breaker is open.
+    //! After that one more failure opens it again, a success closes it.
+    //! Breakers without failures for this duration are forgotten.
+    FLUENT_SETTING_DEFAULT(TDuration, CircuitBreakerOpenDuration, TDuration::Seconds(5));
+};
+
+//! Retry budget shared by retry operations of any number of clients.
+//! Limits the rate of retries by a fraction of successful operations,
+//! so degraded cluster doesn't get its load multiplied by retries.
+class TRetryBudget {
+public:
+    using TPtr = std::shared_ptr<TRetryBudget>;
+
+    explicit TRetryBudget(const TRetryBudgetSettings& settings = TRetryBudgetSettings());
+    ~TRetryBudget();
+
+    //! Reports successful operation on endpoint.
+    void OnSuccess(const std::string& endpoint);
+
+    //! Reports retriable failure on endpoint and decides if it can be retried.
+    //! Takes a token from the budget if retry is allowed.
+    ERetryDecision OnFailure(const std::string& endpoint, EStatus status);
+
+    //! Takes a token for a retry without accounting the failure in circuit breakers,
+    //! for callers that don't report successes and would keep the breakers open.
+    ERetryDecision TakeRetry();
+
+    double GetAvailableTokens() const;
+
+private:
+    class TImpl;
+    std::unique_ptr<TImpl> Impl_;
+};
+
 struct TBackoffSettings {
     using TSelf = TBackoffSettings;
 
@@ -25,6 +81,8 @@ struct TRetryOperationSettings {
     FLUENT_SETTING_FLAG(Idempotent);
     FLUENT_SETTING_FLAG(Verbose);
     FLUENT_SETTING_FLAG(RetryUndefined);
+    //! Shared retry budget, retries are not limited by it if not set.
+    FLUENT_SETTING(TRetryBudget::TPtr, RetryBudget);
 
     static TBackoffSettings DefaultFastBackoffSettings() {
         return TBackoffSettings()
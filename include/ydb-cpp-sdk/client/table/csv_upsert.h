@@ -0,0 +1,69 @@
+#pragma once
+
+#include "table.h"
+
+#include <util/stream/input.h>
+
+#include <functional>
+
+namespace NYdb::inline V3 {
+namespace NTable {
+
+struct TCsvUpsertProgress {
+    uint64_t Rows = 0;
+    uint64_t Bytes = 0;
+    uint64_t Requests = 0;
+    TDuration Elapsed;
+
+    double GetRowsPerSecond() const;
+    double GetBytesPerSecond() const;
+};
+
+//! Settings of BulkUpsertCsv and BulkUpsertCsvFile
+struct TCsvUpsertSettings {
+    using TSelf = TCsvUpsertSettings;
+    using TProgressCallback = std::function<void(const TCsvUpsertProgress&)>;
+
+    //! Settings of every BulkUpsert request. FormatSettings holds Ydb.Formats.CsvSettings of the input:
+    //! skip_rows and the header line are taken from the beginning of the input,
+    //! the header is repeated in every request.
+    FLUENT_SETTING(TBulkUpsertSettings, BulkUpsertSettings);
+
+    //! Approximate size of the data of one request, chunks end at row boundaries
+    FLUENT_SETTING_DEFAULT(uint64_t, ChunkSize, 8 << 20);
+
+    //! Max number of concurrent BulkUpsert requests
+    FLUENT_SETTING_DEFAULT(uint32_t, MaxInFlight, 8);
+
+    //! Number of threads searching for row boundaries of a file
+    FLUENT_SETTING_DEFAULT(uint32_t, SplitThreads, 4);
+
+    FLUENT_SETTING(TRetryOperationSettings, RetrySettings);
+
+    //! Called after every upserted chunk, from a client thread
+    FLUENT_SETTING(TProgressCallback, ProgressCallback);
+};
+
+class TCsvUpsertResult : public TStatus {
+public:
+    TCsvUpsertResult(TStatus&& status, const TCsvUpsertProgress& progress);
+
+    //! Data upserted before the end or the first failed request
+    const TCsvUpsertProgress& GetProgress() const;
+
+private:
+    TCsvUpsertProgress Progress_;
+};
+
+//! Upserts a CSV file by BulkUpsert requests of row aligned chunks. The file is memory mapped
+//! and split by several threads. Quote characters are expected to enclose whole fields only,
+//! line breaks inside quoted fields don't split rows. Blocks until all requests are done.
+TCsvUpsertResult BulkUpsertCsvFile(TTableClient& client, const std::string& table, const std::string& path,
+    const TCsvUpsertSettings& settings = TCsvUpsertSettings());
+
+//! Same as BulkUpsertCsvFile for data read from a stream
+TCsvUpsertResult BulkUpsertCsv(TTableClient& client, const std::string& table, IInputStream& input,
+    const TCsvUpsertSettings& settings = TCsvUpsertSettings());
+
+} // namespace NTable
+} // namespace NYdb
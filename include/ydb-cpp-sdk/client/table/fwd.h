@@ -47,6 +47,7 @@ struct TRollbackTxSettings;
 struct TCloseSessionSettings;
 struct TKeepAliveSettings;
 struct TReadTableSettings;
+struct TParallelReadTableSettings;
 
 class TPartitioningSettings;
 class TDateTypeColumnModeSettings;
@@ -99,6 +100,7 @@ class TScanQueryPart;
 
 class TTablePartIterator;
 class TScanQueryPartIterator;
+class TParallelTablePartIterator;
 
 class TReadTableSnapshot;
 
@@ -1097,6 +1097,7 @@ using TAsyncKeepAliveResult = NThreading::TFuture<TKeepAliveResult>;
 using TAsyncBulkUpsertResult = NThreading::TFuture<TBulkUpsertResult>;
 using TAsyncReadRowsResult = NThreading::TFuture<TReadRowsResult>;
 using TAsyncScanQueryPartIterator = NThreading::TFuture<TScanQueryPartIterator>;
+using TAsyncParallelTablePartIterator = NThreading::TFuture<TParallelTablePartIterator>;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -1125,6 +1126,10 @@ struct TSessionPoolSettings {
     // Min number of session in session pool.
     // Sessions will not be closed by CloseIdleThreshold if the number of sessions less then this limit.
     FLUENT_SETTING_DEFAULT(uint32_t, MinPoolSize, 10);
+
+    // Number of sessions created in background right after client creation,
+    // so the first requests don't wait for CreateSession. Limited by MaxActiveSessions.
+    FLUENT_SETTING_DEFAULT(uint32_t, WarmUpSessions, 0);
 };
 
 struct TClientSettings : public TCommonClientSettingsBase<TClientSettings> {
@@ -1162,6 +1167,8 @@ struct TBulkUpsertSettings : public TOperationRequestSettings<TBulkUpsertSetting
     // Format setting proto serialized into string. If not set format defaults are used.
     // I.e. it's Ydb.Table.CsvSettings for CSV.
     FLUENT_SETTING_DEFAULT(std::string, FormatSettings, "");
+    // Compress the request with gzip on the wire
+    FLUENT_SETTING_DEFAULT(bool, Compress, false);
     google::protobuf::Arena* Arena_ = nullptr;
     TBulkUpsertSettings& Arena(google::protobuf::Arena* arena) { Arena_ = arena; return *this; }
 };
@@ -1181,6 +1188,50 @@ struct TStreamExecScanQuerySettings : public TRequestSettings<TStreamExecScanQue
     FLUENT_SETTING_DEFAULT(bool, CollectFullDiagnostics, false);
 };
 
+struct TReadTableSettings : public TRequestSettings<TReadTableSettings> {
+
+    using TSelf = TReadTableSettings;
+
+    FLUENT_SETTING_OPTIONAL(TKeyBound, From);
+
+    FLUENT_SETTING_OPTIONAL(TKeyBound, To);
+
+    FLUENT_SETTING_VECTOR(std::string, Columns);
+
+    FLUENT_SETTING_FLAG(Ordered);
+
+    FLUENT_SETTING_OPTIONAL(uint64_t, RowLimit);
+
+    FLUENT_SETTING_OPTIONAL(bool, UseSnapshot);
+
+    FLUENT_SETTING_OPTIONAL(uint64_t, BatchLimitBytes);
+
+    FLUENT_SETTING_OPTIONAL(uint64_t, BatchLimitRows);
+
+    FLUENT_SETTING_OPTIONAL(bool, ReturnNotNullAsOptional);
+};
+
+//! Settings of TTableClient::ReadTableParallel
+struct TParallelReadTableSettings {
+    using TSelf = TParallelReadTableSettings;
+
+    //! Settings of the stream of every key range, From and To must not be set.
+    //! With Ordered, parts of all ranges are returned in key order, otherwise
+    //! only the parts of one range are ordered. RowLimit is applied to every range.
+    FLUENT_SETTING(TReadTableSettings, ReadTableSettings);
+
+    //! Max number of concurrent streams, every stream holds a session from the session pool
+    FLUENT_SETTING_DEFAULT(uint32_t, MaxStreams, 8);
+
+    //! Max number of parts read ahead by a stream and not yet returned by ReadNext
+    FLUENT_SETTING_DEFAULT(uint32_t, MaxBufferedParts, 2);
+
+    //! Retries of DescribeTable and of every range. A broken stream is restarted after
+    //! the last received key, so the primary key columns must be among the read columns.
+    //! Retries of a range are counted since the last part received by its stream.
+    FLUENT_SETTING(TRetryOperationSettings, RetrySettings);
+};
+
 enum class EDataFormat {
     ApacheArrow = 1,
     CSV = 2,
@@ -1281,6 +1332,11 @@ public:
     TAsyncScanQueryPartIterator StreamExecuteScanQuery(const std::string& query, const TParams& params,
         const TStreamExecScanQuerySettings& settings = TStreamExecScanQuerySettings());
 
+    //! Reads the whole table by several concurrent ReadTable streams,
+    //! one per key range of the table shards. Ranges are read from different snapshots.
+    TAsyncParallelTablePartIterator ReadTableParallel(const std::string& path,
+        const TParallelReadTableSettings& settings = TParallelReadTableSettings());
+
 private:
     class TImpl;
     std::shared_ptr<TImpl> Impl_;
@@ -1744,29 +1800,6 @@ struct TCloseSessionSettings : public TOperationRequestSettings<TCloseSessionSet
 
 struct TKeepAliveSettings : public TOperationRequestSettings<TKeepAliveSettings> {};
 
-struct TReadTableSettings : public TRequestSettings<TReadTableSettings> {
-
-    using TSelf = TReadTableSettings;
-
-    FLUENT_SETTING_OPTIONAL(TKeyBound, From);
-
-    FLUENT_SETTING_OPTIONAL(TKeyBound, To);
-
-    FLUENT_SETTING_VECTOR(std::string, Columns);
-
-    FLUENT_SETTING_FLAG(Ordered);
-
-    FLUENT_SETTING_OPTIONAL(uint64_t, RowLimit);
-
-    FLUENT_SETTING_OPTIONAL(bool, UseSnapshot);
-
-    FLUENT_SETTING_OPTIONAL(uint64_t, BatchLimitBytes);
-
-    FLUENT_SETTING_OPTIONAL(uint64_t, BatchLimitRows);
-
-    FLUENT_SETTING_OPTIONAL(bool, ReturnNotNullAsOptional);
-};
-
 //! Represents all session operations
 //! Session is transparent logic representation of connection
 class TSession {
@@ -2115,6 +2148,40 @@ private:
 
 using TReadTableResultPart = TSimpleStreamPart<TResultSet>;
 
+class TParallelReadTablePart : public TReadTableResultPart {
+public:
+    TParallelReadTablePart(TReadTableResultPart&& part, size_t rangeIndex)
+        : TReadTableResultPart(std::move(part))
+        , RangeIndex_(rangeIndex)
+    {}
+
+    //! Key range of the part, ranges are numbered in key order
+    size_t GetRangeIndex() const { return RangeIndex_; }
+
+private:
+    size_t RangeIndex_;
+};
+
+using TAsyncParallelReadTablePart = NThreading::TFuture<TParallelReadTablePart>;
+
+class TParallelTablePartIterator : public TStatus {
+    friend class TTableClient;
+public:
+    //! Returns the next part of any range, EOS after all ranges are read.
+    //! May be called by several threads at once, every part is returned once.
+    TAsyncParallelReadTablePart ReadNext();
+
+    size_t GetRangesCount() const;
+
+    class TReaderImpl;
+private:
+    TParallelTablePartIterator(
+        std::shared_ptr<TReaderImpl> impl,
+        TStatus&& status
+    );
+    std::shared_ptr<TReaderImpl> ReaderImpl_;
+};
+
 class TScanQueryPart : public TStreamPartStatus {
 public:
     bool HasResultSet() const { return ResultSet_.has_value(); }
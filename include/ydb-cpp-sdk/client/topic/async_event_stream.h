@@ -0,0 +1,111 @@
+#pragma once
+
+#include "events_common.h"
+
+#include <library/cpp/threading/future/core/coroutine_traits.h>
+
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <variant>
+
+namespace NYdb::inline V3::NTopic {
+
+//! Awaitable stream of events of a read or write session.
+//!
+//! Usage inside a coroutine:
+//!     auto events = MakeAsyncEventStream(session);
+//!     while (auto event = co_await events.Next()) {
+//!         ...
+//!     }
+//!
+//! Next() yields events in the same order as GetEvent() and std::nullopt after TSessionClosedEvent.
+//! Waiting for an event only subscribes to the WaitEvent() future of the session.
+template <class TSession>
+class TAsyncEventStream {
+public:
+    using TEvent = typename decltype(std::declval<TSession&>().GetEvent(false))::value_type;
+
+    class TNextAwaitable {
+    public:
+        bool await_ready() {
+            if (!Stream_->Finished_) {
+                Event_ = Stream_->Session_->GetEvent(false);
+            }
+            return Stream_->Finished_ || Event_;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept {
+            Handle_ = handle;
+            return Subscribe();
+        }
+
+        std::optional<TEvent> await_resume() {
+            if (Event_ && std::holds_alternative<TSessionClosedEvent>(*Event_)) {
+                Stream_->Finished_ = true;
+            }
+            return std::move(Event_);
+        }
+
+    private:
+        friend class TAsyncEventStream;
+
+        explicit TNextAwaitable(TAsyncEventStream* stream) noexcept
+            : Stream_(stream)
+        {}
+
+        // Returns false if the event is already received. A ready WaitEvent() future without an event,
+        // when the event was taken by another reader, is retried in a loop: subscribing to a ready
+        // future calls back synchronously and would recurse.
+        bool Subscribe() noexcept {
+            for (;;) {
+                auto future = Stream_->Session_->WaitEvent();
+                if (!future.IsReady()) {
+                    future.NoexceptSubscribe([this](const auto&) noexcept {
+                        OnEvent();
+                    });
+                    return true;
+                }
+                Event_ = Stream_->Session_->GetEvent(false);
+                if (Event_) {
+                    return false;
+                }
+            }
+        }
+
+        void OnEvent() noexcept {
+            Event_ = Stream_->Session_->GetEvent(false);
+            if (Event_ || !Subscribe()) {
+                Handle_.resume();
+            }
+        }
+
+        TAsyncEventStream* Stream_;
+        std::optional<TEvent> Event_;
+        std::coroutine_handle<> Handle_;
+    };
+
+    explicit TAsyncEventStream(std::shared_ptr<TSession> session)
+        : Session_(std::move(session))
+    {}
+
+    //! Waits for the next event, the stream must not be read concurrently.
+    TNextAwaitable Next() {
+        return TNextAwaitable(this);
+    }
+
+    bool IsFinished() const {
+        return Finished_;
+    }
+
+private:
+    std::shared_ptr<TSession> Session_;
+    bool Finished_ = false;
+};
+
+template <class TSession>
+TAsyncEventStream<TSession> MakeAsyncEventStream(std::shared_ptr<TSession> session) {
+    return TAsyncEventStream<TSession>(std::move(session));
+}
+
+} // namespace NYdb::NTopic
@@ -8,8 +8,11 @@
 
 #include <util/generic/buffer.h>
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace NYdb::inline V3::NTopic {
 
@@ -22,14 +25,23 @@ enum class ECodec : uint32_t {
 };
 
 inline const std::string& GetCodecId(const ECodec codec) {
-    static std::unordered_map<ECodec, std::string> idByCodec{
-        {ECodec::RAW, std::string(1, '\0')},
-        {ECodec::GZIP, "\1"},
-        {ECodec::LZOP, "\2"},
-        {ECodec::ZSTD, "\3"}
-    };
-    Y_ABORT_UNLESS(idByCodec.contains(codec));
-    return idByCodec[codec];
+    static const std::string rawId(1, '\0');
+    static const std::string gzipId("\1");
+    static const std::string lzopId("\2");
+    static const std::string zstdId("\3");
+
+    switch (codec) {
+    case ECodec::RAW:
+        return rawId;
+    case ECodec::GZIP:
+        return gzipId;
+    case ECodec::LZOP:
+        return lzopId;
+    case ECodec::ZSTD:
+        return zstdId;
+    default:
+        Y_ABORT("unknown codec %u", static_cast<uint32_t>(codec));
+    }
 }
 
 class ICodec {
@@ -57,6 +69,11 @@ class TUnsupportedCodec final : public ICodec {
     std::unique_ptr<IOutputStream> CreateCoder(TBuffer&, int) const override;
 };
 
+// Codecs registry.
+// Lookups are lock-free: codecs with small ids are kept in a fixed array,
+// other codecs are kept in an immutable map that is copied on every change.
+// Codecs and maps are never destroyed while the registry exists,
+// so pointers returned by GetOrThrow stay valid after the codec is replaced.
 class TCodecMap {
 public:
     static TCodecMap& GetTheCodecMap() {
@@ -66,17 +83,36 @@ public:
 
     void Set(uint32_t codecId, std::unique_ptr<ICodec>&& codecImpl) {
         with_lock(Lock) {
-            Codecs[codecId] = std::move(codecImpl);
+            const ICodec* codec = codecImpl.get();
+            Codecs.push_back(std::move(codecImpl));
+
+            if (codecId < FastCodecs.size()) {
+                FastCodecs[codecId].store(codec, std::memory_order_release);
+                return;
+            }
+
+            const TCustomCodecs* current = CustomCodecs.load(std::memory_order_acquire);
+            auto updated = current ? std::make_unique<TCustomCodecs>(*current) : std::make_unique<TCustomCodecs>();
+            (*updated)[codecId] = codec;
+            CustomCodecs.store(updated.get(), std::memory_order_release);
+            CustomCodecsVersions.push_back(std::move(updated));
         }
     }
 
     const ICodec* GetOrThrow(uint32_t codecId) const {
-        with_lock(Lock) {
-            if (!Codecs.contains(codecId)) {
-                throw yexception() << "codec with id " << uint32_t(codecId) << " not provided";
+        const ICodec* codec = nullptr;
+        if (codecId < FastCodecs.size()) {
+            codec = FastCodecs[codecId].load(std::memory_order_acquire);
+        } else if (const TCustomCodecs* customCodecs = CustomCodecs.load(std::memory_order_acquire)) {
+            if (auto it = customCodecs->find(codecId); it != customCodecs->end()) {
+                codec = it->second;
             }
-            return Codecs.at(codecId).get();
         }
+
+        if (!codec) {
+            throw yexception() << "codec with id " << uint32_t(codecId) << " not provided";
+        }
+        return codec;
     }
 
 
@@ -89,7 +125,15 @@ private:
     TCodecMap() = default;
 
 private:
-    std::unordered_map<uint32_t, std::unique_ptr<ICodec>> Codecs;
+    using TCustomCodecs = std::unordered_map<uint32_t, const ICodec*>;
+
+    // Built-in codecs ids are small, so they are looked up by index.
+    std::array<std::atomic<const ICodec*>, 64> FastCodecs = {};
+    std::atomic<const TCustomCodecs*> CustomCodecs = nullptr;
+
+    // Owned data, modified only under lock.
+    std::vector<std::unique_ptr<ICodec>> Codecs;
+    std::vector<std::unique_ptr<TCustomCodecs>> CustomCodecsVersions;
     TAdaptiveLock Lock;
 };
 
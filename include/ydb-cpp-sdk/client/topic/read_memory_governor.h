@@ -0,0 +1,55 @@
+#pragma once
+
+#include <library/cpp/monlib/dynamic_counters/counters.h>
+
+#include <util/generic/ptr.h>
+
+#include <functional>
+#include <vector>
+
+namespace NYdb::inline V3::NTopic {
+
+//! Memory budget shared by several read sessions.
+//!
+//! Every read session still respects its own MaxMemoryUsageBytes, but
+//! sessions with the same governor additionally share a common limit.
+//! Each registered session is guaranteed its fair share (limit / sessions count)
+//! and may grow beyond it only while the common budget has free memory.
+//! Sessions throttled by the governor are woken up when other sessions release memory.
+class IReadMemoryGovernor: public TThrRefBase {
+public:
+    using TPtr = TIntrusivePtr<IReadMemoryGovernor>;
+    using TSessionId = ui64;
+    using TWakeUpCallback = std::function<void()>;
+
+    //! Registers read session.
+    //! Wake up callback is called when memory becomes available for a throttled session.
+    virtual TSessionId RegisterSession(TWakeUpCallback wakeUp) = 0;
+
+    //! Unregisters read session and releases all memory accounted for it.
+    //! Returns callbacks of throttled sessions, they must be called without holding any locks.
+    virtual std::vector<TWakeUpCallback> UnregisterSession(TSessionId sessionId) = 0;
+
+    //! Memory limit that is available for the session at the moment.
+    virtual ui64 GetSessionLimit(TSessionId sessionId) const = 0;
+
+    //! Reports current memory usage of the session.
+    //! Returns callbacks of throttled sessions, they must be called without holding any locks.
+    virtual std::vector<TWakeUpCallback> UpdateSessionUsage(TSessionId sessionId, ui64 memoryUsage) = 0;
+
+    //! Common memory limit for all sessions.
+    virtual ui64 GetMaxMemoryUsageBytes() const = 0;
+
+    //! Total memory used by all sessions.
+    virtual ui64 GetMemoryUsageBytes() const = 0;
+
+    virtual size_t GetSessionsCount() const = 0;
+};
+
+//! Creates memory governor that limits total memory usage of read sessions by maxMemoryUsageBytes.
+//! If counters are provided, governor reports memoryLimitBytes, memoryUsageBytes, sessions,
+//! throttledSessions and wakeUps counters.
+IReadMemoryGovernor::TPtr CreateReadMemoryGovernor(ui64 maxMemoryUsageBytes,
+                                                   TIntrusivePtr<::NMonitoring::TDynamicCounters> counters = {});
+
+} // namespace NYdb::NTopic
@@ -3,6 +3,7 @@
 #include "counters.h"
 #include "executor.h"
 #include "read_events.h"
+#include "read_memory_governor.h"
 #include "retry_policy.h"
 
 #include <ydb-cpp-sdk/client/common_client/settings.h>
@@ -137,6 +138,13 @@ struct TReadSessionSettings: public TRequestSettings<TReadSessionSettings> {
         //! Executor for handlers.
         //! If not set, default single threaded executor will be used.
         FLUENT_SETTING(IExecutor::TPtr, HandlersExecutor);
+
+        //! Run handlers of different partition sessions concurrently on HandlersExecutor.
+        //! Handlers of one partition session are still called one after another in order of events,
+        //! so data, commit acknowledgement and partition session control events keep their order.
+        //! SessionClosedHandler is not ordered with partition session handlers.
+        //! Has effect only for asynchronous HandlersExecutor with more than one thread.
+        FLUENT_SETTING_DEFAULT(bool, ParallelPartitionHandlers, false);
     };
 
 
@@ -162,6 +170,10 @@ struct TReadSessionSettings: public TRequestSettings<TReadSessionSettings> {
     //! Maximum memory usage for read session.
     FLUENT_SETTING_DEFAULT(size_t, MaxMemoryUsageBytes, 100_MB);
 
+    //! Memory governor shared with other read sessions.
+    //! If set, session memory usage is also limited by the common budget of the governor.
+    FLUENT_SETTING(IReadMemoryGovernor::TPtr, MemoryGovernor);
+
     //! Max message time lag. All messages older that now - MaxLag will be ignored.
     FLUENT_SETTING_OPTIONAL(TDuration, MaxLag);
 
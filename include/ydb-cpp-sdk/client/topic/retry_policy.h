@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ydb-cpp-sdk/client/retry/retry.h>
 #include <ydb-cpp-sdk/client/types/status_codes.h>
 #include <ydb-cpp-sdk/library/retry/retry_policy.h>
 #include <util/generic/ptr.h>
@@ -36,6 +37,11 @@ struct IRetryPolicy: ::IRetryPolicy<EStatus> {
                                        size_t maxRetries = std::numeric_limits<size_t>::max(),
                                        TDuration maxTime = TDuration::Max(),
                                        std::function<ERetryErrorClass(EStatus)> customRetryClassFunction = {});
+
+    //! Policy that makes retries of the given policy only while they are allowed by the shared retry budget.
+    //! Topic sessions don't report successes, so they rely on retries deposited by other operations
+    //! and on TRetryBudgetSettings::MinRetriesPerSecond, and are not stopped by circuit breakers.
+    static TPtr GetBudgetedPolicy(TPtr policy, NRetry::TRetryBudget::TPtr budget);
 };
 
 } // namespace NYdb::NTopic
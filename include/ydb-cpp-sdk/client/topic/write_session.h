@@ -64,6 +64,18 @@ struct TWriteSessionSettings : public TRequestSettings<TWriteSessionSettings> {
     //! Memory usage consists of raw data pending compression and compressed messages being sent.
     FLUENT_SETTING_DEFAULT(uint64_t, MaxMemoryUsage, 20_MB);
 
+    //! Directory for the disk spool of the writer. If set, messages written while memory usage exceeds
+    //! MaxMemoryUsage are appended to memory mapped segment files in this directory instead of blocking the producer,
+    //! and are moved back to memory in write order as acks free memory. Segment files are removed once drained
+    //! and when the session is destroyed, spooled messages are lost if the session is closed with an error.
+    FLUENT_SETTING_OPTIONAL(std::string, SpoolDirectory);
+
+    //! Writer will not accept new messages if the disk spool exceeds this limit.
+    FLUENT_SETTING_DEFAULT(uint64_t, MaxSpoolSize, 1_GB);
+
+    //! Size of a spool segment file, larger messages get a segment of their own.
+    FLUENT_SETTING_DEFAULT(uint64_t, SpoolSegmentSize, 64_MB);
+
     //! Maximum messages accepted by writer but not written (with confirmation from server).
     //! Writer will not accept new messages after reaching the limit.
     FLUENT_SETTING_DEFAULT(uint32_t, MaxInflightCount, 100000);
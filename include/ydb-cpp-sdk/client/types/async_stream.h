@@ -0,0 +1,93 @@
+#pragma once
+
+#include <library/cpp/threading/future/core/coroutine_traits.h>
+
+#include <coroutine>
+#include <optional>
+#include <utility>
+
+namespace NYdb::inline V3 {
+
+//! Awaitable stream over a streaming result iterator, such as
+//! NQuery::TExecuteQueryIterator, NTable::TScanQueryPartIterator or NTable::TTablePartIterator.
+//!
+//! Usage inside a coroutine:
+//!     auto stream = MakeAsyncStream(std::move(iterator));
+//!     while (auto part = co_await stream.Next()) {
+//!         if (!part->IsSuccess()) { ... }
+//!     }
+//!
+//! Next() yields every part including the first unsuccessful one and std::nullopt after the end of stream.
+//! Awaiting a part only subscribes to the future returned by ReadNext(),
+//! so it costs no more allocations than Subscribe().
+template <class TIterator>
+class TAsyncPartStream {
+public:
+    using TPart = typename decltype(std::declval<TIterator&>().ReadNext())::value_type;
+
+    class TNextAwaitable {
+    public:
+        bool await_ready() const noexcept {
+            return !Future_.Initialized() || Future_.IsReady();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            Future_.NoexceptSubscribe([handle](const auto&) noexcept {
+                handle.resume();
+            });
+        }
+
+        std::optional<TPart> await_resume() {
+            if (!Future_.Initialized()) {
+                return std::nullopt;
+            }
+            TPart part = Future_.ExtractValue();
+            if (part.EOS()) {
+                *Finished_ = true;
+                return std::nullopt;
+            }
+            if (!part.IsSuccess()) {
+                *Finished_ = true;
+            }
+            return part;
+        }
+
+    private:
+        friend class TAsyncPartStream;
+
+        TNextAwaitable(NThreading::TFuture<TPart>&& future, bool* finished) noexcept
+            : Future_(std::move(future))
+            , Finished_(finished)
+        {}
+
+        NThreading::TFuture<TPart> Future_;
+        bool* Finished_;
+    };
+
+    explicit TAsyncPartStream(TIterator iterator)
+        : Iterator_(std::move(iterator))
+    {}
+
+    //! Reads the next part, the stream must not be read concurrently.
+    TNextAwaitable Next() {
+        if (Finished_) {
+            return TNextAwaitable({}, &Finished_);
+        }
+        return TNextAwaitable(Iterator_.ReadNext(), &Finished_);
+    }
+
+    bool IsFinished() const {
+        return Finished_;
+    }
+
+private:
+    TIterator Iterator_;
+    bool Finished_ = false;
+};
+
+template <class TIterator>
+TAsyncPartStream<TIterator> MakeAsyncStream(TIterator iterator) {
+    return TAsyncPartStream<TIterator>(std::move(iterator));
+}
+
+} // namespace NYdb
@@ -12,6 +12,17 @@
 
 namespace NYdb::inline V3 {
 
+//! Priority class of a request inside the driver.
+//! Every class has its own limit of requests waiting for discovery and
+//! responses of different classes are dispatched to the client threads
+//! in weighted-fair order (see TDriverConfig::SetRequestPriorityWeight),
+//! so background load can't starve interactive requests.
+enum class ERequestPriority {
+    Interactive = 0, // User-facing, latency sensitive requests
+    Batch = 1,       // Bulk loads, scans and other throughput oriented requests
+    Background = 2   // Service requests: discovery, session keep-alive etc.
+};
+
 template<typename TDerived>
 struct TRequestSettings {
     using TSelf = TDerived;
@@ -22,6 +33,7 @@ struct TRequestSettings {
     FLUENT_SETTING(THeader, Header);
     FLUENT_SETTING(TDuration, ClientTimeout);
     FLUENT_SETTING(std::string, TraceParent);
+    FLUENT_SETTING_DEFAULT(ERequestPriority, Priority, ERequestPriority::Interactive);
 
     TRequestSettings() = default;
 
@@ -32,6 +44,7 @@ struct TRequestSettings {
         , Header_(other.Header_)
         , ClientTimeout_(other.ClientTimeout_)
         , TraceParent_(other.TraceParent_)
+        , Priority_(other.Priority_)
     {}
 };
 
@@ -11,6 +11,9 @@
 #include <util/random/entropy.h>
 #include <util/generic/mapfindptr.h>
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace NYdb::inline V3 {
 namespace NCoordination {
 
@@ -307,6 +310,42 @@ private:
         }
     };
 
+    struct TSemaphoreLeaseWaiter {
+        uint64_t HoldId = 0;
+        TResultPromise<uint64_t> Promise;
+        // Set if the waiter gives up after the acquire timeout
+        IQueueClientContextPtr TimeoutContext;
+    };
+
+    struct TSemaphoreLease {
+        uint64_t LeaseId = 0;
+        uint64_t Count = 0;
+        // Holds of local acquirers, at most GetMaxLeaseHolders(Count) at a time
+        std::unordered_set<uint64_t> Holders;
+        std::deque<TSemaphoreLeaseWaiter> Waiters;
+        TAsyncResult<bool> Acquired;
+        // Set while the lease has no holders and waits for the idle timeout
+        IQueueClientContextPtr IdleContext;
+
+        bool IsIdle() const {
+            return Holders.empty() && Waiters.empty();
+        }
+    };
+
+    // Every local holder takes one unit of the acquired count,
+    // an exclusive lease takes the whole semaphore and has a single holder
+    static uint64_t GetMaxLeaseHolders(uint64_t count) {
+        return count == Max<uint64_t>() ? 1 : Max<uint64_t>(count, 1);
+    }
+
+    // Hold id of a local holder, or 0 if the acquisition has failed
+    static TAsyncResult<uint64_t> ToLeaseHold(const TAsyncResult<bool>& acquired, uint64_t holdId) {
+        return acquired.Apply([holdId] (const TAsyncResult<bool>& future) {
+            const auto& value = future.GetValue();
+            return TResult<uint64_t>(TStatus(value), value.IsSuccess() && value.GetResult() ? holdId : 0);
+        });
+    }
+
     struct TSimpleOp {
         TInstant SendTimestamp;
 
@@ -519,6 +558,224 @@ private:
         return op->Promise;
     }
 
+    TAsyncResult<uint64_t> DoAcquireSemaphoreLease(
+            const std::string& name,
+            const TAcquireSemaphoreSettings& settings)
+    {
+        TAsyncResult<bool> acquired;
+        uint64_t newLeaseId = 0;
+        uint64_t waitLeaseId = 0;
+        uint64_t holdId = 0;
+        IQueueClientContextPtr timeoutContext;
+        TResultPromise<uint64_t> waiter;
+        {
+            std::lock_guard guard(Lock);
+            if (IsClosed()) {
+                return MakeClosedResult<uint64_t>();
+            }
+            TSemaphoreLease* lease = MapFindPtr(SemaphoreLeases, name);
+            if (lease && lease->Count != settings.Count_) {
+                if (!lease->IsIdle()) {
+                    return MakeReadyResult<uint64_t>(
+                        MakeStatus(EStatus::BAD_REQUEST, "Semaphore lease is held with a different count"),
+                        uint64_t(0));
+                }
+                // Nobody uses the lease, release it and acquire with the new count
+                DropSemaphoreLeaseLocked(name, *lease);
+                lease = nullptr;
+            }
+            if (!lease) {
+                lease = &SemaphoreLeases[name];
+                lease->LeaseId = newLeaseId = NextLeaseId++;
+                lease->Count = settings.Count_;
+                auto op = MakeIntrusive<TSemaphoreAcquireOp>(settings);
+                lease->Acquired = op->Promise.GetFuture();
+                DoSemaphoreEnqueueOp(name, op);
+            }
+            holdId = NextLeaseHoldId++;
+            if (lease->Holders.size() < GetMaxLeaseHolders(lease->Count)) {
+                lease->Holders.insert(holdId);
+                if (lease->IdleContext) {
+                    lease->IdleContext->Cancel();
+                    lease->IdleContext.reset();
+                }
+                acquired = lease->Acquired;
+            } else if (settings.Timeout_ == TDuration::Zero()) {
+                return MakeReadyResult<uint64_t>(MakeStatus(), uint64_t(0));
+            } else {
+                // Wait for one of the holders to release the lease
+                waiter = NewResultPromise<uint64_t>();
+                if (settings.Timeout_ != TDuration::Max() && LocalContext) {
+                    timeoutContext = LocalContext->CreateContext();
+                }
+                lease->Waiters.push_back(TSemaphoreLeaseWaiter{holdId, waiter, timeoutContext});
+                waitLeaseId = lease->LeaseId;
+            }
+        }
+
+        if (waiter.Initialized()) {
+            if (timeoutContext) {
+                // N.B. to avoid deadlocks we must schedule timer outside the lock
+                auto handler = [self = TPtr(this), name, waitLeaseId, holdId] (bool ok) {
+                    if (ok) {
+                        self->OnSemaphoreLeaseWaitTimeout(name, waitLeaseId, holdId);
+                    }
+                };
+                Connections_->ScheduleCallback(
+                    settings.Timeout_,
+                    std::move(handler),
+                    std::move(timeoutContext));
+            }
+            return waiter.GetFuture();
+        }
+
+        if (newLeaseId) {
+            // N.B. subscribe outside the lock, the callback may run synchronously
+            acquired.Subscribe([self = TPtr(this), name, newLeaseId] (const TAsyncResult<bool>& future) {
+                const auto& value = future.GetValue();
+                if (!value.IsSuccess() || !value.GetResult()) {
+                    self->OnSemaphoreLeaseLost(name, newLeaseId, value);
+                }
+            });
+        }
+        return ToLeaseHold(acquired, holdId);
+    }
+
+    TAsyncResult<bool> DoReleaseSemaphoreLease(const std::string& name, uint64_t holdId) {
+        const TDuration idleTimeout = Settings_.SemaphoreLeaseIdleTimeout_;
+        IQueueClientContextPtr idleContext;
+        uint64_t leaseId = 0;
+        TSemaphoreLeaseWaiter next;
+        TAsyncResult<bool> acquired;
+        {
+            std::lock_guard guard(Lock);
+            if (IsClosed()) {
+                return MakeClosedResult<bool>();
+            }
+            TSemaphoreLease* lease = MapFindPtr(SemaphoreLeases, name);
+            if (!lease || !lease->Holders.erase(holdId)) {
+                return MakeReadyResult<bool>(MakeStatus(), false);
+            }
+            if (!lease->Waiters.empty()) {
+                // The acquisition stays held and goes to the next local acquirer
+                next = std::move(lease->Waiters.front());
+                lease->Waiters.pop_front();
+                lease->Holders.insert(next.HoldId);
+                acquired = lease->Acquired;
+            } else if (!lease->Holders.empty()) {
+                return MakeReadyResult<bool>(MakeStatus(), true);
+            } else {
+                if (idleTimeout != TDuration::Zero() && LocalContext) {
+                    idleContext = LocalContext->CreateContext();
+                }
+                if (!idleContext) {
+                    // Release on the server right away
+                    SemaphoreLeases.erase(name);
+                    auto op = MakeIntrusive<TSemaphoreReleaseOp>();
+                    DoSemaphoreEnqueueOp(name, op);
+                    return op->Promise;
+                }
+                lease->IdleContext = idleContext;
+                leaseId = lease->LeaseId;
+            }
+        }
+
+        if (next.Promise.Initialized()) {
+            if (next.TimeoutContext) {
+                next.TimeoutContext->Cancel();
+            }
+            // N.B. the next holder may continue synchronously, so it is woken up outside the lock
+            ToLeaseHold(acquired, next.HoldId).Subscribe([promise = next.Promise] (const TAsyncResult<uint64_t>& future) mutable {
+                promise.SetValue(future.GetValue());
+            });
+            return MakeReadyResult<bool>(MakeStatus(), true);
+        }
+
+        // N.B. to avoid deadlocks we must schedule timer outside the lock
+        auto handler = [self = TPtr(this), name, leaseId, idleContext] (bool ok) mutable {
+            if (ok) {
+                self->OnSemaphoreLeaseIdle(name, leaseId, std::move(idleContext));
+            }
+        };
+        Connections_->ScheduleCallback(
+            idleTimeout,
+            std::move(handler),
+            std::move(idleContext));
+
+        return MakeReadyResult<bool>(MakeStatus(), true);
+    }
+
+    // Forgets an idle lease and releases the semaphore on the server
+    void DropSemaphoreLeaseLocked(const std::string& name, TSemaphoreLease& lease) {
+        if (lease.IdleContext) {
+            lease.IdleContext->Cancel();
+        }
+        SemaphoreLeases.erase(name);
+        DoSemaphoreEnqueueOp(name, MakeIntrusive<TSemaphoreReleaseOp>());
+    }
+
+    void OnSemaphoreLeaseWaitTimeout(const std::string& name, uint64_t leaseId, uint64_t holdId) {
+        TResultPromise<uint64_t> promise;
+        {
+            std::lock_guard guard(Lock);
+            TSemaphoreLease* lease = MapFindPtr(SemaphoreLeases, name);
+            if (!lease || lease->LeaseId != leaseId) {
+                return;
+            }
+            auto it = std::find_if(lease->Waiters.begin(), lease->Waiters.end(),
+                [holdId] (const TSemaphoreLeaseWaiter& waiter) { return waiter.HoldId == holdId; });
+            if (it == lease->Waiters.end()) {
+                // The waiter got the lease in the meantime
+                return;
+            }
+            promise = std::move(it->Promise);
+            lease->Waiters.erase(it);
+        }
+
+        // Same as a timed out AcquireSemaphore
+        promise.SetValue(TResult<uint64_t>(MakeStatus(), uint64_t(0)));
+    }
+
+    void OnSemaphoreLeaseIdle(const std::string& name, uint64_t leaseId, IQueueClientContextPtr context) {
+        std::lock_guard guard(Lock);
+        TSemaphoreLease* lease = MapFindPtr(SemaphoreLeases, name);
+        if (!lease || lease->LeaseId != leaseId || lease->IdleContext != context) {
+            // Lease was reacquired or dropped, ignore
+            return;
+        }
+        if (IsClosed()) {
+            SemaphoreLeases.erase(name);
+            return;
+        }
+        lease->IdleContext.reset();
+        DropSemaphoreLeaseLocked(name, *lease);
+    }
+
+    void OnSemaphoreLeaseLost(const std::string& name, uint64_t leaseId, const TResult<bool>& result) {
+        std::deque<TSemaphoreLeaseWaiter> waiters;
+        {
+            std::lock_guard guard(Lock);
+            TSemaphoreLease* lease = MapFindPtr(SemaphoreLeases, name);
+            if (!lease || lease->LeaseId != leaseId) {
+                return;
+            }
+            // Acquisition failed, the next acquirer will start a new lease
+            if (lease->IdleContext) {
+                lease->IdleContext->Cancel();
+            }
+            waiters = std::move(lease->Waiters);
+            SemaphoreLeases.erase(name);
+        }
+
+        // Acquirers queued behind the failed one share its result
+        for (auto& waiter : waiters) {
+            if (waiter.TimeoutContext) {
+                waiter.TimeoutContext->Cancel();
+            }
+            waiter.Promise.SetValue(TResult<uint64_t>(TStatus(result), uint64_t(0)));
+        }
+    }
+
     TAsyncDescribeSemaphoreResult DoDescribeSemaphore(
             const std::string& name,
             const TDescribeSemaphoreSettings& settings)
@@ -696,6 +953,13 @@ private:
         return promise;
     }
 
+    template<class T, class... TArgs>
+    TAsyncResult<T> MakeReadyResult(TStatus&& status, TArgs&&... args) const {
+        auto promise = NewResultPromise<T>();
+        promise.SetValue(TResult<T>(std::move(status), std::forward<TArgs>(args)...));
+        return promise;
+    }
+
     void SendCloseRequest() {
         Y_ABORT_UNLESS(Processor);
         Y_ABORT_UNLESS(ClosedPromise.Initialized());
@@ -867,6 +1131,7 @@ private:
         TResultPromise<void> reconnectPromise;
         std::deque<TResultPromise<bool>> abortedSemaphoreOps;
         std::deque<TResultPromise<bool>> failedSemaphoreOps;
+        std::deque<TResultPromise<uint64_t>> failedLeaseWaiters;
         std::deque<std::unique_ptr<TSimpleOp>> failedSimpleOps;
         TResultPromise<void> closePromise;
 
@@ -978,6 +1243,18 @@ private:
             SemaphoreByReqId.clear();
             if (stopped) {
                 Semaphores.clear();
+                for (auto& kv : SemaphoreLeases) {
+                    if (kv.second.IdleContext) {
+                        kv.second.IdleContext->Cancel();
+                    }
+                    for (auto& waiter : kv.second.Waiters) {
+                        if (waiter.TimeoutContext) {
+                            waiter.TimeoutContext->Cancel();
+                        }
+                        failedLeaseWaiters.emplace_back(std::move(waiter.Promise));
+                    }
+                }
+                SemaphoreLeases.clear();
             }
 
             for (auto& kv : SentRequests) {
@@ -1013,6 +1290,10 @@ private:
             promise.SetValue(TResult<bool>(status, false));
         }
 
+        for (auto& promise : failedLeaseWaiters) {
+            promise.SetValue(TResult<uint64_t>(status, uint64_t(0)));
+        }
+
         for (auto& op : failedSimpleOps) {
             op->SetFailure(status);
         }
@@ -1757,6 +2038,9 @@ private:
 
     std::unordered_map<std::string, TSemaphoreState> Semaphores;
     std::unordered_map<uint64_t, TSemaphoreState*> SemaphoreByReqId;
+    std::unordered_map<std::string, TSemaphoreLease> SemaphoreLeases;
+    uint64_t NextLeaseId = 1;
+    uint64_t NextLeaseHoldId = 1;
     std::deque<std::unique_ptr<TSimpleOp>> PendingRequests;
     std::unordered_map<uint64_t, std::unique_ptr<TSimpleOp>> SentRequests;
     TResultPromise<void> ReconnectPromise;
@@ -2030,6 +2314,17 @@ public:
         return Context->DoReleaseSemaphore(name);
     }
 
+    TAsyncResult<uint64_t> AcquireSemaphoreLease(
+            const std::string& name,
+            const TAcquireSemaphoreSettings& settings)
+    {
+        return Context->DoAcquireSemaphoreLease(name, settings);
+    }
+
+    TAsyncResult<bool> ReleaseSemaphoreLease(const std::string& name, uint64_t holdId) {
+        return Context->DoReleaseSemaphoreLease(name, holdId);
+    }
+
     TAsyncDescribeSemaphoreResult DescribeSemaphore(
             const std::string& name,
             const TDescribeSemaphoreSettings& settings)
@@ -2094,6 +2389,17 @@ TAsyncResult<bool> TSession::ReleaseSemaphore(const std::string& name) {
     return Impl_->ReleaseSemaphore(name);
 }
 
+TAsyncResult<uint64_t> TSession::AcquireSemaphoreLease(
+    const std::string& name,
+    const TAcquireSemaphoreSettings& settings)
+{
+    return Impl_->AcquireSemaphoreLease(name, settings);
+}
+
+TAsyncResult<bool> TSession::ReleaseSemaphoreLease(const std::string& name, uint64_t holdId) {
+    return Impl_->ReleaseSemaphoreLease(name, holdId);
+}
+
 TAsyncDescribeSemaphoreResult TSession::DescribeSemaphore(
     const std::string& name,
     const TDescribeSemaphoreSettings& settings)
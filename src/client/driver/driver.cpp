@@ -39,6 +39,13 @@ public:
     std::shared_ptr<ICredentialsProviderFactory> GetCredentialsProviderFactory() const override { return CredentialsProviderFactory; }
     EDiscoveryMode GetDiscoveryMode() const override { return DiscoveryMode; }
     size_t GetMaxQueuedRequests() const override { return MaxQueuedRequests; }
+    size_t GetMaxQueuedRequests(ERequestPriority priority) const override {
+        const auto& limit = MaxQueuedRequestsByPriority[static_cast<size_t>(priority)];
+        return limit ? *limit : MaxQueuedRequests;
+    }
+    uint32_t GetRequestPriorityWeight(ERequestPriority priority) const override {
+        return RequestPriorityWeights[static_cast<size_t>(priority)];
+    }
     TTcpKeepAliveSettings GetTcpKeepAliveSettings() const override { return TcpKeepAliveSettings; }
     bool GetDrinOnDtors() const override { return DrainOnDtors; }
     TBalancingSettings GetBalancingSettings() const override { return BalancingSettings; }
@@ -49,6 +56,11 @@ public:
     uint64_t GetMaxInboundMessageSize() const override { return MaxInboundMessageSize; }
     uint64_t GetMaxOutboundMessageSize() const override { return MaxOutboundMessageSize; }
     uint64_t GetMaxMessageSize() const override { return MaxMessageSize; }
+    std::string GetDiscoveryCachePath() const override { return DiscoveryCachePath; }
+    size_t GetWarmUpEndpointsCount() const override { return WarmUpEndpointsCount; }
+    size_t GetChannelsPerEndpoint() const override { return ChannelsPerEndpoint; }
+    bool GetSeparateStreamingChannels() const override { return SeparateStreamingChannels; }
+    bool GetCollectRequestPhases() const override { return CollectRequestPhases; }
     const TLog& GetLog() const override { return Log; }
 
     std::string Endpoint;
@@ -61,6 +73,8 @@ public:
     std::shared_ptr<ICredentialsProviderFactory> CredentialsProviderFactory = CreateInsecureCredentialsProviderFactory();
     EDiscoveryMode DiscoveryMode = EDiscoveryMode::Sync;
     size_t MaxQueuedRequests = 100;
+    std::array<std::optional<size_t>, REQUEST_PRIORITY_COUNT> MaxQueuedRequestsByPriority;
+    TRequestPriorityWeights RequestPriorityWeights = {8, 2, 1};
     NYdbGrpc::TTcpKeepAliveSettings TcpKeepAliveSettings =
         {
             true,
@@ -77,6 +91,11 @@ public:
     uint64_t MaxInboundMessageSize = 0;
     uint64_t MaxOutboundMessageSize = 0;
     uint64_t MaxMessageSize = 0;
+    std::string DiscoveryCachePath;
+    size_t WarmUpEndpointsCount = 0;
+    size_t ChannelsPerEndpoint = 1;
+    bool SeparateStreamingChannels = false;
+    bool CollectRequestPhases = false;
     TLog Log; // Null by default.
 };
 
@@ -152,6 +171,16 @@ TDriverConfig& TDriverConfig::SetMaxQueuedRequests(size_t sz) {
     return *this;
 }
 
+TDriverConfig& TDriverConfig::SetMaxQueuedRequests(ERequestPriority priority, size_t sz) {
+    Impl_->MaxQueuedRequestsByPriority[static_cast<size_t>(priority)] = sz;
+    return *this;
+}
+
+TDriverConfig& TDriverConfig::SetRequestPriorityWeight(ERequestPriority priority, uint32_t weight) {
+    Impl_->RequestPriorityWeights[static_cast<size_t>(priority)] = weight;
+    return *this;
+}
+
 TDriverConfig& TDriverConfig::SetTcpKeepAliveSettings(bool enable, size_t idle, size_t count, size_t interval) {
     Impl_->TcpKeepAliveSettings.Enabled = enable;
     Impl_->TcpKeepAliveSettings.Idle = idle;
@@ -205,6 +234,31 @@ TDriverConfig& TDriverConfig::SetMaxMessageSize(uint64_t maxMessageSize) {
     return *this;
 }
 
+TDriverConfig& TDriverConfig::SetDiscoveryCachePath(const std::string& path) {
+    Impl_->DiscoveryCachePath = path;
+    return *this;
+}
+
+TDriverConfig& TDriverConfig::SetWarmUpEndpointsCount(size_t count) {
+    Impl_->WarmUpEndpointsCount = count;
+    return *this;
+}
+
+TDriverConfig& TDriverConfig::SetChannelsPerEndpoint(size_t count) {
+    Impl_->ChannelsPerEndpoint = count;
+    return *this;
+}
+
+TDriverConfig& TDriverConfig::SetSeparateStreamingChannels(bool separate) {
+    Impl_->SeparateStreamingChannels = separate;
+    return *this;
+}
+
+TDriverConfig& TDriverConfig::SetCollectRequestPhases(bool collect) {
+    Impl_->CollectRequestPhases = collect;
+    return *this;
+}
+
 TDriverConfig& TDriverConfig::SetLog(std::unique_ptr<TLogBackend>&& log) {
     Impl_->Log.ResetBackend(THolder(log.release()));
     return *this;
@@ -245,6 +299,11 @@ TDriverConfig TDriver::GetConfig() const {
     config.SetDatabase(Impl_->DefaultDatabase_);
     config.SetDiscoveryMode(Impl_->DefaultDiscoveryMode_);
     config.SetMaxQueuedRequests(Impl_->MaxQueuedRequests_);
+    for (auto priority : {ERequestPriority::Interactive, ERequestPriority::Batch, ERequestPriority::Background}) {
+        const size_t index = static_cast<size_t>(priority);
+        config.SetMaxQueuedRequests(priority, Impl_->MaxQueuedRequestsByPriority_[index]);
+        config.SetRequestPriorityWeight(priority, Impl_->RequestPriorityWeights_[index]);
+    }
     config.SetGrpcMemoryQuota(Impl_->MemoryQuota_);
     config.SetTcpKeepAliveSettings(
         Impl_->TcpKeepAliveSettings_.Enabled,
@@ -260,6 +319,11 @@ TDriverConfig TDriver::GetConfig() const {
     config.SetMaxInboundMessageSize(Impl_->MaxInboundMessageSize_);
     config.SetMaxOutboundMessageSize(Impl_->MaxOutboundMessageSize_);
     config.SetMaxMessageSize(Impl_->MaxMessageSize_);
+    config.SetDiscoveryCachePath(Impl_->DiscoveryCachePath_);
+    config.SetWarmUpEndpointsCount(Impl_->WarmUpEndpointsCount_);
+    config.SetChannelsPerEndpoint(Impl_->ChannelsPerEndpoint_);
+    config.SetSeparateStreamingChannels(Impl_->SeparateStreamingChannels_);
+    config.SetCollectRequestPhases(Impl_->CollectRequestPhases_);
     config.Impl_->Log = Impl_->Log;
 
     return config;
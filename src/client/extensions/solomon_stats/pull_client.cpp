@@ -1,7 +1,84 @@
 #include <ydb-cpp-sdk/client/extensions/solomon_stats/pull_client.h>
 
+#include <library/cpp/monlib/encode/prometheus/prometheus.h>
+#include <library/cpp/monlib/encode/spack/spack_v1.h>
+
+#include <util/generic/buffer.h>
+#include <util/stream/buffer.h>
+
+#include <map>
+#include <mutex>
+
 namespace NSolomonStatExtension::inline V3 {
 
+namespace {
+
+// Scrapes of the same format within the interval get the same encoded stats
+constexpr TDuration MIN_ENCODE_INTERVAL = TDuration::Seconds(1);
+
+NMonitoring::IMetricEncoderPtr MakeEncoder(NMonitoring::EFormat format, NMonitoring::ECompression compression,
+    IOutputStream* out)
+{
+    switch (format) {
+        case NMonitoring::EFormat::PROMETHEUS:
+            return NMonitoring::EncoderPrometheus(out);
+        case NMonitoring::EFormat::SPACK:
+            return NMonitoring::EncoderSpackV1(out, NMonitoring::ETimePrecision::SECONDS, compression);
+        default:
+            return NMonitoring::EncoderJson(out);
+    }
+}
+
+} // namespace
+
+// Every format keeps its last encoded stats in a buffer that is reused by the next encoding,
+// so steady scraping does not allocate output buffers, and concurrent scrapes of one format
+// wait for a single encoding instead of walking the registry in parallel.
+// Scrapes get a copy of the stats, a slow client does not hold the lock of the format.
+class TSolomonStatPullExtension::TEncodedStatsCache {
+    struct TEntry {
+        std::mutex Lock;
+        TInstant EncodedAt;
+        TBuffer Data;
+    };
+
+public:
+    explicit TEncodedStatsCache(IApi* api)
+        : Api_(api)
+    {}
+
+    void Read(NMonitoring::EFormat format, NMonitoring::ECompression compression, TBuffer& data) {
+        auto& entry = GetEntry(format, compression);
+        std::lock_guard guard(entry.Lock);
+
+        const auto now = TInstant::Now();
+        if (!entry.EncodedAt || now - entry.EncodedAt >= MIN_ENCODE_INTERVAL) {
+            entry.EncodedAt = TInstant::Zero();
+            entry.Data.Clear();
+            TBufferOutput output(entry.Data);
+            auto encoder = MakeEncoder(format, compression, &output);
+            Api_->Accept(encoder.Get());
+            encoder->Close();
+            entry.EncodedAt = now;
+        }
+        data.Assign(entry.Data.Data(), entry.Data.Size());
+    }
+
+private:
+    TEntry& GetEntry(NMonitoring::EFormat format, NMonitoring::ECompression compression) {
+        std::lock_guard guard(Lock_);
+        auto& entry = Entries_[{format, compression}];
+        if (!entry) {
+            entry = std::make_unique<TEntry>();
+        }
+        return *entry;
+    }
+
+    IApi* Api_;
+    std::mutex Lock_;
+    std::map<std::pair<NMonitoring::EFormat, NMonitoring::ECompression>, std::unique_ptr<TEntry>> Entries_;
+};
+
 TSolomonStatPullExtension::TParams::TParams(const std::string& host
     , ui16 port
     , const std::string& project
@@ -23,21 +100,50 @@ NMonitoring::TLabels TSolomonStatPullExtension::TParams::GetLabels() const {
 }
 
 
-TSolomonStatPullExtension::TSolomonStatPage::TSolomonStatPage(const std::string& title, const std::string& path, IApi* api)
-    : NMonitoring::IMonPage(TString(title), TString(path)), Api_(api)
+TSolomonStatPullExtension::TSolomonStatPage::TSolomonStatPage(const std::string& title, const std::string& path,
+    std::shared_ptr<TEncodedStatsCache> cache, NMonitoring::EFormat format)
+    : NMonitoring::IMonPage(TString(title), TString(path)), Cache_(std::move(cache)), Format_(format)
     { }
 
 void TSolomonStatPullExtension::TSolomonStatPage::Output(NMonitoring::IMonHttpRequest& request) {
-    request.Output() << NMonitoring::HTTPOKJSON;
-    auto json = NMonitoring::EncoderJson(&request.Output());
-    Api_->Accept(json.Get());
+    auto format = Format_;
+    if (format == NMonitoring::EFormat::UNKNOWN) {
+        format = NMonitoring::FormatFromAcceptHeader(request.GetHeader("Accept"));
+    }
+    if (format != NMonitoring::EFormat::PROMETHEUS && format != NMonitoring::EFormat::SPACK) {
+        format = NMonitoring::EFormat::JSON;
+    }
+
+    auto compression = NMonitoring::ECompression::IDENTITY;
+    if (format == NMonitoring::EFormat::SPACK) {
+        compression = NMonitoring::CompressionFromAcceptEncodingHeader(request.GetHeader("Accept-Encoding"));
+        if (compression == NMonitoring::ECompression::UNKNOWN) {
+            compression = NMonitoring::ECompression::IDENTITY;
+        }
+    }
+
+    auto& out = request.Output();
+    out << "HTTP/1.1 200 Ok\r\nContent-Type: " << NMonitoring::ContentTypeByFormat(format) << "\r\n";
+    if (compression != NMonitoring::ECompression::IDENTITY) {
+        out << "Content-Encoding: " << NMonitoring::ContentEncodingByCompression(compression) << "\r\n";
+    }
+    out << "Connection: Close\r\n\r\n";
+
+    // Kept by the server thread, so steady scraping reuses its memory
+    static thread_local TBuffer data;
+    Cache_->Read(format, compression, data);
+    out.Write(data.Data(), data.Size());
 }
 
 TSolomonStatPullExtension::TSolomonStatPullExtension(const TSolomonStatPullExtension::TParams& params, IApi* api)
     : MetricRegistry_(new NMonitoring::TMetricRegistry(params.GetLabels()))
-    , MonService_(params.Port_, TString(params.Host_), 0), Page_( new TSolomonStatPage("stats", "Statistics", api) ) {
+    , MonService_(params.Port_, TString(params.Host_), 0)
+    , Cache_(std::make_shared<TEncodedStatsCache>(api))
+    , Page_( new TSolomonStatPage("stats", "Statistics", Cache_) )
+    , PrometheusPage_( new TSolomonStatPage("metrics", "Prometheus metrics", Cache_, NMonitoring::EFormat::PROMETHEUS) ) {
         api->SetMetricRegistry(MetricRegistry_.get());
         MonService_.Register(Page_);
+        MonService_.Register(PrometheusPage_);
         MonService_.StartOrThrow();
     }
 
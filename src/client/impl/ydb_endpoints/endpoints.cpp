@@ -160,6 +160,19 @@ TEndpointRecord TEndpointElectorSafe::GetEndpoint(const TEndpointKey& preferredE
     }
 }
 
+std::vector<TEndpointRecord> TEndpointElectorSafe::GetBestEndpoints(size_t count) const {
+    std::vector<TEndpointRecord> result;
+    std::shared_lock guard(Mutex_);
+    // Records_ are kept sorted by priority, pessimized endpoints are at the end
+    for (const auto& record : Records_) {
+        if (result.size() >= count || record.Priority == Max<i32>()) {
+            break;
+        }
+        result.push_back(record);
+    }
+    return result;
+}
+
 // TODO: Suboptimal, but should not be used often
 void TEndpointElectorSafe::PessimizeEndpoint(const string& endpoint) {
     std::unique_lock guard(Mutex_);
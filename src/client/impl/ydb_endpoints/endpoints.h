@@ -94,6 +94,9 @@ public:
     // Returns preferred (if presents) or best endpoint
     TEndpointRecord GetEndpoint(const TEndpointKey& preferredEndpoint, bool onlyPreferred = false) const;
 
+    // Returns up to count endpoints with the best priority, best first
+    std::vector<TEndpointRecord> GetBestEndpoints(size_t count) const;
+
     // Move endpoint to the end
     void PessimizeEndpoint(const std::string& endpoint);
 
@@ -0,0 +1,76 @@
+#define INCLUDE_YDB_INTERNAL_H
+#include "discovery_cache.h"
+
+#include <util/digest/city.h>
+#include <util/folder/path.h>
+#include <util/stream/file.h>
+#include <util/string/builder.h>
+#include <util/string/hex.h>
+#include <util/system/fs.h>
+#include <util/system/fstat.h>
+#include <util/system/getpid.h>
+
+namespace NYdb::inline V3 {
+
+namespace {
+
+std::string MakeCachePath(const std::string& directory, const std::string& stateKey) {
+    // State key contains credentials identity and certificates, keep only its hash in the file name
+    const ui64 hash = CityHash64(stateKey.data(), stateKey.size());
+    return TFsPath(TString(directory)).Child(TStringBuilder() << "ydb_discovery_" << HexEncode(&hash, sizeof(hash))).GetPath();
+}
+
+} // namespace
+
+TDiscoveryCache::TDiscoveryCache(const std::string& directory, const std::string& stateKey)
+    : Path_(MakeCachePath(directory, stateKey))
+{}
+
+std::optional<Ydb::Discovery::ListEndpointsResult> TDiscoveryCache::Load() const {
+    const TString path(Path_);
+    try {
+        if (!NFs::Exists(path)) {
+            return std::nullopt;
+        }
+
+        const TFileStat stat(path);
+        if (TInstant::Now() - TInstant::Seconds(stat.MTime) > MaxAge) {
+            return std::nullopt;
+        }
+
+        Ydb::Discovery::ListEndpointsResult result;
+        if (!result.ParseFromString(TFileInput(path).ReadAll()) || result.endpoints().empty()) {
+            return std::nullopt;
+        }
+        return result;
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+void TDiscoveryCache::Store(const Ydb::Discovery::ListEndpointsResult& result) const {
+    if (result.endpoints().empty()) {
+        return;
+    }
+
+    const TString path(Path_);
+    const TString tmpPath = TStringBuilder() << Path_ << ".tmp." << GetPID();
+    try {
+        {
+            TFileOutput out(tmpPath);
+            out << result.SerializeAsString();
+            out.Finish();
+        }
+        if (!NFs::Rename(tmpPath, path)) {
+            NFs::Remove(tmpPath);
+        }
+    } catch (...) {
+        NFs::Remove(tmpPath);
+    }
+}
+
+const std::string& TDiscoveryCache::GetPath() const {
+    return Path_;
+}
+
+} // namespace NYdb
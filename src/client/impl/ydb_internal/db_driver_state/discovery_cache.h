@@ -0,0 +1,32 @@
+#pragma once
+
+#include <src/client/impl/ydb_internal/internal_header.h>
+
+#include <src/api/protos/ydb_discovery.pb.h>
+
+#include <util/datetime/base.h>
+
+#include <optional>
+
+namespace NYdb::inline V3 {
+
+// Keeps the last successful ListEndpointsResult of one driver state on disk,
+// so a restarted process can balance requests before the first discovery call returns
+class TDiscoveryCache {
+public:
+    // Entries older than this are ignored, endpoints could have moved since then
+    static constexpr TDuration MaxAge = TDuration::Hours(24);
+
+    TDiscoveryCache(const std::string& directory, const std::string& stateKey);
+
+    std::optional<Ydb::Discovery::ListEndpointsResult> Load() const;
+    // Replaces the cached entry atomically, errors are ignored: the cache is only an optimization
+    void Store(const Ydb::Discovery::ListEndpointsResult& result) const;
+
+    const std::string& GetPath() const;
+
+private:
+    const std::string Path_;
+};
+
+} // namespace NYdb
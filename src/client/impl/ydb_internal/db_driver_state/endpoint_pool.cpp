@@ -44,75 +44,8 @@ std::pair<NThreading::TFuture<TEndpointUpdateResult>, bool> TEndpointPool::Updat
         TListEndpointsResult result = future.GetValue();
         vector<string> removed;
         if (result.DiscoveryStatus.Status == EStatus::SUCCESS) {
-            vector<TEndpointRecord> records;
-            // Is used to convert float to integer load factor
-            // same integer values will be selected randomly.
-            const float multiplicator = 10.0;
-            const auto& preferredLocation = GetPreferredLocation(result.Result.self_location());
-            for (const auto& endpoint : result.Result.endpoints()) {
-                i32 loadFactor = (i32)(multiplicator * Min(LoadMax, Max(LoadMin, endpoint.load_factor())));
-                ui64 nodeId = endpoint.node_id();
-                if (BalancingSettings_.Policy != EBalancingPolicy::UseAllNodes) {
-                    if (endpoint.location() != preferredLocation) {
-                        // Location missmatch, shift this endpoint
-                        loadFactor += GetLocalityShift();
-                    }
-                }
-
-                std::string sslTargetNameOverride = endpoint.ssl_target_name_override();
-                auto getIpSslTargetNameOverride = [&]() -> std::string {
-                    if (!sslTargetNameOverride.empty()) {
-                        return sslTargetNameOverride;
-                    }
-                    if (endpoint.ssl()) {
-                        return endpoint.address();
-                    }
-                    return std::string();
-                };
-
-                bool addDefault = true;
-                for (const auto& addr : endpoint.ip_v6()) {
-                    if (addr.empty()) {
-                        continue;
-                    }
-                    TStringBuilder endpointBuilder;
-                    endpointBuilder << "ipv6:";
-                    if (addr[0] != '[') {
-                        endpointBuilder << "[";
-                    }
-                    endpointBuilder << addr;
-                    if (addr[addr.size()-1] != ']') {
-                        endpointBuilder << "]";
-                    }
-                    endpointBuilder << ":" << endpoint.port();
-                    std::string endpointString = std::move(endpointBuilder);
-                    records.emplace_back(std::move(endpointString), loadFactor, getIpSslTargetNameOverride(), nodeId);
-                    addDefault = false;
-                }
-                for (const auto& addr : endpoint.ip_v4()) {
-                    if (addr.empty()) {
-                        continue;
-                    }
-                    std::string endpointString =
-                        TStringBuilder()
-                            << "ipv4:"
-                            << addr
-                            << ":"
-                            << endpoint.port();
-                    records.emplace_back(std::move(endpointString), loadFactor, getIpSslTargetNameOverride(), nodeId);
-                    addDefault = false;
-                }
-                if (addDefault) {
-                    std::string endpointString =
-                        TStringBuilder()
-                            << endpoint.address()
-                            << ":"
-                            << endpoint.port();
-                    records.emplace_back(std::move(endpointString), loadFactor, std::move(sslTargetNameOverride), nodeId);
-                }
-            }
+            removed = SetEndpoints(result.Result);
             LastUpdateTime_ = TInstant::Now().MicroSeconds();
-            removed = Elector_.SetNewState(std::move(records));
         }
         NThreading::TPromise<TEndpointUpdateResult> promise;
         {
@@ -126,10 +59,90 @@ std::pair<NThreading::TFuture<TEndpointUpdateResult>, bool> TEndpointPool::Updat
     return {future, true};
 }
 
+void TEndpointPool::SeedEndpoints(const Ydb::Discovery::ListEndpointsResult& result) {
+    // LastUpdateTime_ stays untouched: seeded endpoints may be stale and must not delay the real discovery
+    SetEndpoints(result);
+}
+
+vector<string> TEndpointPool::SetEndpoints(const Ydb::Discovery::ListEndpointsResult& result) {
+    vector<TEndpointRecord> records;
+    // Is used to convert float to integer load factor
+    // same integer values will be selected randomly.
+    const float multiplicator = 10.0;
+    const auto& preferredLocation = GetPreferredLocation(result.self_location());
+    for (const auto& endpoint : result.endpoints()) {
+        i32 loadFactor = (i32)(multiplicator * Min(LoadMax, Max(LoadMin, endpoint.load_factor())));
+        ui64 nodeId = endpoint.node_id();
+        if (BalancingSettings_.Policy != EBalancingPolicy::UseAllNodes) {
+            if (endpoint.location() != preferredLocation) {
+                // Location missmatch, shift this endpoint
+                loadFactor += GetLocalityShift();
+            }
+        }
+
+        std::string sslTargetNameOverride = endpoint.ssl_target_name_override();
+        auto getIpSslTargetNameOverride = [&]() -> std::string {
+            if (!sslTargetNameOverride.empty()) {
+                return sslTargetNameOverride;
+            }
+            if (endpoint.ssl()) {
+                return endpoint.address();
+            }
+            return std::string();
+        };
+
+        bool addDefault = true;
+        for (const auto& addr : endpoint.ip_v6()) {
+            if (addr.empty()) {
+                continue;
+            }
+            TStringBuilder endpointBuilder;
+            endpointBuilder << "ipv6:";
+            if (addr[0] != '[') {
+                endpointBuilder << "[";
+            }
+            endpointBuilder << addr;
+            if (addr[addr.size()-1] != ']') {
+                endpointBuilder << "]";
+            }
+            endpointBuilder << ":" << endpoint.port();
+            std::string endpointString = std::move(endpointBuilder);
+            records.emplace_back(std::move(endpointString), loadFactor, getIpSslTargetNameOverride(), nodeId);
+            addDefault = false;
+        }
+        for (const auto& addr : endpoint.ip_v4()) {
+            if (addr.empty()) {
+                continue;
+            }
+            std::string endpointString =
+                TStringBuilder()
+                    << "ipv4:"
+                    << addr
+                    << ":"
+                    << endpoint.port();
+            records.emplace_back(std::move(endpointString), loadFactor, getIpSslTargetNameOverride(), nodeId);
+            addDefault = false;
+        }
+        if (addDefault) {
+            std::string endpointString =
+                TStringBuilder()
+                    << endpoint.address()
+                    << ":"
+                    << endpoint.port();
+            records.emplace_back(std::move(endpointString), loadFactor, std::move(sslTargetNameOverride), nodeId);
+        }
+    }
+    return Elector_.SetNewState(std::move(records));
+}
+
 TEndpointRecord TEndpointPool::GetEndpoint(const TEndpointKey& preferredEndpoint, bool onlyPreferred) const {
     return Elector_.GetEndpoint(preferredEndpoint, onlyPreferred);
 }
 
+std::vector<TEndpointRecord> TEndpointPool::GetBestEndpoints(size_t count) const {
+    return Elector_.GetBestEndpoints(count);
+}
+
 TDuration TEndpointPool::TimeSinceLastUpdate() const {
     auto now = TInstant::Now().MicroSeconds();
     return TDuration::MicroSeconds(now - LastUpdateTime_.load());
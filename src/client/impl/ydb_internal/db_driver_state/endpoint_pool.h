@@ -31,7 +31,10 @@ public:
     TEndpointPool(TListEndpointsResultProvider&& provider, const IInternalClient* client);
     ~TEndpointPool();
     std::pair<NThreading::TFuture<TEndpointUpdateResult>, bool> UpdateAsync();
+    // Fills the pool with previously known endpoints, e.g. from the discovery cache
+    void SeedEndpoints(const Ydb::Discovery::ListEndpointsResult& result);
     TEndpointRecord GetEndpoint(const TEndpointKey& preferredEndpoint, bool onlyPreferred = false) const;
+    std::vector<TEndpointRecord> GetBestEndpoints(size_t count) const;
     TDuration TimeSinceLastUpdate() const;
     void BanEndpoint(const std::string& endpoint);
     int GetPessimizationRatio();
@@ -46,6 +49,7 @@ public:
 
 private:
     std::string GetPreferredLocation(const std::string& selfLocation);
+    std::vector<std::string> SetEndpoints(const Ydb::Discovery::ListEndpointsResult& result);
 
 private:
     TListEndpointsResultProvider Provider_;
@@ -40,9 +40,19 @@ TDbDriverState::TDbDriverState(
         // this callback will be called just after shared_ptr initialization
         // so this call is safe
         auto self = shared_from_this();
-        return client->GetEndpoints(self);
+        auto result = client->GetEndpoints(self);
+        if (!self->DiscoveryCache) {
+            return result;
+        }
+        return result.Apply([cache = self->DiscoveryCache](TAsyncListEndpointsResult future) {
+            auto result = future.ExtractValue();
+            if (result.DiscoveryStatus.Ok()) {
+                cache->Store(result.Result);
+            }
+            return result;
+        });
     }, client)
-    , StatCollector(database, client->GetMetricRegistry())
+    , StatCollector(database, client->GetMetricRegistry(), client->GetCollectRequestPhases())
     , Log(Client->GetLog())
     , DiscoveryCompletedPromise(NThreading::NewPromise<void>())
 {
@@ -120,6 +130,7 @@ TPeriodicCb CreatePeriodicDiscoveryTask(TDbDriverState::TPtr driverState) {
                         const auto& updateResult = future.GetValue();
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
                         strong->Client->DeleteChannels(updateResult.Removed);
+                        strong->Client->WarmUpChannels(strong);
 #endif
                         if (strong->DiscoveryMode == EDiscoveryMode::Sync) {
                             std::unique_lock guard(strong->LastDiscoveryStatusRWLock);
@@ -138,6 +149,18 @@ TDbDriverStateTracker::TDbDriverStateTracker(IInternalClient* client)
     : DiscoveryClient_(client)
 {}
 
+std::string TDbDriverStateTracker::GetDiscoveryCacheKey(const TStateKey& key) {
+    const auto& sslCredentials = std::get<4>(key);
+    return TStringBuilder()
+        << std::get<0>(key) << '\0'
+        << std::get<1>(key) << '\0'
+        << std::get<2>(key) << '\0'
+        << static_cast<int>(std::get<3>(key)) << '\0'
+        << sslCredentials.IsEnabled << '\0'
+        << sslCredentials.CaCert << '\0'
+        << sslCredentials.Cert;
+}
+
 TDbDriverStatePtr TDbDriverStateTracker::GetDriverState(
     std::string database,
     std::string discoveryEndpoint,
@@ -206,6 +229,9 @@ TDbDriverStatePtr TDbDriverStateTracker::GetDriverState(
                     : CreateInsecureCredentialsProviderFactory()->CreateProvider(strongState));
 
             if (discoveryMode != EDiscoveryMode::Off) {
+                if (auto cachePath = DiscoveryClient_->GetDiscoveryCachePath(); !cachePath.empty()) {
+                    strongState->DiscoveryCache = std::make_shared<TDiscoveryCache>(cachePath, GetDiscoveryCacheKey(key));
+                }
                 DiscoveryClient_->AddPeriodicTask(CreatePeriodicDiscoveryTask(strongState), DISCOVERY_RECHECK_PERIOD);
             }
             Y_ABORT_UNLESS(States_.emplace(key, strongState).second);
@@ -214,15 +240,46 @@ TDbDriverStatePtr TDbDriverStateTracker::GetDriverState(
     }
 
     if (strongState->DiscoveryMode != EDiscoveryMode::Off) {
+        // Endpoints from the cache let requests go before the first discovery call completes,
+        // the call itself still runs and replaces them
+        bool seeded = false;
+        if (strongState->DiscoveryCache) {
+            if (auto cached = strongState->DiscoveryCache->Load()) {
+                strongState->EndpointPool.SeedEndpoints(*cached);
+#ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
+                DiscoveryClient_->WarmUpChannels(strongState);
+#endif
+                strongState->SignalDiscoveryCompleted();
+                seeded = true;
+                auto& log = strongState->Log;
+                if (log.IsOpen() && log.FiltrationLevel() >= TLOG_INFO) {
+                    log.Write(TLOG_INFO, TStringBuilder()
+                        << "Seeded " << cached->endpoints().size() << " endpoints from discovery cache "
+                        << strongState->DiscoveryCache->GetPath());
+                }
+            }
+        }
+
         auto updateResult = strongState->EndpointPool.UpdateAsync();
         if (updateResult.second) {
-            auto cb = [strongState](const NThreading::TFuture<TEndpointUpdateResult>&) {
+            auto cb = [strongState, seeded](const NThreading::TFuture<TEndpointUpdateResult>& future) {
+                const auto& updateResult = future.GetValue();
+#ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
+                if (seeded) {
+                    strongState->Client->DeleteChannels(updateResult.Removed);
+                }
+                strongState->Client->WarmUpChannels(strongState);
+#endif
+                if (seeded && strongState->DiscoveryMode == EDiscoveryMode::Sync) {
+                    std::unique_lock guard(strongState->LastDiscoveryStatusRWLock);
+                    strongState->LastDiscoveryStatus = updateResult.DiscoveryStatus;
+                }
                 strongState->SignalDiscoveryCompleted();
             };
             updateResult.first.Subscribe(cb);
         }
 
-        if (strongState->DiscoveryMode == EDiscoveryMode::Sync) {
+        if (strongState->DiscoveryMode == EDiscoveryMode::Sync && !seeded) {
             const auto& discoveryStatus = updateResult.first.GetValueSync().DiscoveryStatus;
             // Almost always true, except the situation when the current thread was
             // preempted just before UpdateAsync call and other one get
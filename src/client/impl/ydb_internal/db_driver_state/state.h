@@ -1,5 +1,6 @@
 #pragma once
 
+#include "discovery_cache.h"
 #include "endpoint_pool.h"
 
 #include <src/client/impl/ydb_internal/internal_header.h>
@@ -56,6 +57,8 @@ public:
     std::shared_ptr<ICredentialsProvider> CredentialsProvider;
     IInternalClient* Client;
     TEndpointPool EndpointPool;
+    // Persistent copy of the last discovery result, null if disabled
+    std::shared_ptr<TDiscoveryCache> DiscoveryCache;
     // StopCb allow client to subscribe for notifications from lower layer
     std::mutex NotifyCbsLock;
     std::array<std::vector<TCb>, static_cast<size_t>(ENotifyType::COUNT)> NotifyCbs;
@@ -99,6 +102,8 @@ public:
         TDbDriverState::ENotifyType type);
     void SetMetricRegistry(::NMonitoring::TMetricRegistry *sensorsRegistry);
 private:
+    static std::string GetDiscoveryCacheKey(const TStateKey& key);
+
     IInternalClient* DiscoveryClient_;
     std::unordered_map<TStateKey, std::weak_ptr<TDbDriverState>, TStateKeyHash> States_;
     std::shared_mutex Lock_;
@@ -134,10 +134,26 @@ private:
     NThreading::TPromise<bool> Promise;
 };
 
+static std::array<i64, REQUEST_PRIORITY_COUNT> GetMaxQueuedRequestsByPriority(const IConnectionsParams& params) {
+    std::array<i64, REQUEST_PRIORITY_COUNT> result;
+    for (size_t i = 0; i < REQUEST_PRIORITY_COUNT; ++i) {
+        result[i] = params.GetMaxQueuedRequests(static_cast<ERequestPriority>(i));
+    }
+    return result;
+}
+
+static TRequestPriorityWeights GetRequestPriorityWeights(const IConnectionsParams& params) {
+    TRequestPriorityWeights result;
+    for (size_t i = 0; i < REQUEST_PRIORITY_COUNT; ++i) {
+        result[i] = params.GetRequestPriorityWeight(static_cast<ERequestPriority>(i));
+    }
+    return result;
+}
+
 TGRpcConnectionsImpl::TGRpcConnectionsImpl(std::shared_ptr<IConnectionsParams> params)
     : MetricRegistryPtr_(nullptr)
     , ClientThreadsNum_(params->GetClientThreadsNum())
-    , ResponseQueue_(CreateThreadPool(ClientThreadsNum_))
+    , ResponseQueue_(CreateThreadPool(ClientThreadsNum_), GetRequestPriorityWeights(*params))
     , DefaultDiscoveryEndpoint_(params->GetEndpoint())
     , SslCredentials_(params->GetSslCredentials())
     , DefaultDatabase_(params->GetDatabase())
@@ -145,6 +161,8 @@ TGRpcConnectionsImpl::TGRpcConnectionsImpl(std::shared_ptr<IConnectionsParams> p
     , StateTracker_(this)
     , DefaultDiscoveryMode_(params->GetDiscoveryMode())
     , MaxQueuedRequests_(params->GetMaxQueuedRequests())
+    , MaxQueuedRequestsByPriority_(GetMaxQueuedRequestsByPriority(*params))
+    , RequestPriorityWeights_(GetRequestPriorityWeights(*params))
     , MaxQueuedResponses_(params->GetMaxQueuedResponses())
     , DrainOnDtors_(params->GetDrinOnDtors())
     , BalancingSettings_(params->GetBalancingSettings())
@@ -154,11 +172,16 @@ TGRpcConnectionsImpl::TGRpcConnectionsImpl(std::shared_ptr<IConnectionsParams> p
     , MaxInboundMessageSize_(params->GetMaxInboundMessageSize())
     , MaxOutboundMessageSize_(params->GetMaxOutboundMessageSize())
     , MaxMessageSize_(params->GetMaxMessageSize())
-    , QueuedRequests_(0)
+    , DiscoveryCachePath_(params->GetDiscoveryCachePath())
+    , WarmUpEndpointsCount_(params->GetWarmUpEndpointsCount())
+    , ChannelsPerEndpoint_(params->GetChannelsPerEndpoint())
+    , SeparateStreamingChannels_(params->GetSeparateStreamingChannels())
+    , CollectRequestPhases_(params->GetCollectRequestPhases())
+    , QueuedRequests_{}
     , TcpKeepAliveSettings_(params->GetTcpKeepAliveSettings())
     , SocketIdleTimeout_(params->GetSocketIdleTimeout())
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
-    , ChannelPool_(TcpKeepAliveSettings_, SocketIdleTimeout_)
+    , ChannelPool_(TcpKeepAliveSettings_, SocketIdleTimeout_, ChannelsPerEndpoint_, SeparateStreamingChannels_)
 #endif
     , NetworkThreadsNum_(params->GetNetworkThreadsNum())
     , UsePerChannelTcpConnection_(params->GetUsePerChannelTcpConnection())
@@ -181,7 +204,7 @@ TGRpcConnectionsImpl::TGRpcConnectionsImpl(std::shared_ptr<IConnectionsParams> p
     }
 #endif
     //TAdaptiveThreadPool ignores params
-    ResponseQueue_->Start(ClientThreadsNum_, MaxQueuedResponses_);
+    ResponseQueue_.Start(ClientThreadsNum_, MaxQueuedResponses_);
     if (!DefaultDatabase_.empty()) {
         DefaultState_ = StateTracker_.GetDriverState(
             DefaultDatabase_,
@@ -195,7 +218,7 @@ TGRpcConnectionsImpl::TGRpcConnectionsImpl(std::shared_ptr<IConnectionsParams> p
 
 TGRpcConnectionsImpl::~TGRpcConnectionsImpl() {
     GRpcClientLow_.Stop(true);
-    ResponseQueue_->Stop();
+    ResponseQueue_.Stop();
 }
 
 void TGRpcConnectionsImpl::AddPeriodicTask(TPeriodicCb&& cb, TDuration period) {
@@ -335,6 +358,7 @@ TAsyncListEndpointsResult TGRpcConnectionsImpl::GetEndpoints(TDbDriverStatePtr d
 
     TRpcRequestSettings rpcSettings;
     rpcSettings.ClientTimeout = GET_ENDPOINTS_TIMEOUT;
+    rpcSettings.Priority = ERequestPriority::Background;
 
     RunDeferred<Ydb::Discovery::V1::DiscoveryService, Ydb::Discovery::ListEndpointsRequest, Ydb::Discovery::ListEndpointsResponse>(
         std::move(request),
@@ -386,6 +410,59 @@ TBalancingSettings TGRpcConnectionsImpl::GetBalancingSettings() const {
     return BalancingSettings_;
 }
 
+NYdbGrpc::TGRpcClientConfig TGRpcConnectionsImpl::CreateClientConfig(const TDbDriverState& dbState) const {
+    auto clientConfig = NYdbGrpc::TGRpcClientConfig(dbState.DiscoveryEndpoint);
+    const auto& sslCredentials = dbState.SslCredentials;
+    clientConfig.SslCredentials = {.pem_root_certs = TStringType{sslCredentials.CaCert}, .pem_private_key = TStringType{sslCredentials.PrivateKey}, .pem_cert_chain = TStringType{sslCredentials.Cert}};
+    clientConfig.EnableSsl = sslCredentials.IsEnabled;
+
+    clientConfig.MemQuota = MemoryQuota_;
+
+    if (MaxMessageSize_ > 0) {
+        clientConfig.MaxMessageSize = MaxMessageSize_;
+    }
+    if (MaxInboundMessageSize_ > 0) {
+        clientConfig.MaxInboundMessageSize = MaxInboundMessageSize_;
+    }
+    if (MaxOutboundMessageSize_ > 0) {
+        clientConfig.MaxOutboundMessageSize = MaxOutboundMessageSize_;
+    }
+
+    if (UsePerChannelTcpConnection_) {
+        clientConfig.IntChannelParams[GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL] = 1;
+    }
+
+    return clientConfig;
+}
+
+void TGRpcConnectionsImpl::SetClientConfigEndpoint(NYdbGrpc::TGRpcClientConfig& clientConfig, const TEndpointRecord& endpoint) const {
+    clientConfig.Locator = endpoint.Endpoint;
+    clientConfig.SslTargetNameOverride = endpoint.SslTargetNameOverride;
+    if (GRpcKeepAliveTimeout_) {
+        SetGrpcKeepAlive(clientConfig, GRpcKeepAliveTimeout_, GRpcKeepAlivePermitWithoutCalls_);
+    }
+}
+
+#ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
+void TGRpcConnectionsImpl::WarmUpChannels(TDbDriverStatePtr dbState) {
+    if (!WarmUpEndpointsCount_ || dbState->DiscoveryMode == EDiscoveryMode::Off || dbState->Database.empty()) {
+        return;
+    }
+
+    // Channels must be created with exactly the same config as GetServiceConnection uses,
+    // the pool is keyed by endpoint only
+    for (const auto& endpoint : dbState->EndpointPool.GetBestEndpoints(WarmUpEndpointsCount_)) {
+        auto clientConfig = CreateClientConfig(*dbState);
+        SetClientConfigEndpoint(clientConfig, endpoint);
+        ChannelPool_.WarmUpChannel(clientConfig.Locator, clientConfig);
+    }
+}
+#endif
+
+std::string TGRpcConnectionsImpl::GetDiscoveryCachePath() const {
+    return DiscoveryCachePath_;
+}
+
 bool TGRpcConnectionsImpl::StartStatCollecting(NMonitoring::IMetricRegistry* sensorsRegistry) {
     {
         std::lock_guard lock(ExtensionsLock_);
@@ -409,6 +486,10 @@ NMonitoring::TMetricRegistry* TGRpcConnectionsImpl::GetMetricRegistry() {
     return MetricRegistryPtr_;
 }
 
+bool TGRpcConnectionsImpl::GetCollectRequestPhases() const {
+    return CollectRequestPhases_;
+}
+
 void TGRpcConnectionsImpl::RegisterExtension(IExtension* extension) {
     Extensions_.emplace_back(extension);
 }
@@ -426,8 +507,8 @@ const TLog& TGRpcConnectionsImpl::GetLog() const {
     return Log;
 }
 
-void TGRpcConnectionsImpl::EnqueueResponse(IObjectInQueue* action) {
-    Y_ENSURE(ResponseQueue_->Add(action));
+void TGRpcConnectionsImpl::EnqueueResponse(IObjectInQueue* action, ERequestPriority priority) {
+    Y_ENSURE(ResponseQueue_.Add(action, priority));
 }
 
 } // namespace NYdb
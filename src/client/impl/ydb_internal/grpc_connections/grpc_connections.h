@@ -79,24 +79,10 @@ public:
     template<typename TService>
     std::pair<std::unique_ptr<TServiceConnection<TService>>, TEndpointKey> GetServiceConnection(
         TDbDriverStatePtr dbState, const TEndpointKey& preferredEndpoint,
-        TRpcRequestSettings::TEndpointPolicy endpointPolicy)
+        TRpcRequestSettings::TEndpointPolicy endpointPolicy,
+        NYdbGrpc::EChannelClass channelClass = NYdbGrpc::EChannelClass::Unary)
     {
-        auto clientConfig = NYdbGrpc::TGRpcClientConfig(dbState->DiscoveryEndpoint);
-        const auto& sslCredentials = dbState->SslCredentials;
-        clientConfig.SslCredentials = {.pem_root_certs = TStringType{sslCredentials.CaCert}, .pem_private_key = TStringType{sslCredentials.PrivateKey}, .pem_cert_chain = TStringType{sslCredentials.Cert}};
-        clientConfig.EnableSsl = sslCredentials.IsEnabled;
-
-        clientConfig.MemQuota = MemoryQuota_;
-
-        if (MaxMessageSize_ > 0) {
-            clientConfig.MaxMessageSize = MaxMessageSize_;
-        }
-        if (MaxInboundMessageSize_ > 0) {
-            clientConfig.MaxInboundMessageSize = MaxInboundMessageSize_;
-        }
-        if (MaxOutboundMessageSize_ > 0) {
-            clientConfig.MaxOutboundMessageSize = MaxOutboundMessageSize_;
-        }
+        auto clientConfig = CreateClientConfig(*dbState);
 
         if (dbState->DiscoveryMode != EDiscoveryMode::Off) {
             if (std::is_same<TService,Ydb::Discovery::V1::DiscoveryService>()
@@ -109,25 +95,18 @@ public:
                 if (!endpoint) {
                     return {nullptr, TEndpointKey()};
                 }
-                clientConfig.Locator = endpoint.Endpoint;
-                clientConfig.SslTargetNameOverride = endpoint.SslTargetNameOverride;
-                if (GRpcKeepAliveTimeout_) {
-                    SetGrpcKeepAlive(clientConfig, GRpcKeepAliveTimeout_, GRpcKeepAlivePermitWithoutCalls_);
-                }
+                SetClientConfigEndpoint(clientConfig, endpoint);
             }
         }
 
-        if (UsePerChannelTcpConnection_) {
-            clientConfig.IntChannelParams[GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL] = 1;
-        }
-
         std::unique_ptr<TServiceConnection<TService>> conn;
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
         ChannelPool_.GetStubsHolderLocked(
-            clientConfig.Locator, clientConfig, [&conn, this](NYdbGrpc::TStubsHolder& holder) mutable {
+            clientConfig.Locator, channelClass, clientConfig, [&conn, this](NYdbGrpc::TStubsHolder& holder) mutable {
             conn.reset(GRpcClientLow_.CreateGRpcServiceConnection<TService>(holder).release());
         });
 #else
+        Y_UNUSED(channelClass);
         conn = std::move(GRpcClientLow_.CreateGRpcServiceConnection<TService>(clientConfig));
 #endif
         return {std::move(conn), TEndpointKey(clientConfig.Locator, 0)};
@@ -153,6 +132,12 @@ public:
             : Storage_(request)
         {}
 
+        // Request allocated on the pooled arena, the arena is kept until the request is sent
+        TRequestWrapper(TRequest* request, std::shared_ptr<google::protobuf::Arena> arena)
+            : Storage_(request)
+            , Arena_(std::move(arena))
+        {}
+
         // Copy constructor
         TRequestWrapper(const TRequestWrapper& other) = default;
         
@@ -184,6 +169,7 @@ public:
 
     private:
         std::variant<TRequest*, TRequest> Storage_;
+        std::shared_ptr<google::protobuf::Arena> Arena_;
     };
 
     template<typename TService, typename TRequest, typename TResponse>
@@ -205,24 +191,38 @@ public:
             return;
         }
 
+        std::shared_ptr<NSdkStats::TRequestPhaseTimestamps> phases;
         if (dbState->StatCollector.IsCollecting()) {
             std::weak_ptr<TDbDriverState> weakState = dbState;
             const auto startTime = TInstant::Now();
-            userResponseCb = std::move([cb = std::move(userResponseCb), weakState, startTime](TResponse* response, TPlainStatus status) {
+            if (dbState->StatCollector.IsCollectingRequestPhases()) {
+                phases = std::make_shared<NSdkStats::TRequestPhaseTimestamps>();
+                phases->Start = startTime;
+            }
+            userResponseCb = std::move([cb = std::move(userResponseCb), weakState, startTime, phases](TResponse* response, TPlainStatus status) {
                 const auto resultSize = response ? response->ByteSizeLong() : 0;
+                const auto callbackStart = phases ? TInstant::Now() : TInstant::Zero();
                 cb(response, status);
 
                 if (auto state = weakState.lock()) {
-                    state->StatCollector.IncRequestLatency(TInstant::Now() - startTime);
+                    const auto now = TInstant::Now();
+                    state->StatCollector.IncRequestLatency(now - startTime);
                     state->StatCollector.IncResultSize(resultSize);
+                    if (phases) {
+                        state->StatCollector.RecordRequestPhases(*phases, callbackStart, now);
+                    }
                 }
             });
         }
 
         WithServiceConnection<TService>(
             [this, requestWrapper = std::move(requestWrapper), userResponseCb = std::move(userResponseCb), rpc, 
-             requestSettings, context = std::move(context), dbState]
+             requestSettings, context = std::move(context), dbState, phases]
             (TPlainStatus status, TConnection serviceConnection, TEndpointKey endpoint) mutable -> void {
+                if (phases) {
+                    phases->Admitted = TInstant::Now();
+                }
+
                 if (!status.Ok()) {
                     userResponseCb(
                         nullptr,
@@ -232,6 +232,9 @@ public:
 
                 TCallMeta meta;
                 meta.Timeout = requestSettings.ClientTimeout;
+                if (requestSettings.Compress) {
+                    meta.CompressionAlgorithm = GRPC_COMPRESS_GZIP;
+                }
         #ifndef YDB_GRPC_UNSECURE_AUTH
                 meta.CallCredentials = dbState->CallCredentials;
         #else
@@ -271,9 +274,17 @@ public:
                 dbState->StatCollector.IncGRpcInFlight();
                 dbState->StatCollector.IncGRpcInFlightByHost(endpoint.GetEndpoint());
 
+                if (phases) {
+                    phases->Sent = TInstant::Now();
+                }
+
                 NYdbGrpc::TAdvancedResponseCallback<TResponse> responseCbLow =
-                    [this, context, userResponseCb = std::move(userResponseCb), endpoint, dbState]
+                    [this, context, userResponseCb = std::move(userResponseCb), endpoint, dbState,
+                     priority = requestSettings.Priority, inFlightGuard = serviceConnection->GetInFlightGuard(), phases]
                     (const grpc::ClientContext& ctx, TGrpcStatus&& grpcStatus, TResponse&& response) mutable -> void {
+                        if (phases) {
+                            phases->Received = TInstant::Now();
+                        }
                         dbState->StatCollector.DecGRpcInFlight();
                         dbState->StatCollector.DecGRpcInFlightByHost(endpoint.GetEndpoint());
 
@@ -300,7 +311,7 @@ public:
                                 endpoint.GetEndpoint(),
                                 std::move(metadata));
 
-                            EnqueueResponse(resp);
+                            EnqueueResponse(resp, priority);
                         } else {
                             dbState->StatCollector.IncReqFailDueTransportError();
                             dbState->StatCollector.IncTransportErrorsByHost(endpoint.GetEndpoint());
@@ -314,12 +325,12 @@ public:
 
                             dbState->EndpointPool.BanEndpoint(endpoint.GetEndpoint());
 
-                            EnqueueResponse(resp);
+                            EnqueueResponse(resp, priority);
                         }
                     };
 
                 requestWrapper.DoRequest(serviceConnection, std::move(responseCbLow), rpc, meta, context.get());
-            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy);
+            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy, requestSettings.Priority);
     }
 
     template<typename TService, typename TRequest, typename TResponse>
@@ -498,14 +509,16 @@ public:
                 dbState->StatCollector.IncGRpcInFlight();
                 dbState->StatCollector.IncGRpcInFlightByHost(endpoint.GetEndpoint());
 
-                auto lowCallback = [responseCb = std::move(responseCb), dbState, endpoint]
+                auto lowCallback = [responseCb = std::move(responseCb), dbState, endpoint,
+                                    inFlightGuard = serviceConnection->GetInFlightGuard()]
                     (TGrpcStatus grpcStatus, TProcessor processor) mutable {
                         dbState->StatCollector.DecGRpcInFlight();
                         dbState->StatCollector.DecGRpcInFlightByHost(endpoint.GetEndpoint());
 
                         if (grpcStatus.Ok()) {
                             Y_ABORT_UNLESS(processor);
-                            auto finishedCallback = [dbState, endpoint] (TGrpcStatus grpcStatus) {
+                            // The stream stays outstanding on its channel until it is finished
+                            auto finishedCallback = [dbState, endpoint, inFlightGuard] (TGrpcStatus grpcStatus) {
                                 if (!grpcStatus.Ok() && grpcStatus.GRpcStatusCode != grpc::StatusCode::CANCELLED) {
                                     dbState->EndpointPool.BanEndpoint(endpoint.GetEndpoint());
                                 }
@@ -530,7 +543,8 @@ public:
                     std::move(rpc),
                     std::move(meta),
                     context.get());
-            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy);
+            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy, requestSettings.Priority,
+                NYdbGrpc::EChannelClass::Streaming);
     }
 
     template<class TService, class TRequest, class TResponse, class TCallback>
@@ -597,14 +611,16 @@ public:
                 dbState->StatCollector.IncGRpcInFlight();
                 dbState->StatCollector.IncGRpcInFlightByHost(endpoint.GetEndpoint());
 
-                auto lowCallback = [connectedCallback = std::move(connectedCallback), dbState, endpoint]
+                auto lowCallback = [connectedCallback = std::move(connectedCallback), dbState, endpoint,
+                                    inFlightGuard = serviceConnection->GetInFlightGuard()]
                     (TGrpcStatus grpcStatus, TProcessor processor) {
                         dbState->StatCollector.DecGRpcInFlight();
                         dbState->StatCollector.DecGRpcInFlightByHost(endpoint.GetEndpoint());
 
                         if (grpcStatus.Ok()) {
                             Y_ABORT_UNLESS(processor);
-                            auto finishedCallback = [dbState, endpoint] (TGrpcStatus grpcStatus) {
+                            // The stream stays outstanding on its channel until it is finished
+                            auto finishedCallback = [dbState, endpoint, inFlightGuard] (TGrpcStatus grpcStatus) {
                                 if (!grpcStatus.Ok() && grpcStatus.GRpcStatusCode != grpc::StatusCode::CANCELLED) {
                                     dbState->EndpointPool.BanEndpoint(endpoint.GetEndpoint());
                                 }
@@ -628,7 +644,8 @@ public:
                     std::move(rpc),
                     std::move(meta),
                     context.get());
-            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy);
+            }, dbState, requestSettings.PreferredEndpoint, requestSettings.EndpointPolicy, requestSettings.Priority,
+                NYdbGrpc::EChannelClass::Streaming);
     }
 
     TAsyncListEndpointsResult GetEndpoints(TDbDriverStatePtr dbState) override;
@@ -640,26 +657,33 @@ public:
             ChannelPool_.DeleteChannel(endpoint);
         }
     }
+    void WarmUpChannels(std::shared_ptr<TDbDriverState> dbState) override;
 #endif
 
     bool GetDrainOnDtors() const;
     TBalancingSettings GetBalancingSettings() const override;
+    std::string GetDiscoveryCachePath() const override;
     bool StartStatCollecting(::NMonitoring::IMetricRegistry* sensorsRegistry) override;
     ::NMonitoring::TMetricRegistry* GetMetricRegistry() override;
+    bool GetCollectRequestPhases() const override;
     void RegisterExtension(IExtension* extension);
     void RegisterExtensionApi(IExtensionApi* api);
     void SetDiscoveryMutator(IDiscoveryMutatorApi::TMutatorCb&& cb);
     const TLog& GetLog() const override;
 
 private:
+    NYdbGrpc::TGRpcClientConfig CreateClientConfig(const TDbDriverState& dbState) const;
+    void SetClientConfigEndpoint(NYdbGrpc::TGRpcClientConfig& clientConfig, const TEndpointRecord& endpoint) const;
+
     template <typename TService, typename TCallback>
     void WithServiceConnection(TCallback callback, TDbDriverStatePtr dbState,
-        const TEndpointKey& preferredEndpoint, TRpcRequestSettings::TEndpointPolicy endpointPolicy)
+        const TEndpointKey& preferredEndpoint, TRpcRequestSettings::TEndpointPolicy endpointPolicy,
+        ERequestPriority priority, NYdbGrpc::EChannelClass channelClass = NYdbGrpc::EChannelClass::Unary)
     {
         using TConnection = std::unique_ptr<TServiceConnection<TService>>;
         TConnection serviceConnection;
         TEndpointKey endpoint;
-        std::tie(serviceConnection, endpoint) = GetServiceConnection<TService>(dbState, preferredEndpoint, endpointPolicy);
+        std::tie(serviceConnection, endpoint) = GetServiceConnection<TService>(dbState, preferredEndpoint, endpointPolicy, channelClass);
         if (!serviceConnection) {
             if (dbState->DiscoveryMode == EDiscoveryMode::Off) {
                 TStringStream errString;
@@ -695,11 +719,15 @@ private:
                     TConnection{nullptr},
                     TEndpointKey{ });
             } else {
+                // Every priority class has its own limit, so background requests
+                // can't take all the queue while discovery is in progress
+                auto& queuedRequests = QueuedRequests_[static_cast<size_t>(priority)];
+                const int64_t maxQueuedRequests = MaxQueuedRequestsByPriority_[static_cast<size_t>(priority)];
                 int64_t newVal;
                 int64_t val;
                 do {
-                    val = QueuedRequests_.load();
-                    if (val >= MaxQueuedRequests_) {
+                    val = queuedRequests.load();
+                    if (val >= maxQueuedRequests) {
                         dbState->StatCollector.IncReqFailQueueOverflow();
                         callback(
                             TPlainStatus(EStatus::CLIENT_LIMITS_REACHED, "Requests queue limit reached"),
@@ -708,14 +736,14 @@ private:
                         return;
                     }
                     newVal = val + 1;
-                } while (!QueuedRequests_.compare_exchange_weak(val, newVal));
+                } while (!queuedRequests.compare_exchange_weak(val, newVal));
 
                 // UpdateAsync guarantee one update in progress for state
                 auto asyncResult = dbState->EndpointPool.UpdateAsync();
                 const bool needUpdateChannels = asyncResult.second;
-                asyncResult.first.Subscribe([this, callback = std::move(callback), needUpdateChannels, dbState, preferredEndpoint, endpointPolicy]
+                asyncResult.first.Subscribe([this, callback = std::move(callback), needUpdateChannels, dbState, preferredEndpoint, endpointPolicy, priority, channelClass, &queuedRequests]
                     (const NThreading::TFuture<TEndpointUpdateResult>& future) mutable {
-                    --QueuedRequests_;
+                    --queuedRequests;
                     const auto& updateResult = future.GetValue();
                     if (needUpdateChannels) {
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
@@ -724,7 +752,7 @@ private:
                     }
                     auto discoveryStatus = updateResult.DiscoveryStatus;
                     if (discoveryStatus.Status == EStatus::SUCCESS) {
-                        WithServiceConnection<TService>(std::move(callback), dbState, preferredEndpoint, endpointPolicy);
+                        WithServiceConnection<TService>(std::move(callback), dbState, preferredEndpoint, endpointPolicy, priority, channelClass);
                     } else {
                         callback(
                             TPlainStatus(discoveryStatus.Status, std::move(discoveryStatus.Issues)),
@@ -742,14 +770,14 @@ private:
             std::move(endpoint));
     }
 
-    void EnqueueResponse(IObjectInQueue* action);
+    void EnqueueResponse(IObjectInQueue* action, ERequestPriority priority = ERequestPriority::Interactive);
 
 private:
     std::mutex ExtensionsLock_;
     ::NMonitoring::TMetricRegistry* MetricRegistryPtr_ = nullptr;
 
     const size_t ClientThreadsNum_;
-    std::unique_ptr<IThreadPool> ResponseQueue_;
+    TPriorityThreadPool ResponseQueue_;
 
     const std::string DefaultDiscoveryEndpoint_;
     const TSslCredentials SslCredentials_;
@@ -758,6 +786,8 @@ private:
     TDbDriverStateTracker StateTracker_;
     const EDiscoveryMode DefaultDiscoveryMode_;
     const i64 MaxQueuedRequests_;
+    const std::array<i64, REQUEST_PRIORITY_COUNT> MaxQueuedRequestsByPriority_;
+    const TRequestPriorityWeights RequestPriorityWeights_;
     const i64 MaxQueuedResponses_;
     const bool DrainOnDtors_;
     const TBalancingSettings BalancingSettings_;
@@ -767,8 +797,13 @@ private:
     const ui64 MaxInboundMessageSize_;
     const ui64 MaxOutboundMessageSize_;
     const ui64 MaxMessageSize_;
+    const std::string DiscoveryCachePath_;
+    const size_t WarmUpEndpointsCount_;
+    const size_t ChannelsPerEndpoint_;
+    const bool SeparateStreamingChannels_;
+    const bool CollectRequestPhases_;
 
-    std::atomic_int64_t QueuedRequests_;
+    std::array<std::atomic_int64_t, REQUEST_PRIORITY_COUNT> QueuedRequests_;
     const NYdbGrpc::TTcpKeepAliveSettings TcpKeepAliveSettings_;
     const TDuration SocketIdleTimeout_;
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
@@ -6,6 +6,7 @@
 #include <src/client/impl/ydb_internal/common/types.h>
 #include <ydb-cpp-sdk/client/common_client/ssl_credentials.h>
 #include <ydb-cpp-sdk/client/types/credentials/credentials.h>
+#include <ydb-cpp-sdk/client/types/request_settings.h>
 
 namespace NYdb::inline V3 {
 
@@ -22,6 +23,8 @@ public:
     virtual std::shared_ptr<ICredentialsProviderFactory> GetCredentialsProviderFactory() const = 0;
     virtual EDiscoveryMode GetDiscoveryMode() const = 0;
     virtual size_t GetMaxQueuedRequests() const = 0;
+    virtual size_t GetMaxQueuedRequests(ERequestPriority priority) const = 0;
+    virtual uint32_t GetRequestPriorityWeight(ERequestPriority priority) const = 0;
     virtual NYdbGrpc::TTcpKeepAliveSettings GetTcpKeepAliveSettings() const = 0;
     virtual bool GetDrinOnDtors() const = 0;
     virtual TBalancingSettings GetBalancingSettings() const = 0;
@@ -33,6 +36,11 @@ public:
     virtual uint64_t GetMaxInboundMessageSize() const = 0;
     virtual uint64_t GetMaxOutboundMessageSize() const = 0;
     virtual uint64_t GetMaxMessageSize() const = 0;
+    virtual std::string GetDiscoveryCachePath() const = 0;
+    virtual size_t GetWarmUpEndpointsCount() const = 0;
+    virtual size_t GetChannelsPerEndpoint() const = 0;
+    virtual bool GetSeparateStreamingChannels() const = 0;
+    virtual bool GetCollectRequestPhases() const = 0;
 };
 
 } // namespace NYdb
@@ -25,10 +25,13 @@ public:
     virtual void AddPeriodicTask(TPeriodicCb&& cb, TDuration period) = 0;
 #ifndef YDB_GRPC_BYPASS_CHANNEL_POOL
     virtual void DeleteChannels(const std::vector<std::string>& endpoints) = 0;
+    virtual void WarmUpChannels(std::shared_ptr<TDbDriverState> dbState) = 0;
 #endif
     virtual TBalancingSettings GetBalancingSettings() const = 0;
+    virtual std::string GetDiscoveryCachePath() const = 0;
     virtual bool StartStatCollecting(::NMonitoring::IMetricRegistry* sensorsRegistry) = 0;
     virtual ::NMonitoring::TMetricRegistry* GetMetricRegistry() = 0;
+    virtual bool GetCollectRequestPhases() const = 0;
     virtual const TLog& GetLog() const = 0;
 };
 
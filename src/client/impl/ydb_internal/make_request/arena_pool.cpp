@@ -0,0 +1,84 @@
+#define INCLUDE_YDB_INTERNAL_H
+#include "arena_pool.h"
+
+#include <mutex>
+#include <vector>
+
+namespace NYdb::inline V3 {
+
+namespace {
+
+struct TPooledArena {
+    TPooledArena()
+        : InitialBlock(new char[TArenaPool::INITIAL_BLOCK_SIZE])
+        , Arena(MakeOptions(InitialBlock.get()))
+    { }
+
+    static google::protobuf::ArenaOptions MakeOptions(char* initialBlock) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = initialBlock;
+        options.initial_block_size = TArenaPool::INITIAL_BLOCK_SIZE;
+        return options;
+    }
+
+    std::unique_ptr<char[]> InitialBlock;
+    google::protobuf::Arena Arena;
+};
+
+class TFreeList {
+public:
+    TFreeList() {
+        Free_.reserve(TArenaPool::MAX_FREE_ARENAS);
+    }
+
+    std::unique_ptr<TPooledArena> Pop() {
+        {
+            std::lock_guard lock(Lock_);
+            if (!Free_.empty()) {
+                auto arena = std::move(Free_.back());
+                Free_.pop_back();
+                return arena;
+            }
+        }
+        return std::make_unique<TPooledArena>();
+    }
+
+    void Push(std::unique_ptr<TPooledArena> arena) {
+        arena->Arena.Reset();
+        std::lock_guard lock(Lock_);
+        if (Free_.size() < TArenaPool::MAX_FREE_ARENAS) {
+            Free_.push_back(std::move(arena));
+        }
+    }
+
+    size_t Size() const {
+        std::lock_guard lock(Lock_);
+        return Free_.size();
+    }
+
+private:
+    mutable std::mutex Lock_;
+    std::vector<std::unique_ptr<TPooledArena>> Free_;
+};
+
+// Never destroyed, arenas may be released by static and thread_local objects at exit
+TFreeList& GetFreeList() {
+    static TFreeList* list = new TFreeList();
+    return *list;
+}
+
+} // namespace
+
+std::shared_ptr<google::protobuf::Arena> TArenaPool::Acquire() {
+    auto pooled = GetFreeList().Pop();
+    auto* arena = &pooled->Arena;
+    return std::shared_ptr<google::protobuf::Arena>(arena, [pooled = pooled.release()](google::protobuf::Arena*) {
+        GetFreeList().Push(std::unique_ptr<TPooledArena>(pooled));
+    });
+}
+
+size_t TArenaPool::GetFreeCount() {
+    return GetFreeList().Size();
+}
+
+} // namespace NYdb
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <src/client/impl/ydb_internal/internal_header.h>
+
+#include <google/protobuf/arena.h>
+
+#include <memory>
+
+namespace NYdb::inline V3 {
+
+// Process-wide pool of protobuf arenas for hot request and response messages.
+// Arenas are usually acquired on one thread and released on another: requests
+// are built by the user thread and dropped by the gRPC completion thread, results
+// are parsed by the response thread and dropped by the user thread. So the free
+// arenas are kept in one list shared by all threads, the last owner resets an
+// arena and gives it back to the list. Every pooled arena keeps its initial block
+// between uses, so small messages are built and parsed without touching the heap at all.
+class TArenaPool {
+public:
+    // Size of the initial block of every pooled arena
+    static constexpr size_t INITIAL_BLOCK_SIZE = 16 * 1024;
+    // Max number of free arenas kept by the pool
+    static constexpr size_t MAX_FREE_ARENAS = 64;
+
+    static std::shared_ptr<google::protobuf::Arena> Acquire();
+
+    // Number of free arenas in the pool
+    static size_t GetFreeCount();
+};
+
+} // namespace NYdb
@@ -36,6 +36,8 @@ protected:
     TRetryOperationSettings Settings_;
     ui32 RetryNumber_;
     TInstant RetryStartTime_;
+    // Decision of the retry budget on the last failure
+    ERetryDecision RetryDecision_ = ERetryDecision::Allow;
 
 protected:
     TRetryContextBase(const TRetryOperationSettings& settings)
@@ -54,7 +56,35 @@ protected:
         }
     }
 
+    void LogRetryRejected(const TStatus& status) {
+        if (Settings_.Verbose_) {
+            std::cerr << "Query attempt was finished with unsuccessful status "
+                << ToString(status.GetStatus()) << ", retry is rejected: "
+                << (RetryDecision_ == ERetryDecision::CircuitOpen ? "circuit breaker is open" : "retry budget is exhausted")
+                << std::endl;
+        }
+    }
+
     NextStep GetNextStep(const TStatus& status) {
+        const NextStep nextStep = GetRetryStep(status);
+        RetryDecision_ = ERetryDecision::Allow;
+        if (!Settings_.RetryBudget_) {
+            return nextStep;
+        }
+        if (status.IsSuccess()) {
+            Settings_.RetryBudget_->OnSuccess(status.GetEndpoint());
+        } else if (nextStep != NextStep::Finish) {
+            RetryDecision_ = Settings_.RetryBudget_->OnFailure(status.GetEndpoint(), status.GetStatus());
+            if (RetryDecision_ != ERetryDecision::Allow) {
+                LogRetryRejected(status);
+                return NextStep::Finish;
+            }
+        }
+        return nextStep;
+    }
+
+private:
+    NextStep GetRetryStep(const TStatus& status) {
         if (status.IsSuccess()) {
             return NextStep::Finish;
         }
@@ -107,6 +137,7 @@ protected:
         }
     }
 
+protected:
     TDuration GetRemainingTimeout() {
         return Settings_.MaxTimeout_ - (TInstant::Now() - RetryStartTime_);
     }
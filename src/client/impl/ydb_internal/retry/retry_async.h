@@ -55,6 +55,8 @@ protected:
             self->RetryNumber_++;
             self->Client_.Impl_->CollectRetryStatAsync(status.GetStatus());
             self->LogRetry(status);
+        } else if (self->RetryDecision_ != ERetryDecision::Allow) {
+            self->Client_.Impl_->CollectRetryRejectedStat(self->RetryDecision_);
         }
         switch (nextStep) {
             case NextStep::RetryImmediately:
@@ -0,0 +1,148 @@
+#include <ydb-cpp-sdk/client/retry/retry.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace NYdb::inline V3::NRetry {
+
+class TRetryBudget::TImpl {
+    struct TCircuitBreaker {
+        uint32_t ConsecutiveFailures = 0;
+        TInstant OpenUntil;
+        bool HalfOpen = false;
+        TInstant LastFailure;
+    };
+
+    using TEndpointBreakers = std::unordered_map<EStatus, TCircuitBreaker>;
+
+public:
+    explicit TImpl(const TRetryBudgetSettings& settings)
+        : Settings_(settings)
+        , Tokens_(settings.MaxTokens_)
+        , LastRefill_(TInstant::Now())
+        , LastPrune_(LastRefill_)
+    {}
+
+    void OnSuccess(const std::string& endpoint) {
+        std::lock_guard guard(Lock_);
+        Tokens_ = std::min(Settings_.MaxTokens_, Tokens_ + Settings_.RetryRatio_);
+        if (!Breakers_.empty()) {
+            Breakers_.erase(endpoint);
+        }
+    }
+
+    ERetryDecision OnFailure(const std::string& endpoint, EStatus status) {
+        const TInstant now = TInstant::Now();
+
+        std::lock_guard guard(Lock_);
+        if (Settings_.CircuitBreakerThreshold_ > 0) {
+            PruneIdleBreakers(now);
+            if (IsCircuitOpen(Breakers_[endpoint][status], now)) {
+                return ERetryDecision::CircuitOpen;
+            }
+        }
+        return TakeToken(now);
+    }
+
+    ERetryDecision TakeRetry() {
+        const TInstant now = TInstant::Now();
+
+        std::lock_guard guard(Lock_);
+        return TakeToken(now);
+    }
+
+    double GetAvailableTokens() const {
+        std::lock_guard guard(Lock_);
+        return Tokens_;
+    }
+
+private:
+    ERetryDecision TakeToken(TInstant now) {
+        Refill(now);
+        if (Tokens_ < 1.0) {
+            return ERetryDecision::BudgetExhausted;
+        }
+        Tokens_ -= 1.0;
+        return ERetryDecision::Allow;
+    }
+
+    // Accounts one more failure, returns true if it must not be retried.
+    bool IsCircuitOpen(TCircuitBreaker& breaker, TInstant now) {
+        breaker.LastFailure = now;
+        if (now < breaker.OpenUntil) {
+            return true;
+        }
+        if (breaker.OpenUntil) {
+            // Open period is over, next failure opens circuit again
+            breaker.OpenUntil = TInstant::Zero();
+            breaker.HalfOpen = true;
+            return false;
+        }
+        if (breaker.HalfOpen || ++breaker.ConsecutiveFailures >= Settings_.CircuitBreakerThreshold_) {
+            breaker.ConsecutiveFailures = 0;
+            breaker.HalfOpen = false;
+            breaker.OpenUntil = now + Settings_.CircuitBreakerOpenDuration_;
+            return true;
+        }
+        return false;
+    }
+
+    // Breakers without failures for the open duration are closed, endpoints come and go,
+    // so they are forgotten once in a while instead of piling up
+    void PruneIdleBreakers(TInstant now) {
+        const TDuration idle = Settings_.CircuitBreakerOpenDuration_;
+        if (now - LastPrune_ < idle) {
+            return;
+        }
+        LastPrune_ = now;
+
+        for (auto it = Breakers_.begin(); it != Breakers_.end();) {
+            auto& breakers = it->second;
+            std::erase_if(breakers, [now, idle](const auto& kv) {
+                return now - std::max(kv.second.LastFailure, kv.second.OpenUntil) >= idle;
+            });
+            it = breakers.empty() ? Breakers_.erase(it) : std::next(it);
+        }
+    }
+
+    void Refill(TInstant now) {
+        if (now > LastRefill_) {
+            Tokens_ = std::min(Settings_.MaxTokens_, Tokens_ + (now - LastRefill_).SecondsFloat() * Settings_.MinRetriesPerSecond_);
+            LastRefill_ = now;
+        }
+    }
+
+private:
+    const TRetryBudgetSettings Settings_;
+
+    mutable std::mutex Lock_;
+    double Tokens_;
+    TInstant LastRefill_;
+    TInstant LastPrune_;
+    std::unordered_map<std::string, TEndpointBreakers> Breakers_;
+};
+
+TRetryBudget::TRetryBudget(const TRetryBudgetSettings& settings)
+    : Impl_(std::make_unique<TImpl>(settings))
+{}
+
+TRetryBudget::~TRetryBudget() = default;
+
+void TRetryBudget::OnSuccess(const std::string& endpoint) {
+    Impl_->OnSuccess(endpoint);
+}
+
+ERetryDecision TRetryBudget::OnFailure(const std::string& endpoint, EStatus status) {
+    return Impl_->OnFailure(endpoint, status);
+}
+
+ERetryDecision TRetryBudget::TakeRetry() {
+    return Impl_->TakeRetry();
+}
+
+double TRetryBudget::GetAvailableTokens() const {
+    return Impl_->GetAvailableTokens();
+}
+
+} // namespace NYdb::NRetry
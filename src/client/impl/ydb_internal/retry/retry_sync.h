@@ -27,6 +27,9 @@ public:
                     DoBackoff(false);
                     break;
                 case NextStep::Finish:
+                    if (this->RetryDecision_ != ERetryDecision::Allow) {
+                        this->Client_.Impl_->CollectRetryRejectedStat(this->RetryDecision_);
+                    }
                     return status;
             }
             // make next retry
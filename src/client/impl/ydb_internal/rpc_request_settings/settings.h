@@ -3,6 +3,8 @@
 #include <src/client/impl/ydb_endpoints/endpoints.h>
 #include <src/client/impl/ydb_internal/internal_header.h>
 
+#include <ydb-cpp-sdk/client/types/request_settings.h>
+
 namespace NYdb::inline V3 {
 
 struct TRpcRequestSettings {
@@ -17,6 +19,9 @@ struct TRpcRequestSettings {
     } EndpointPolicy = TEndpointPolicy::UsePreferredEndpointOptionally;
     bool UseAuth = true;
     TDuration ClientTimeout;
+    ERequestPriority Priority = ERequestPriority::Interactive;
+    // Compress the request message with gzip
+    bool Compress = false;
 
     template <typename TRequestSettings>
     static TRpcRequestSettings Make(const TRequestSettings& settings, const TEndpointKey& preferredEndpoint = {}, TEndpointPolicy endpointPolicy = TEndpointPolicy::UsePreferredEndpointOptionally) {
@@ -33,6 +38,7 @@ struct TRpcRequestSettings {
         rpcSettings.EndpointPolicy = endpointPolicy;
         rpcSettings.UseAuth = true;
         rpcSettings.ClientTimeout = settings.ClientTimeout_;
+        rpcSettings.Priority = settings.Priority_;
         return rpcSettings;
     }
 };
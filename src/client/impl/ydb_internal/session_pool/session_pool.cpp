@@ -374,6 +374,7 @@ void TSessionPool::SetStatCollector(NSdkStats::TStatCollector::TSessionPoolStatC
     InPoolSessionsCounter_.Set(statCollector.InPoolSessions);
     FakeSessionsCounter_.Set(statCollector.FakeSessions);
     SessionWaiterCounter_.Set(statCollector.Waiters);
+    AcquireLatency_.Set(statCollector.AcquireLatency);
 }
 
 void TSessionPool::UpdateStats() {
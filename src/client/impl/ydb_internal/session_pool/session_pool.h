@@ -3,6 +3,10 @@
 #include <src/client/impl/ydb_internal/kqp_session_common/kqp_session_common.h>
 #include <src/client/types/core_facility/core_facility.h>
 
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 
 namespace NYdb::inline V3 {
 
@@ -30,6 +34,25 @@ TStatus GetStatus(const TStatus& status);
 TDuration RandomizeThreshold(TDuration duration);
 bool IsSessionCloseRequested(const TStatus& status);
 
+// Creates count sessions with getSession() and returns them to the pool.
+// Sessions are held until all of them are created, otherwise the pool
+// would hand out the same idle session again
+template <typename TGetSession>
+void WarmUpSessions(ui32 count, TGetSession&& getSession) {
+    if (!count) {
+        return;
+    }
+
+    auto sessions = std::make_shared<std::vector<std::invoke_result_t<TGetSession&>>>();
+    sessions->reserve(count);
+    for (ui32 i = 0; i < count; ++i) {
+        sessions->push_back(getSession());
+    }
+    NThreading::WaitAll(*sessions).Subscribe([sessions](const NThreading::TFuture<void>&) {
+        sessions->clear();
+    });
+}
+
 template<typename TResponse>
 NThreading::TFuture<TResponse> InjectSessionStatusInterception(
         std::shared_ptr<::NYdb::TKqpSessionCommon> impl, NThreading::TFuture<TResponse> asyncResponse,
@@ -125,6 +148,17 @@ public:
     void Drain(std::function<bool(std::unique_ptr<TKqpSessionCommon>&&)> cb, bool close);
     void SetStatCollector(NSdkStats::TStatCollector::TSessionPoolStatCollector collector);
 
+    // Records time until the future of a GetSession call is set, if session acquisition is measured
+    template <typename TFuture>
+    void RecordAcquireLatency(const TFuture& future) {
+        if (!AcquireLatency_.IsCollecting()) {
+            return;
+        }
+        future.Subscribe([histogram = AcquireLatency_.Get(), start = TInstant::Now()](const TFuture&) {
+            histogram->Record((TInstant::Now() - start).MicroSeconds());
+        });
+    }
+
     void OnCloseSession(const TKqpSessionCommon*, std::shared_ptr<ISessionClient> client) override;
 
 private:
@@ -143,6 +177,7 @@ private:
     NSdkStats::TSessionCounter InPoolSessionsCounter_;
     NSdkStats::TSessionCounter SessionWaiterCounter_;
     NSdkStats::TAtomicCounter<::NMonitoring::TRate> FakeSessionsCounter_;
+    NSdkStats::TAtomicHistogram<::NMonitoring::THistogram> AcquireLatency_;
 };
 
 }
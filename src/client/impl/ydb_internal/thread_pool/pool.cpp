@@ -1,2 +1,127 @@
 #define INCLUDE_YDB_INTERNAL_H
 #include "pool.h"
+
+#include <algorithm>
+
+namespace NYdb::inline V3 {
+
+TPriorityThreadPool::TPriorityThreadPool(std::unique_ptr<IThreadPool> pool, const TRequestPriorityWeights& weights)
+    : Pool_(std::move(pool))
+    , Weights_(weights)
+    , DrainTask_(this)
+{ }
+
+void TPriorityThreadPool::Start(size_t threads, size_t maxQueued) {
+    Pool_->Start(threads, maxQueued);
+}
+
+void TPriorityThreadPool::Stop() {
+    Pool_->Stop();
+
+    // Objects whose drain task was not accepted by the stopped pool
+    for (;;) {
+        IObjectInQueue* obj;
+        {
+            std::lock_guard lock(Lock_);
+            obj = PopNext();
+        }
+        if (!obj) {
+            break;
+        }
+        obj->Process(nullptr);
+    }
+}
+
+bool TPriorityThreadPool::Add(IObjectInQueue* obj, ERequestPriority priority) {
+    auto& queue = Queues_[static_cast<size_t>(priority)];
+    {
+        std::lock_guard lock(Lock_);
+        queue.push_back(obj);
+        ++Queued_;
+        ++Posted_;
+    }
+
+    if (Pool_->Add(&DrainTask_)) {
+        return true;
+    }
+
+    IObjectInQueue* stranded = nullptr;
+    {
+        std::lock_guard lock(Lock_);
+        --Posted_;
+        auto it = std::find(queue.begin(), queue.end(), obj);
+        if (it != queue.end()) {
+            queue.erase(it);
+            --Queued_;
+            return false;
+        }
+        // Already taken by the drain task of another object, which is left without one.
+        // Running drain tasks take it before they finish, with none it is processed here.
+        if (!ActiveDrains_ && Queued_ > Posted_) {
+            stranded = PopNext();
+        }
+    }
+    if (stranded) {
+        stranded->Process(nullptr);
+    }
+    return true;
+}
+
+size_t TPriorityThreadPool::Size(ERequestPriority priority) const {
+    std::lock_guard lock(Lock_);
+    return Queues_[static_cast<size_t>(priority)].size();
+}
+
+void TPriorityThreadPool::ProcessNext() {
+    IObjectInQueue* obj;
+    {
+        std::lock_guard lock(Lock_);
+        --Posted_;
+        ++ActiveDrains_;
+        obj = PopNext();
+    }
+
+    for (;;) {
+        if (obj) {
+            obj->Process(nullptr);
+        }
+
+        std::lock_guard lock(Lock_);
+        // Objects without a drain task of their own
+        obj = Queued_ > Posted_ ? PopNext() : nullptr;
+        if (!obj) {
+            --ActiveDrains_;
+            return;
+        }
+    }
+}
+
+IObjectInQueue* TPriorityThreadPool::PopNext() {
+    // Smooth weighted round-robin over non-empty queues
+    i64 total = 0;
+    size_t best = REQUEST_PRIORITY_COUNT;
+    for (size_t i = 0; i < REQUEST_PRIORITY_COUNT; ++i) {
+        if (Queues_[i].empty()) {
+            Current_[i] = 0;
+            continue;
+        }
+        const i64 weight = std::max<ui32>(Weights_[i], 1);
+        Current_[i] += weight;
+        total += weight;
+        if (best == REQUEST_PRIORITY_COUNT || Current_[i] > Current_[best]) {
+            best = i;
+        }
+    }
+
+    if (best == REQUEST_PRIORITY_COUNT) {
+        return nullptr;
+    }
+
+    Current_[best] -= total;
+    auto* obj = Queues_[best].front();
+    Queues_[best].pop_front();
+    --Queued_;
+    return obj;
+}
+
+} // namespace NYdb
@@ -2,9 +2,14 @@
 
 #include <src/client/impl/ydb_internal/internal_header.h>
 
+#include <ydb-cpp-sdk/client/types/request_settings.h>
+
 #include <util/thread/pool.h>
 
+#include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
 
 namespace NYdb::inline V3 {
 
@@ -18,4 +23,60 @@ inline std::unique_ptr<IThreadPool> CreateThreadPool(size_t threads) {
     return queue;
 }
 
+constexpr size_t REQUEST_PRIORITY_COUNT = 3;
+
+using TRequestPriorityWeights = std::array<ui32, REQUEST_PRIORITY_COUNT>;
+
+// Thread pool front-end with weighted-fair dispatch between priority classes.
+// Every Add puts the object into the queue of its class and schedules one
+// drain task to the underlying pool. The drain task picks the class to serve
+// by smooth weighted round-robin, so with weights {8, 2, 1} and all queues busy
+// interactive objects are processed 8 times as often as background ones,
+// and no class waits forever.
+// A drain task may take the object of a drain task the pool has rejected, the object
+// left without a task is then taken by a running drain task or by the rejected Add.
+class TPriorityThreadPool {
+public:
+    TPriorityThreadPool(std::unique_ptr<IThreadPool> pool, const TRequestPriorityWeights& weights);
+
+    void Start(size_t threads, size_t maxQueued);
+    void Stop();
+
+    bool Add(IObjectInQueue* obj, ERequestPriority priority);
+
+    size_t Size(ERequestPriority priority) const;
+
+private:
+    class TDrainTask : public IObjectInQueue {
+    public:
+        explicit TDrainTask(TPriorityThreadPool* owner)
+            : Owner_(owner)
+        { }
+
+        void Process(void*) override {
+            Owner_->ProcessNext();
+        }
+
+    private:
+        TPriorityThreadPool* Owner_;
+    };
+
+    void ProcessNext();
+    // Called under Lock_
+    IObjectInQueue* PopNext();
+
+private:
+    std::unique_ptr<IThreadPool> Pool_;
+    const TRequestPriorityWeights Weights_;
+    TDrainTask DrainTask_;
+
+    mutable std::mutex Lock_;
+    std::array<std::deque<IObjectInQueue*>, REQUEST_PRIORITY_COUNT> Queues_;
+    std::array<i64, REQUEST_PRIORITY_COUNT> Current_ = {};
+    // Objects in all queues, drain tasks added to the pool and not started yet, running drain tasks
+    size_t Queued_ = 0;
+    size_t Posted_ = 0;
+    size_t ActiveDrains_ = 0;
+};
+
 } // namespace NYdb
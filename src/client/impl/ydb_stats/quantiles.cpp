@@ -0,0 +1,92 @@
+#include "quantiles.h"
+
+#include <memory>
+
+namespace NYdb::inline V3 {
+namespace NSdkStats {
+
+namespace {
+
+const std::vector<std::pair<double, std::string>> EXPORTED_QUANTILES = {
+    {0.5, "0.5"},
+    {0.99, "0.99"},
+    {0.999, "0.999"},
+};
+
+} // namespace
+
+double GetHistogramQuantile(const std::vector<::NMonitoring::TBucketBound>& bounds,
+    const std::vector<::NMonitoring::TBucketValue>& values, double quantile)
+{
+    ::NMonitoring::TBucketValue total = 0;
+    for (auto value : values) {
+        total += value;
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    const double rank = quantile * total;
+    ::NMonitoring::TBucketValue seen = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i] == 0 || seen + values[i] < rank) {
+            seen += values[i];
+            continue;
+        }
+
+        const double lower = i == 0 ? 0 : bounds[i - 1];
+        if (bounds[i] == ::NMonitoring::HISTOGRAM_INF_BOUND) {
+            return lower;
+        }
+        return lower + (bounds[i] - lower) * (rank - seen) / values[i];
+    }
+    return bounds.size() > 1 ? bounds[bounds.size() - 2] : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TWindowedQuantiles::TWindowedQuantiles(::NMonitoring::THistogram* histogram)
+    : Histogram_(histogram)
+{}
+
+double TWindowedQuantiles::Get(double quantile, TInstant now) {
+    std::lock_guard guard(Lock_);
+    if (now - LastRefresh_ >= RefreshInterval) {
+        LastRefresh_ = now;
+        Refresh();
+    }
+    return GetHistogramQuantile(Bounds_, Window_, quantile);
+}
+
+void TWindowedQuantiles::Refresh() {
+    auto snapshot = Histogram_->TakeSnapshot();
+    const size_t count = snapshot->Count();
+
+    Bounds_.resize(count);
+    Previous_.resize(count, 0);
+    Window_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        Bounds_[i] = snapshot->UpperBound(i);
+        const auto value = snapshot->Value(i);
+        // The histogram could have been reset in the meantime
+        Window_[i] = value >= Previous_[i] ? value - Previous_[i] : value;
+        Previous_[i] = value;
+    }
+}
+
+void RegisterQuantileGauges(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels,
+    ::NMonitoring::THistogram* histogram)
+{
+    // Ignored together with the new gauges if the same labels are already registered
+    auto quantiles = std::make_shared<TWindowedQuantiles>(histogram);
+    for (const auto& [quantile, name] : EXPORTED_QUANTILES) {
+        auto gaugeLabels = labels;
+        gaugeLabels.Add("quantile", name);
+        registry.LazyGauge(std::move(gaugeLabels), [quantiles, quantile = quantile]() {
+            return quantiles->Get(quantile);
+        });
+    }
+}
+
+} // namespace NSdkStats
+} // namespace NYdb
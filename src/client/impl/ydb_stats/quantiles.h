@@ -0,0 +1,46 @@
+#pragma once
+
+#include <library/cpp/monlib/metrics/metric_registry.h>
+
+#include <util/datetime/base.h>
+
+#include <mutex>
+#include <vector>
+
+namespace NYdb::inline V3 {
+namespace NSdkStats {
+
+// Quantile of the values in the buckets, linearly interpolated inside the bucket it falls into.
+// Values of the last (infinite) bucket are reported as its lower bound.
+double GetHistogramQuantile(const std::vector<::NMonitoring::TBucketBound>& bounds,
+    const std::vector<::NMonitoring::TBucketValue>& values, double quantile);
+
+// Quantiles of a histogram over the values recorded since the previous computation,
+// so every scrape reports the latency of the last scrape interval rather than since start.
+// Gauges of one scrape are read together, they share a computation made at most once per RefreshInterval.
+class TWindowedQuantiles {
+public:
+    static constexpr TDuration RefreshInterval = TDuration::Seconds(1);
+
+    explicit TWindowedQuantiles(::NMonitoring::THistogram* histogram);
+
+    double Get(double quantile, TInstant now = TInstant::Now());
+
+private:
+    void Refresh();
+
+    ::NMonitoring::THistogram* Histogram_;
+
+    std::mutex Lock_;
+    TInstant LastRefresh_;
+    std::vector<::NMonitoring::TBucketBound> Bounds_;
+    std::vector<::NMonitoring::TBucketValue> Previous_;
+    std::vector<::NMonitoring::TBucketValue> Window_;
+};
+
+// Registers p50, p99 and p999 gauges of the histogram with the "quantile" label added to the labels
+void RegisterQuantileGauges(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels,
+    ::NMonitoring::THistogram* histogram);
+
+} // namespace NSdkStats
+} // namespace NYdb
@@ -0,0 +1,190 @@
+#include "sharded.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace NYdb::inline V3 {
+namespace NSdkStats {
+
+namespace {
+
+constexpr size_t MAX_STAT_SHARDS_COUNT = 64;
+
+std::string LabelsKey(const ::NMonitoring::TLabels& labels) {
+    std::string key;
+    for (const auto& label : labels) {
+        key.append(label.Name()).push_back('=');
+        key.append(label.Value()).push_back('\0');
+    }
+    return key;
+}
+
+// Finds the counter of the labels registered in a registry. The lazy metric of the registry holds
+// the counter, so it is freed with the registry, and the map only keeps a weak reference:
+// a registry created later at the same address does not find the counters of the destroyed one.
+class TShardedCounters {
+public:
+    static TShardedCounters& Instance() {
+        static TShardedCounters instance;
+        return instance;
+    }
+
+    TShardedCounter* Rate(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels) {
+        auto counter = Get(registry, labels);
+        // Returns the already registered metric if any, which sums the same shards
+        registry.LazyRate(labels, [counter]() {
+            return static_cast<ui64>(counter->Get());
+        });
+        return counter.get();
+    }
+
+    TShardedCounter* IntGauge(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels) {
+        auto counter = Get(registry, labels);
+        registry.LazyIntGauge(labels, [counter]() {
+            return counter->Get();
+        });
+        return counter.get();
+    }
+
+private:
+    std::shared_ptr<TShardedCounter> Get(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels) {
+        std::lock_guard guard(Lock_);
+        auto& entry = Counters_[{&registry, LabelsKey(labels)}];
+        auto counter = entry.lock();
+        if (!counter) {
+            counter = std::make_shared<TShardedCounter>();
+            entry = counter;
+            PruneExpiredImpl();
+        }
+        return counter;
+    }
+
+    // Amortized over insertions, the map stays within twice the number of live counters
+    void PruneExpiredImpl() {
+        if (Counters_.size() < PruneSize_) {
+            return;
+        }
+        std::erase_if(Counters_, [](const auto& entry) {
+            return entry.second.expired();
+        });
+        PruneSize_ = std::max<size_t>(Counters_.size() * 2, MIN_PRUNE_SIZE);
+    }
+
+    static constexpr size_t MIN_PRUNE_SIZE = 64;
+
+    std::mutex Lock_;
+    std::map<std::pair<::NMonitoring::TMetricRegistry*, std::string>, std::weak_ptr<TShardedCounter>> Counters_;
+    size_t PruneSize_ = MIN_PRUNE_SIZE;
+};
+
+} // namespace
+
+size_t GetStatShardsCount() {
+    static const size_t count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_STAT_SHARDS_COUNT);
+    return count;
+}
+
+size_t GetStatShardIndex() {
+    static std::atomic<size_t> nextThread = 0;
+    thread_local const size_t index = nextThread.fetch_add(1, std::memory_order_relaxed) % GetStatShardsCount();
+    return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShardedCounter::TShardedCounter()
+    : Shards_(GetStatShardsCount())
+{}
+
+i64 TShardedCounter::Get() const {
+    i64 sum = 0;
+    for (const auto& shard : Shards_) {
+        sum += shard.Value.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShardedHistogramCollector::TShardedHistogramCollector(::NMonitoring::IHistogramCollectorPtr prototype) {
+    auto snapshot = prototype->Snapshot();
+    Bounds_.reserve(snapshot->Count());
+    for (ui32 i = 0; i < snapshot->Count(); ++i) {
+        Bounds_.push_back(snapshot->UpperBound(i));
+    }
+
+    LinesPerShard_ = (Bounds_.size() + VALUES_PER_LINE - 1) / VALUES_PER_LINE;
+    Lines_ = std::vector<TLine>(LinesPerShard_ * GetStatShardsCount());
+}
+
+std::atomic<ui64>& TShardedHistogramCollector::Value(size_t shard, size_t bucket) {
+    return Lines_[shard * LinesPerShard_ + bucket / VALUES_PER_LINE].Values[bucket % VALUES_PER_LINE];
+}
+
+const std::atomic<ui64>& TShardedHistogramCollector::Value(size_t shard, size_t bucket) const {
+    return Lines_[shard * LinesPerShard_ + bucket / VALUES_PER_LINE].Values[bucket % VALUES_PER_LINE];
+}
+
+size_t TShardedHistogramCollector::FindBucket(double value) const {
+    // Bucket i holds values in (Bounds_[i - 1], Bounds_[i]], the last bound is infinity
+    auto it = std::lower_bound(Bounds_.begin(), Bounds_.end(), value);
+    return it == Bounds_.end() ? Bounds_.size() - 1 : it - Bounds_.begin();
+}
+
+void TShardedHistogramCollector::Collect(double value, ui64 count) {
+    Value(GetStatShardIndex(), FindBucket(value)).fetch_add(count, std::memory_order_relaxed);
+}
+
+void TShardedHistogramCollector::Reset() {
+    for (auto& line : Lines_) {
+        for (auto& value : line.Values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+::NMonitoring::IHistogramSnapshotPtr TShardedHistogramCollector::Snapshot() const {
+    std::vector<::NMonitoring::TBucketValue> values(Bounds_.size(), 0);
+    for (size_t shard = 0; shard < GetStatShardsCount(); ++shard) {
+        for (size_t i = 0; i < Bounds_.size(); ++i) {
+            values[i] += Value(shard, i).load(std::memory_order_relaxed);
+        }
+    }
+    return ::NMonitoring::ExplicitHistogramSnapshot(Bounds_, values);
+}
+
+std::function<::NMonitoring::IHistogramCollectorPtr()> ShardedExponentialHistogram(ui32 bucketsCount, double base, double scale) {
+    return [bucketsCount, base, scale]() -> ::NMonitoring::IHistogramCollectorPtr {
+        return MakeHolder<TShardedHistogramCollector>(::NMonitoring::ExponentialHistogram(bucketsCount, base, scale));
+    };
+}
+
+std::function<::NMonitoring::IHistogramCollectorPtr()> ShardedLogLinearHistogram(ui32 octaves, ui32 subBuckets, double scale) {
+    ::NMonitoring::TBucketBounds bounds;
+    for (ui32 octave = 0; octave < octaves; ++octave) {
+        const double octaveStart = scale * (1ull << octave);
+        for (ui32 i = 0; i < subBuckets; ++i) {
+            bounds.push_back(octaveStart + octaveStart * i / subBuckets);
+        }
+    }
+    bounds.push_back(scale * (1ull << octaves));
+
+    return [bounds = std::move(bounds)]() -> ::NMonitoring::IHistogramCollectorPtr {
+        return MakeHolder<TShardedHistogramCollector>(::NMonitoring::ExplicitHistogram(bounds));
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShardedCounter* ShardedRate(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels) {
+    return TShardedCounters::Instance().Rate(registry, labels);
+}
+
+TShardedCounter* ShardedIntGauge(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels) {
+    return TShardedCounters::Instance().IntGauge(registry, labels);
+}
+
+} // namespace NSdkStats
+} // namespace NYdb
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <library/cpp/monlib/metrics/histogram_collector.h>
+#include <library/cpp/monlib/metrics/metric_registry.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace NYdb::inline V3 {
+namespace NSdkStats {
+
+// Request path counters are updated from every client and network thread. A single
+// atomic per metric makes all of them fight for one cache line, so hot metrics are split
+// into per-thread shards that are summed only when the registry is scraped.
+
+constexpr size_t STAT_SHARD_ALIGNMENT = 64;
+
+size_t GetStatShardsCount();
+
+// Shard of the calling thread, threads get shards round-robin on their first update
+size_t GetStatShardIndex();
+
+class TShardedCounter {
+public:
+    TShardedCounter();
+
+    void Add(i64 value) {
+        Shards_[GetStatShardIndex()].Value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void Inc() {
+        Add(1);
+    }
+
+    void Dec() {
+        Add(-1);
+    }
+
+    i64 Get() const;
+
+private:
+    struct alignas(STAT_SHARD_ALIGNMENT) TShard {
+        std::atomic<i64> Value = 0;
+    };
+
+    std::vector<TShard> Shards_;
+};
+
+// Histogram collector with per-thread copies of the buckets of a regular collector.
+// Snapshots have the same bounds as the prototype collector.
+class TShardedHistogramCollector : public ::NMonitoring::IHistogramCollector {
+public:
+    explicit TShardedHistogramCollector(::NMonitoring::IHistogramCollectorPtr prototype);
+
+    void Collect(double value, ui64 count) override;
+    void Reset() override;
+    ::NMonitoring::IHistogramSnapshotPtr Snapshot() const override;
+
+private:
+    static constexpr size_t VALUES_PER_LINE = STAT_SHARD_ALIGNMENT / sizeof(std::atomic<ui64>);
+
+    struct alignas(STAT_SHARD_ALIGNMENT) TLine {
+        std::atomic<ui64> Values[VALUES_PER_LINE] = {};
+    };
+
+    size_t FindBucket(double value) const;
+    std::atomic<ui64>& Value(size_t shard, size_t bucket);
+    const std::atomic<ui64>& Value(size_t shard, size_t bucket) const;
+
+    std::vector<::NMonitoring::TBucketBound> Bounds_;
+    // Buckets of a shard occupy whole cache lines
+    size_t LinesPerShard_ = 0;
+    std::vector<TLine> Lines_;
+};
+
+std::function<::NMonitoring::IHistogramCollectorPtr()> ShardedExponentialHistogram(ui32 bucketsCount, double base, double scale);
+
+// Log-linear buckets: every power of two range starting from scale is split into subBuckets equal buckets,
+// which keeps the relative error of a bucket within 1 / subBuckets across all octaves
+std::function<::NMonitoring::IHistogramCollectorPtr()> ShardedLogLinearHistogram(ui32 octaves, ui32 subBuckets, double scale);
+
+// Sharded metrics are registered as lazy metrics summing the shards on scrape.
+// Like regular registry metrics, they are shared by everyone who registers the same labels
+// in the same registry, and they live as long as the registry.
+TShardedCounter* ShardedRate(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels);
+TShardedCounter* ShardedIntGauge(::NMonitoring::TMetricRegistry& registry, const ::NMonitoring::TLabels& labels);
+
+} // namespace NSdkStats
+} // namespace NYdb
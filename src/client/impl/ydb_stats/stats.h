@@ -1,11 +1,15 @@
 #pragma once
 
+#include <ydb-cpp-sdk/client/retry/retry.h>
 #include <ydb-cpp-sdk/client/types/status_codes.h>
 
+#include <src/client/impl/ydb_stats/quantiles.h>
+#include <src/client/impl/ydb_stats/sharded.h>
 #include <src/library/grpc/client/grpc_client_low.h>
 #include <library/cpp/monlib/metrics/metric_registry.h>
 #include <library/cpp/monlib/metrics/histogram_collector.h>
 
+#include <array>
 #include <atomic>
 #include <memory>
 
@@ -156,6 +160,43 @@ private:
     i64 oldValue = 0;
 };
 
+// Phases of a unary request on its way through TGRpcConnectionsImpl::Run
+enum class ERequestPhase : size_t {
+    Admission = 0,  // from Run to an admitted request with a chosen endpoint, includes waiting for discovery
+    Credentials,    // call metadata and auth info fetch, unless gRPC call credentials fetch it during Transport
+    Transport,      // network and server time
+    ResponseQueue,  // response waiting in the driver response queue
+    Callback,       // user response callback
+    Count
+};
+
+inline const char* GetRequestPhaseSensor(ERequestPhase phase) {
+    switch (phase) {
+        case ERequestPhase::Admission:
+            return "Request/Phase/Admission";
+        case ERequestPhase::Credentials:
+            return "Request/Phase/Credentials";
+        case ERequestPhase::Transport:
+            return "Request/Phase/Transport";
+        case ERequestPhase::ResponseQueue:
+            return "Request/Phase/ResponseQueue";
+        case ERequestPhase::Callback:
+            return "Request/Phase/Callback";
+        case ERequestPhase::Count:
+            break;
+    }
+    return "Request/Phase/Unknown";
+}
+
+// Timestamps of a single request, allocated only when request phases are collected.
+// A phase is recorded when both of its bounds are set.
+struct TRequestPhaseTimestamps {
+    TInstant Start;
+    TInstant Admitted;
+    TInstant Sent;
+    TInstant Received;
+};
+
 struct TStatCollector {
     using TMetricRegistry = ::NMonitoring::TMetricRegistry;
 
@@ -179,17 +220,21 @@ public:
         TSessionPoolStatCollector(::NMonitoring::TIntGauge* activeSessions = nullptr
         , ::NMonitoring::TIntGauge* inPoolSessions = nullptr
         , ::NMonitoring::TRate* fakeSessions = nullptr
-        , ::NMonitoring::TIntGauge* waiters = nullptr)
+        , ::NMonitoring::TIntGauge* waiters = nullptr
+        , ::NMonitoring::THistogram* acquireLatency = nullptr)
         : ActiveSessions(activeSessions)
         , InPoolSessions(inPoolSessions)
         , FakeSessions(fakeSessions)
         , Waiters(waiters)
+        , AcquireLatency(acquireLatency)
         { }
 
         ::NMonitoring::TIntGauge* ActiveSessions;
         ::NMonitoring::TIntGauge* InPoolSessions;
         ::NMonitoring::TRate* FakeSessions;
         ::NMonitoring::TIntGauge* Waiters;
+        // Set only when request phases are collected, microseconds
+        ::NMonitoring::THistogram* AcquireLatency;
     };
 
     struct TClientRetryOperationStatCollector {
@@ -220,6 +265,15 @@ public:
             }
         }
 
+        void IncRetryRejected(NRetry::ERetryDecision decision) {
+            if (auto registry = MetricRegistry_.Get()) {
+                std::string sensor = decision == NRetry::ERetryDecision::CircuitOpen
+                    ? "RetryOperation/RejectedCircuitOpen"
+                    : "RetryOperation/RejectedBudgetExhausted";
+                registry->Rate({ {"database", Database_}, {"ydb_client", ClientType_}, {"sensor", sensor} })->Inc();
+            }
+        }
+
     private:
         TAtomicPointer<::NMonitoring::TMetricRegistry> MetricRegistry_;
         std::string Database_;
@@ -250,9 +304,10 @@ public:
         TClientRetryOperationStatCollector RetryOperationStatCollector;
     };
 
-    TStatCollector(const std::string& database, TMetricRegistry* sensorsRegistry)
+    TStatCollector(const std::string& database, TMetricRegistry* sensorsRegistry, bool collectRequestPhases = false)
         : Database_(database)
         , DatabaseLabel_({"database", database})
+        , CollectRequestPhases_(collectRequestPhases)
     {
         if (sensorsRegistry) {
             SetMetricRegistry(sensorsRegistry);
@@ -269,12 +324,28 @@ public:
         RequestFailDueNoEndpoint_.Set(sensorsRegistry->Rate({ DatabaseLabel_,       {"sensor", "Request/FailedNoEndpoint"} }));
         RequestFailDueTransportError_.Set(sensorsRegistry->Rate({ DatabaseLabel_,   {"sensor", "Request/FailedTransportError"} }));
         SessionCV_.Set(sensorsRegistry->IntGauge({ DatabaseLabel_,                  {"sensor", "SessionBalancer/Variation"} }));
-        GRpcInFlight_.Set(sensorsRegistry->IntGauge({ DatabaseLabel_,               {"sensor", "Grpc/InFlight"} }));
+        GRpcInFlight_.Set(ShardedIntGauge(*sensorsRegistry, { DatabaseLabel_,       {"sensor", "Grpc/InFlight"} }));
 
+        // Updated by every request, see sharded.h
         RequestLatency_.Set(sensorsRegistry->HistogramRate({ DatabaseLabel_, {"sensor", "Request/Latency"} },
-            ::NMonitoring::ExponentialHistogram(20, 2, 1)));
+            ShardedExponentialHistogram(20, 2, 1)));
+        // Millisecond buckets put all point reads into the first one, the high resolution histogram
+        // covers 8us..67s with two buckets per octave and exports p50/p99/p999 of every scrape interval
+        RequestLatencyUs_.Set(sensorsRegistry->HistogramRate({ DatabaseLabel_, {"sensor", "Request/LatencyUs"} },
+            ShardedLogLinearHistogram(23, 2, 8)));
+        RegisterQuantileGauges(*sensorsRegistry, { DatabaseLabel_, {"sensor", "Request/LatencyUs/Quantile"} },
+            RequestLatencyUs_.Get());
         ResultSize_.Set(sensorsRegistry->HistogramRate({ DatabaseLabel_, {"sensor", "Request/ResultSize"} },
-            ::NMonitoring::ExponentialHistogram(20, 2, 32)));
+            ShardedExponentialHistogram(20, 2, 32)));
+
+        if (CollectRequestPhases_) {
+            // Phases are much shorter than whole requests, so they are measured in microseconds
+            for (size_t i = 0; i < RequestPhaseLatency_.size(); ++i) {
+                const auto sensor = GetRequestPhaseSensor(static_cast<ERequestPhase>(i));
+                RequestPhaseLatency_[i].Set(sensorsRegistry->HistogramRate({ DatabaseLabel_, {"sensor", sensor} },
+                    ShardedExponentialHistogram(25, 2, 1)));
+            }
+        }
     }
 
     void IncDiscoveryDuePessimization() {
@@ -303,6 +374,25 @@ public:
 
     void IncRequestLatency(TDuration duration) {
         RequestLatency_.Record(duration.MilliSeconds());
+        RequestLatencyUs_.Record(duration.MicroSeconds());
+    }
+
+    bool IsCollectingRequestPhases() {
+        return CollectRequestPhases_ && IsCollecting();
+    }
+
+    void RecordRequestPhase(ERequestPhase phase, TInstant begin, TInstant end) {
+        if (begin && end) {
+            RequestPhaseLatency_[static_cast<size_t>(phase)].Record((end - begin).MicroSeconds());
+        }
+    }
+
+    void RecordRequestPhases(const TRequestPhaseTimestamps& timestamps, TInstant callbackStart, TInstant callbackEnd) {
+        RecordRequestPhase(ERequestPhase::Admission, timestamps.Start, timestamps.Admitted);
+        RecordRequestPhase(ERequestPhase::Credentials, timestamps.Admitted, timestamps.Sent);
+        RecordRequestPhase(ERequestPhase::Transport, timestamps.Sent, timestamps.Received);
+        RecordRequestPhase(ERequestPhase::ResponseQueue, timestamps.Received, callbackStart);
+        RecordRequestPhase(ERequestPhase::Callback, callbackStart, callbackEnd);
     }
 
     void IncResultSize(const size_t& size) {
@@ -348,8 +438,13 @@ public:
                 {"sensor", "Sessions/SessionsLimitExceeded"} });
             auto waiters = registry->IntGauge({ DatabaseLabel_, {"ydb_client", clientType},
                 {"sensor", "Sessions/WaitForReturn"} });
+            ::NMonitoring::THistogram* acquireLatency = nullptr;
+            if (CollectRequestPhases_) {
+                acquireLatency = registry->HistogramRate({ DatabaseLabel_, {"ydb_client", clientType},
+                    {"sensor", "Request/Phase/SessionAcquire"} }, ShardedExponentialHistogram(25, 2, 1));
+            }
 
-            return TSessionPoolStatCollector(activeSessions, inPoolSessions, fakeSessions, waiters);
+            return TSessionPoolStatCollector(activeSessions, inPoolSessions, fakeSessions, waiters, acquireLatency);
         }
 
         return TSessionPoolStatCollector();
@@ -371,9 +466,9 @@ public:
             }
 
             auto querySize = registry->HistogramRate({ DatabaseLabel_, {"ydb_client", clientType},
-                {"sensor", "Request/QuerySize"} }, ::NMonitoring::ExponentialHistogram(20, 2, 32));
+                {"sensor", "Request/QuerySize"} }, ShardedExponentialHistogram(20, 2, 32));
             auto paramsSize = registry->HistogramRate({ DatabaseLabel_, {"ydb_client", clientType},
-                {"sensor", "Request/ParamsSize"} }, ::NMonitoring::ExponentialHistogram(10, 2, 32));
+                {"sensor", "Request/ParamsSize"} }, ShardedExponentialHistogram(10, 2, 32));
 
             return TClientStatCollector(cacheMiss, querySize, paramsSize, sessionRemovedDueBalancing, requestMigrated,
                 TClientRetryOperationStatCollector(MetricRegistryPtr_.Get(), Database_, clientType));
@@ -397,6 +492,7 @@ public:
 private:
     const std::string Database_;
     const ::NMonitoring::TLabel DatabaseLabel_;
+    const bool CollectRequestPhases_;
     TAtomicPointer<TMetricRegistry> MetricRegistryPtr_;
     TAtomicCounter<::NMonitoring::TRate> DiscoveryDuePessimization_;
     TAtomicCounter<::NMonitoring::TRate> DiscoveryDueExpiration_;
@@ -405,9 +501,11 @@ private:
     TAtomicCounter<::NMonitoring::TRate> RequestFailDueTransportError_;
     TAtomicCounter<::NMonitoring::TRate> DiscoveryFailDueTransportError_;
     TAtomicCounter<::NMonitoring::TIntGauge> SessionCV_;
-    TAtomicCounter<::NMonitoring::TIntGauge> GRpcInFlight_;
+    TAtomicCounter<TShardedCounter> GRpcInFlight_;
     TAtomicHistogram<::NMonitoring::THistogram> RequestLatency_;
+    TAtomicHistogram<::NMonitoring::THistogram> RequestLatencyUs_;
     TAtomicHistogram<::NMonitoring::THistogram> ResultSize_;
+    std::array<TAtomicHistogram<::NMonitoring::THistogram>, static_cast<size_t>(ERequestPhase::Count)> RequestPhaseLatency_;
 };
 
 } // namespace NSdkStats
@@ -176,4 +176,317 @@ TParams TParamsBuilder::Build() {
     return Impl_->Build();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+class TParamsTemplate::TImpl {
+public:
+    struct TSlot {
+        TStringType Name;
+        Ydb::Type Type;
+        // Value type of primitive and Optional<primitive> parameters
+        std::optional<EPrimitiveType> Primitive;
+        bool Optional = false;
+    };
+
+    TImpl(const std::map<std::string, TType>& typeInfo) {
+        Slots.reserve(typeInfo.size());
+        for (const auto& [name, type] : typeInfo) {
+            Indexes_.emplace(name, Slots.size());
+
+            auto& slot = Slots.emplace_back();
+            slot.Name = name;
+            slot.Type = type.GetProto();
+
+            const Ydb::Type* valueType = &slot.Type;
+            if (valueType->has_optional_type()) {
+                slot.Optional = true;
+                valueType = &valueType->optional_type().item();
+            }
+            if (valueType->has_type_id()) {
+                slot.Primitive = EPrimitiveType(valueType->type_id());
+            }
+
+            Prototype[slot.Name].mutable_type()->CopyFrom(slot.Type);
+        }
+    }
+
+    size_t GetSlot(const std::string& name) const {
+        auto it = Indexes_.find(name);
+        if (it == Indexes_.end()) {
+            ThrowFatalError(TStringBuilder() << "TParamsTemplate: Parameter not found: " << name);
+            return 0;
+        }
+        return it->second;
+    }
+
+    std::vector<TSlot> Slots;
+    // Parameters map with types and empty values, builders start from a copy of it
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> Prototype;
+
+private:
+    std::map<std::string, size_t> Indexes_;
+};
+
+TParamsTemplate::TParamsTemplate(const std::map<std::string, TType>& typeInfo)
+    : Impl_(std::make_shared<TImpl>(typeInfo)) {}
+
+size_t TParamsTemplate::GetSlot(const std::string& name) const {
+    return Impl_->GetSlot(name);
+}
+
+size_t TParamsTemplate::GetSlotsCount() const {
+    return Impl_->Slots.size();
+}
+
+TTemplateParamsBuilder TParamsTemplate::CreateBuilder() const {
+    return TTemplateParamsBuilder(Impl_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TTemplateParamsBuilder::TImpl {
+public:
+    TImpl(std::shared_ptr<const TParamsTemplate::TImpl> paramsTemplate)
+        : Template_(std::move(paramsTemplate))
+        , Values_(Template_->Slots.size())
+        , IsSet_(Template_->Slots.size())
+    {}
+
+    Ydb::Value& SetPrimitive(size_t slot, EPrimitiveType type) {
+        const auto& info = GetSlot(slot);
+        if (info.Primitive != type) {
+            TypeMismatch(info, TTypeBuilder().Primitive(type).Build());
+        }
+        IsSet_[slot] = true;
+        return GetValue(slot);
+    }
+
+    void Null(size_t slot) {
+        const auto& info = GetSlot(slot);
+        if (!info.Optional) {
+            FatalError(TStringBuilder() << "Null value for non optional parameter: " << info.Name);
+        }
+        GetValue(slot).set_null_flag_value(::google::protobuf::NULL_VALUE);
+        IsSet_[slot] = true;
+    }
+
+    void Value(size_t slot, const TValue& value) {
+        const auto& info = GetSlot(slot);
+        if (!TypesEqual(info.Type, value.GetType())) {
+            TypeMismatch(info, value.GetType());
+        }
+        GetValue(slot).CopyFrom(value.GetProto());
+        IsSet_[slot] = true;
+    }
+
+    TParams Build() {
+        for (size_t i = 0; i < Values_.size(); ++i) {
+            if (!IsSet_[i] && !Template_->Slots[i].Optional) {
+                FatalError(TStringBuilder() << "Value is not set for parameter: " << Template_->Slots[i].Name);
+            }
+        }
+
+        for (size_t i = 0; i < Values_.size(); ++i) {
+            if (!IsSet_[i]) {
+                GetValue(i).set_null_flag_value(::google::protobuf::NULL_VALUE);
+            }
+            IsSet_[i] = false;
+        }
+
+        // The values are already in the map, it is handed out as is
+        ::google::protobuf::Map<TStringType, Ydb::TypedValue> paramsMap;
+        paramsMap.swap(ParamsMap_);
+        Prepared_ = false;
+        return TParams(std::move(paramsMap));
+    }
+
+    void Recycle(TParams&& params) {
+        // A map shared with copies of the params can't be taken
+        if (Prepared_ || params.Impl_.use_count() != 1 || params.Empty()) {
+            return;
+        }
+
+        auto& paramsMap = *params.GetProtoMapPtr();
+        if (paramsMap.size() != Values_.size()) {
+            return;
+        }
+        for (const auto& info : Template_->Slots) {
+            if (!paramsMap.contains(info.Name)) {
+                return;
+            }
+        }
+
+        // Protobuf keeps the memory of cleared fields, so nothing is allocated for the next values
+        ParamsMap_.swap(paramsMap);
+        for (size_t i = 0; i < Values_.size(); ++i) {
+            auto& param = ParamsMap_[Template_->Slots[i].Name];
+            param.mutable_type()->CopyFrom(Template_->Slots[i].Type);
+            param.mutable_value()->Clear();
+            Values_[i] = param.mutable_value();
+        }
+        Prepared_ = true;
+    }
+
+private:
+    const TParamsTemplate::TImpl::TSlot& GetSlot(size_t slot) const {
+        if (slot >= Values_.size()) {
+            FatalError(TStringBuilder() << "Slot is out of range: " << slot);
+        }
+        return Template_->Slots[slot];
+    }
+
+    Ydb::Value& GetValue(size_t slot) {
+        if (!Prepared_) {
+            // The map of the previous Build() was handed out and not recycled
+            ParamsMap_ = Template_->Prototype;
+            for (size_t i = 0; i < Values_.size(); ++i) {
+                Values_[i] = ParamsMap_[Template_->Slots[i].Name].mutable_value();
+            }
+            Prepared_ = true;
+        }
+        return *Values_[slot];
+    }
+
+    void TypeMismatch(const TParamsTemplate::TImpl::TSlot& info, const TType& actual) const {
+        FatalError(TStringBuilder() << "Type mismatch for parameter: " << info.Name << ", expected: "
+            << FormatType(TType(info.Type)) << ", actual: " << FormatType(actual));
+    }
+
+    void FatalError(const std::string& msg) const {
+        ThrowFatalError(TStringBuilder() << "TTemplateParamsBuilder: " << msg);
+    }
+
+private:
+    std::shared_ptr<const TParamsTemplate::TImpl> Template_;
+    // Parameters of the next Build(), Values_ point to the values in it
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> ParamsMap_;
+    bool Prepared_ = false;
+    std::vector<Ydb::Value*> Values_;
+    std::vector<bool> IsSet_;
+};
+
+TTemplateParamsBuilder::TTemplateParamsBuilder(std::shared_ptr<const TParamsTemplate::TImpl> paramsTemplate)
+    : Impl_(new TImpl(std::move(paramsTemplate))) {}
+
+TTemplateParamsBuilder::TTemplateParamsBuilder(TTemplateParamsBuilder&&) = default;
+TTemplateParamsBuilder::~TTemplateParamsBuilder() = default;
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Bool(size_t slot, bool value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Bool).set_bool_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Int8(size_t slot, int8_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Int8).set_int32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Uint8(size_t slot, uint8_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Uint8).set_uint32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Int16(size_t slot, int16_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Int16).set_int32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Uint16(size_t slot, uint16_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Uint16).set_uint32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Int32(size_t slot, int32_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Int32).set_int32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Uint32(size_t slot, uint32_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Uint32).set_uint32_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Int64(size_t slot, int64_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Int64).set_int64_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Uint64(size_t slot, uint64_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Uint64).set_uint64_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Float(size_t slot, float value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Float).set_float_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Double(size_t slot, double value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Double).set_double_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Date(size_t slot, const TInstant& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Date).set_uint32_value(value.Days());
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Datetime(size_t slot, const TInstant& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Datetime).set_uint32_value(value.Seconds());
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Timestamp(size_t slot, const TInstant& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Timestamp).set_uint64_value(value.MicroSeconds());
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Interval(size_t slot, int64_t value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Interval).set_int64_value(value);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::String(size_t slot, const std::string& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::String).set_bytes_value(TStringType{value});
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Utf8(size_t slot, const std::string& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Utf8).set_text_value(TStringType{value});
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Yson(size_t slot, const std::string& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Yson).set_bytes_value(TStringType{value});
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Json(size_t slot, const std::string& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::Json).set_text_value(TStringType{value});
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::JsonDocument(size_t slot, const std::string& value) {
+    Impl_->SetPrimitive(slot, EPrimitiveType::JsonDocument).set_text_value(TStringType{value});
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Null(size_t slot) {
+    Impl_->Null(slot);
+    return *this;
+}
+
+TTemplateParamsBuilder& TTemplateParamsBuilder::Value(size_t slot, const TValue& value) {
+    Impl_->Value(slot, value);
+    return *this;
+}
+
+TParams TTemplateParamsBuilder::Build() {
+    return Impl_->Build();
+}
+
+void TTemplateParamsBuilder::Recycle(TParams&& params) {
+    Impl_->Recycle(std::move(params));
+}
+
 } // namespace NYdb
@@ -84,22 +84,22 @@ public:
     }
 
     TAsyncExecuteQueryIterator StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
-        const std::optional<TParams>& params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session = {})
+        std::optional<TParams> params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session = {})
     {
         CollectQuerySize(query);
         CollectParamsSize(params ? &params->GetProtoMap() : nullptr);
         return TExecQueryImpl::StreamExecuteQuery(
-            Connections_, DbDriverState_, query, txControl, params, settings, session);
+            Connections_, DbDriverState_, query, txControl, std::move(params), settings, session);
     }
 
     TAsyncExecuteQueryResult ExecuteQuery(const std::string& query, const TTxControl& txControl,
-        const std::optional<TParams>& params, const TExecuteQuerySettings& settings,
+        std::optional<TParams> params, const TExecuteQuerySettings& settings,
         const std::optional<TSession>& session = {})
     {
         CollectQuerySize(query);
         CollectParamsSize(params ? &params->GetProtoMap() : nullptr);
         return TExecQueryImpl::ExecuteQuery(
-            Connections_, DbDriverState_, query, txControl, params, settings, session);
+            Connections_, DbDriverState_, query, txControl, std::move(params), settings, session);
     }
 
     NThreading::TFuture<TScriptExecutionOperation> ExecuteScript(const std::string& script, const std::optional<TParams>& params, const TExecuteScriptSettings& settings) {
@@ -472,10 +472,17 @@ public:
 
         auto ctx = std::make_unique<TQueryClientGetSessionCtx>(shared_from_this(), settings.ClientTimeout_);
         auto future = ctx->GetFuture();
+        SessionPool_.RecordAcquireLatency(future);
         SessionPool_.GetSession(std::move(ctx));
         return future;
     }
 
+    void WarmUpSessionPool() {
+        const auto& sessionPoolSettings = Settings_.SessionPoolSettings_;
+        NSessionPool::WarmUpSessions(Min(sessionPoolSettings.WarmUpSessions_, sessionPoolSettings.MaxActiveSessions_),
+            [this] { return GetSession(TCreateSessionSettings()); });
+    }
+
     int64_t GetActiveSessionCount() const {
         return SessionPool_.GetActiveSessions();
     }
@@ -521,6 +528,10 @@ public:
         RetryOperationStatCollector_.IncSyncRetryOperation(status);
     }
 
+    void CollectRetryRejectedStat(NRetry::ERetryDecision decision) {
+        RetryOperationStatCollector_.IncRetryRejected(decision);
+    }
+
     void CollectQuerySize(const std::string& query) {
         if (QuerySizeHistogram_.IsCollecting()) {
             QuerySizeHistogram_.Record(query.size());
@@ -550,6 +561,7 @@ TQueryClient::TQueryClient(const TDriver& driver, const TClientSettings& setting
     : Impl_(new TQueryClient::TImpl(CreateInternalInterface(driver), settings))
 {
     Impl_->StartPeriodicSessionPoolTask();
+    Impl_->WarmUpSessionPool();
 }
 
 TAsyncExecuteQueryResult TQueryClient::ExecuteQuery(const std::string& query, const TTxControl& txControl,
@@ -564,6 +576,12 @@ TAsyncExecuteQueryResult TQueryClient::ExecuteQuery(const std::string& query, co
     return Impl_->ExecuteQuery(query, txControl, params, settings);
 }
 
+TAsyncExecuteQueryResult TQueryClient::ExecuteQuery(const std::string& query, const TTxControl& txControl,
+    TParams&& params, const TExecuteQuerySettings& settings)
+{
+    return Impl_->ExecuteQuery(query, txControl, std::move(params), settings);
+}
+
 TAsyncExecuteQueryIterator TQueryClient::StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
     const TExecuteQuerySettings& settings)
 {
@@ -576,6 +594,12 @@ TAsyncExecuteQueryIterator TQueryClient::StreamExecuteQuery(const std::string& q
     return Impl_->StreamExecuteQuery(query, txControl, params, settings);
 }
 
+TAsyncExecuteQueryIterator TQueryClient::StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
+    TParams&& params, const TExecuteQuerySettings& settings)
+{
+    return Impl_->StreamExecuteQuery(query, txControl, std::move(params), settings);
+}
+
 NThreading::TFuture<TScriptExecutionOperation> TQueryClient::ExecuteScript(const std::string& script,
     const TExecuteScriptSettings& settings)
 {
@@ -702,6 +726,16 @@ TAsyncExecuteQueryResult TSession::ExecuteQuery(const std::string& query, const
         Client_->Settings_.SessionPoolSettings_.CloseIdleThreshold_);
 }
 
+TAsyncExecuteQueryResult TSession::ExecuteQuery(const std::string& query, const TTxControl& txControl,
+    TParams&& params, const TExecuteQuerySettings& settings)
+{
+    return NSessionPool::InjectSessionStatusInterception(
+        SessionImpl_,
+        Client_->ExecuteQuery(query, txControl, std::move(params), settings, *this),
+        true,
+        Client_->Settings_.SessionPoolSettings_.CloseIdleThreshold_);
+}
+
 TAsyncExecuteQueryIterator TSession::StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
     const TExecuteQuerySettings& settings)
 {
@@ -722,6 +756,16 @@ TAsyncExecuteQueryIterator TSession::StreamExecuteQuery(const std::string& query
         Client_->Settings_.SessionPoolSettings_.CloseIdleThreshold_);
 }
 
+TAsyncExecuteQueryIterator TSession::StreamExecuteQuery(const std::string& query, const TTxControl& txControl,
+    TParams&& params, const TExecuteQuerySettings& settings)
+{
+    return NSessionPool::InjectSessionStatusInterception(
+        SessionImpl_,
+        Client_->StreamExecuteQuery(query, txControl, std::move(params), settings, *this),
+        true,
+        Client_->Settings_.SessionPoolSettings_.CloseIdleThreshold_);
+}
+
 TAsyncBeginTransactionResult TSession::BeginTransaction(const TTxSettings& txSettings,
         const TBeginTxSettings& settings)
 {
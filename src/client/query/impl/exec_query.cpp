@@ -3,6 +3,7 @@
 #include "client_session.h"
 
 #include <ydb-cpp-sdk/client/query/client.h>
+#include <src/client/impl/ydb_internal/make_request/arena_pool.h>
 #include <src/client/impl/ydb_internal/make_request/make.h>
 #include <src/client/impl/ydb_internal/kqp_session_common/kqp_session_common.h>
 #include <src/client/impl/ydb_internal/session_pool/session_pool.h>
@@ -68,33 +69,36 @@ public:
 
     TAsyncExecuteQueryPart DoReadNext(std::shared_ptr<TSelf> self) {
         auto promise = NThreading::NewPromise<TExecuteQueryPart>();
+        // Every part is parsed on a pooled arena, the result set keeps it alive
+        auto arena = TArenaPool::Acquire();
+        auto* response = google::protobuf::Arena::CreateMessage<TResponse>(arena.get());
         // Capture self - guarantee no dtor call during the read
-        auto readCb = [self, promise](TGRpcStatus&& grpcStatus) mutable {
+        auto readCb = [self, promise, arena, response](TGRpcStatus&& grpcStatus) mutable {
             if (!grpcStatus.Ok()) {
                 self->Finished_ = true;
                 promise.SetValue({TStatus(TPlainStatus(grpcStatus, self->Endpoint_)), {}, {}});
             } else {
                 NYdb::NIssue::TIssues issues;
-                NYdb::NIssue::IssuesFromMessage(self->Response_.issues(), issues);
-                EStatus clientStatus = static_cast<EStatus>(self->Response_.status());
+                NYdb::NIssue::IssuesFromMessage(response->issues(), issues);
+                EStatus clientStatus = static_cast<EStatus>(response->status());
                 TPlainStatus plainStatus{clientStatus, std::move(issues), self->Endpoint_, {}};
                 TStatus status{std::move(plainStatus)};
 
                 std::optional<TExecStats> stats;
                 std::optional<TTransaction> tx;
-                if (self->Response_.has_exec_stats()) {
-                    stats = TExecStats(std::move(*self->Response_.mutable_exec_stats()));
+                if (response->has_exec_stats()) {
+                    stats = TExecStats(std::move(*response->mutable_exec_stats()));
                 }
 
-                if (self->Response_.has_tx_meta() && !self->Response_.tx_meta().id().empty() && self->Session_.has_value()) {
-                    tx = TTransaction(self->Session_.value(), self->Response_.tx_meta().id());
+                if (response->has_tx_meta() && !response->tx_meta().id().empty() && self->Session_.has_value()) {
+                    tx = TTransaction(self->Session_.value(), response->tx_meta().id());
                 }
 
-                if (self->Response_.has_result_set()) {
+                if (response->has_result_set()) {
                     promise.SetValue({
                         std::move(status),
-                        TResultSet(std::move(*self->Response_.mutable_result_set())),
-                        self->Response_.result_set_index(),
+                        TResultSet(response->mutable_result_set(), std::move(arena)),
+                        response->result_set_index(),
                         std::move(stats),
                         std::move(tx)
                     });
@@ -104,7 +108,7 @@ public:
             }
         };
 
-        StreamProcessor_->Read(&Response_, readCb);
+        StreamProcessor_->Read(response, readCb);
         return promise.GetFuture();
     }
 
@@ -121,7 +125,6 @@ public:
 
 private:
     TStreamProcessorPtr StreamProcessor_;
-    TResponse Response_;
     bool Finished_;
     std::string Endpoint_;
     std::optional<TSession> Session_;
@@ -227,7 +230,7 @@ class TExecQueryInternal {
 public:
     static TFuture<std::pair<TPlainStatus, TExecuteQueryProcessorPtr>> ExecuteQueryCommon(
         const std::shared_ptr<TGRpcConnectionsImpl>& connections, const TDbDriverStatePtr& driverState,
-        const std::string& query, const TTxControl& txControl, const ::google::protobuf::Map<TStringType, Ydb::TypedValue>* params,
+        const std::string& query, const TTxControl& txControl, ::google::protobuf::Map<TStringType, Ydb::TypedValue>&& params,
         const TExecuteQuerySettings& settings, const std::optional<TSession>& session)
     {
         auto request = MakeRequest<Ydb::Query::ExecuteQueryRequest>();
@@ -273,9 +276,7 @@ public:
             Y_ASSERT(!txControl.CommitTx_);
         }
 
-        if (params) {
-            *request.mutable_parameters() = *params;
-        }
+        request.mutable_parameters()->swap(params);
 
         auto promise = NewPromise<std::pair<TPlainStatus, TExecuteQueryProcessorPtr>>();
 
@@ -305,17 +306,27 @@ public:
 
 TAsyncExecuteQueryIterator TExecQueryImpl::StreamExecuteQuery(const std::shared_ptr<TGRpcConnectionsImpl>& connections,
     const TDbDriverStatePtr& driverState, const std::string& query, const TTxControl& txControl,
-    const std::optional<TParams>& params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session)
+    std::optional<TParams> params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session)
 {
     TPlainStatus plainStatus;
     TExecuteQueryProcessorPtr processor;
 
     auto sessionCopy = session;
 
+    // The map is moved to the request when nobody else holds the params, e.g. they were passed as TParams&&
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> paramsMap;
+    if (params) {
+        if (params->Impl_.use_count() == 1) {
+            paramsMap.swap(*params->GetProtoMapPtr());
+        } else {
+            paramsMap = params->GetProtoMap();
+        }
+        params.reset();
+    }
+
     if (auto* txPtr = std::get_if<TTransaction>(&txControl.Tx_); txPtr && txControl.CommitTx_) {
         auto queryCopy = query;
         auto txControlCopy = txControl;
-        auto paramsCopy = params;
         auto settingsCopy = settings;
 
         auto tx = *txPtr;
@@ -326,7 +337,7 @@ TAsyncExecuteQueryIterator TExecQueryImpl::StreamExecuteQuery(const std::shared_
         }
 
         std::tie(plainStatus, processor) = co_await TExecQueryInternal::ExecuteQueryCommon(
-            connections, driverState, queryCopy, txControlCopy, paramsCopy ? &paramsCopy->GetProtoMap() : nullptr, settingsCopy, sessionCopy);
+            connections, driverState, queryCopy, txControlCopy, std::move(paramsMap), settingsCopy, sessionCopy);
 
         if (!plainStatus.Ok()) {
             co_await tx.ProcessFailure();
@@ -335,7 +346,7 @@ TAsyncExecuteQueryIterator TExecQueryImpl::StreamExecuteQuery(const std::shared_
         }
     } else {
         std::tie(plainStatus, processor) = co_await AsExtractingAwaitable(TExecQueryInternal::ExecuteQueryCommon(
-            connections, driverState, query, txControl, params ? &params->GetProtoMap() : nullptr, settings, sessionCopy));
+            connections, driverState, query, txControl, std::move(paramsMap), settings, sessionCopy));
     }
 
     co_return TExecuteQueryIterator(
@@ -348,12 +359,12 @@ TAsyncExecuteQueryIterator TExecQueryImpl::StreamExecuteQuery(const std::shared_
 
 TAsyncExecuteQueryResult TExecQueryImpl::ExecuteQuery(const std::shared_ptr<TGRpcConnectionsImpl>& connections,
     const TDbDriverStatePtr& driverState, const std::string& query, const TTxControl& txControl,
-    const std::optional<TParams>& params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session)
+    std::optional<TParams> params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session)
 {
     auto syncSettings = settings;
     syncSettings.ConcurrentResultSets(true);
 
-    return StreamExecuteQuery(connections, driverState, query, txControl, params, syncSettings, session)
+    return StreamExecuteQuery(connections, driverState, query, txControl, std::move(params), syncSettings, session)
         .Apply([](TAsyncExecuteQueryIterator itFuture){
             auto it = itFuture.ExtractValue();
 
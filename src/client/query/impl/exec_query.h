@@ -13,11 +13,11 @@ class TExecQueryImpl {
 public:
     static TAsyncExecuteQueryIterator StreamExecuteQuery(const std::shared_ptr<TGRpcConnectionsImpl>& connections,
         const TDbDriverStatePtr& driverState, const std::string& query, const TTxControl& txControl,
-        const std::optional<TParams>& params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session);
+        std::optional<TParams> params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session);
 
     static TAsyncExecuteQueryResult ExecuteQuery(const std::shared_ptr<TGRpcConnectionsImpl>& connections,
         const TDbDriverStatePtr& driverState, const std::string& query, const TTxControl& txControl,
-        const std::optional<TParams>& params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session);
+        std::optional<TParams> params, const TExecuteQuerySettings& settings, const std::optional<TSession>& session);
 };
 
 } // namespace NYdb::NQuery::NImpl
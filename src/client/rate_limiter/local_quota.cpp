@@ -0,0 +1,155 @@
+#include <ydb-cpp-sdk/client/rate_limiter/rate_limiter.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace NYdb::inline V3::NRateLimiter {
+
+class TLocalQuota::TImpl : public std::enable_shared_from_this<TLocalQuota::TImpl> {
+    struct TWaiter {
+        uint64_t Amount = 0;
+        NThreading::TPromise<TStatus> Promise;
+    };
+
+public:
+    TImpl(TAcquireBatch acquireBatch, const TLocalQuotaSettings& settings)
+        : AcquireBatch(std::move(acquireBatch))
+        , BatchSize(std::max<uint64_t>(1, settings.BatchSize_))
+        , RefillWatermark(settings.RefillWatermark_.value_or(BatchSize / 4))
+    {
+    }
+
+    bool TryAcquire(uint64_t amount) {
+        // Don't overtake acquisitions that are already waiting for refill
+        const bool acquired = WaitersCount.load(std::memory_order_acquire) == 0 && TryTake(amount);
+        if (!acquired || Available.load(std::memory_order_relaxed) < RefillWatermark) {
+            StartRefill(amount);
+        }
+        return acquired;
+    }
+
+    TAsyncStatus Acquire(uint64_t amount) {
+        if (TryAcquire(amount)) {
+            return NThreading::MakeFuture(MakeSuccess());
+        }
+
+        auto promise = NThreading::NewPromise<TStatus>();
+        auto future = promise.GetFuture();
+        {
+            std::lock_guard guard(Lock);
+            // Refill could have finished since TryAcquire
+            if (Waiters.empty() && TryTake(amount)) {
+                return NThreading::MakeFuture(MakeSuccess());
+            }
+            Waiters.push_back({amount, std::move(promise)});
+            WaitersCount.store(Waiters.size(), std::memory_order_release);
+        }
+
+        StartRefill(amount);
+        return future;
+    }
+
+    uint64_t GetAvailable() const {
+        return Available.load(std::memory_order_relaxed);
+    }
+
+private:
+    static TStatus MakeSuccess() {
+        return TStatus(EStatus::SUCCESS, {});
+    }
+
+    bool TryTake(uint64_t amount) {
+        uint64_t available = Available.load(std::memory_order_relaxed);
+        while (available >= amount) {
+            if (Available.compare_exchange_weak(available, available - amount, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Must be called without holding Lock, acquireBatch may complete synchronously.
+    void StartRefill(uint64_t amount) {
+        if (RefillInFlight.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+
+        const uint64_t request = std::max(BatchSize, amount);
+        AcquireBatch(request).Subscribe([self = shared_from_this(), request](const TAsyncStatus& future) {
+            self->OnRefill(request, future.GetValue());
+        });
+    }
+
+    void OnRefill(uint64_t request, const TStatus& status) {
+        std::vector<NThreading::TPromise<TStatus>> ready;
+        std::vector<NThreading::TPromise<TStatus>> failed;
+        uint64_t nextRefill = 0;
+
+        if (status.IsSuccess()) {
+            Available.fetch_add(request, std::memory_order_acq_rel);
+        }
+
+        {
+            std::lock_guard guard(Lock);
+            if (status.IsSuccess()) {
+                while (!Waiters.empty() && TryTake(Waiters.front().Amount)) {
+                    ready.push_back(std::move(Waiters.front().Promise));
+                    Waiters.pop_front();
+                }
+                if (!Waiters.empty()) {
+                    nextRefill = Waiters.front().Amount;
+                }
+            } else {
+                for (auto& waiter : Waiters) {
+                    failed.push_back(std::move(waiter.Promise));
+                }
+                Waiters.clear();
+            }
+            WaitersCount.store(Waiters.size(), std::memory_order_release);
+            RefillInFlight.store(false, std::memory_order_release);
+        }
+
+        for (auto& promise : ready) {
+            promise.SetValue(MakeSuccess());
+        }
+        for (auto& promise : failed) {
+            promise.SetValue(status);
+        }
+
+        if (nextRefill) {
+            StartRefill(nextRefill);
+        }
+    }
+
+private:
+    const TAcquireBatch AcquireBatch;
+    const uint64_t BatchSize;
+    const uint64_t RefillWatermark;
+
+    std::atomic<uint64_t> Available = 0;
+    std::atomic<bool> RefillInFlight = false;
+    std::atomic<size_t> WaitersCount = 0;
+
+    std::mutex Lock;
+    std::deque<TWaiter> Waiters;
+};
+
+TLocalQuota::TLocalQuota(TAcquireBatch acquireBatch, const TLocalQuotaSettings& settings)
+    : Impl_(std::make_shared<TImpl>(std::move(acquireBatch), settings))
+{
+}
+
+bool TLocalQuota::TryAcquire(uint64_t amount) {
+    return Impl_->TryAcquire(amount);
+}
+
+TAsyncStatus TLocalQuota::Acquire(uint64_t amount) {
+    return Impl_->Acquire(amount);
+}
+
+uint64_t TLocalQuota::GetAvailable() const {
+    return Impl_->GetAvailable();
+}
+
+} // namespace NYdb::NRateLimiter
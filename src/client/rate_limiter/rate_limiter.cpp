@@ -411,4 +411,14 @@ TAsyncStatus TRateLimiterClient::AcquireResource(const std::string& coordination
     return Impl_->AcquireResource(coordinationNodePath, resourcePath, settings);
 }
 
+TLocalQuota TRateLimiterClient::CreateLocalQuota(const std::string& coordinationNodePath, const std::string& resourcePath, const TLocalQuotaSettings& settings) {
+    auto acquireBatch = [impl = Impl_, coordinationNodePath, resourcePath, acquireSettings = settings.AcquireSettings_](uint64_t amount) {
+        auto batchSettings = acquireSettings;
+        batchSettings.Amount(amount);
+        batchSettings.IsUsedAmount(false);
+        return impl->AcquireResource(coordinationNodePath, resourcePath, batchSettings);
+    };
+    return TLocalQuota(std::move(acquireBatch), settings);
+}
+
 } // namespace NYdb::NRateLimiter
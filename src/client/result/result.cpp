@@ -37,13 +37,22 @@ bool operator!=(const TColumn& col1, const TColumn& col2) {
 class TResultSet::TImpl {
 public:
     TImpl(const Ydb::ResultSet& proto)
-        : ProtoResultSet_(proto)
+        : OwnProtoResultSet_(proto)
+        , ProtoResultSet_(OwnProtoResultSet_)
     {
         Init();
     }
 
     TImpl(Ydb::ResultSet&& proto)
-        : ProtoResultSet_(std::move(proto))
+        : OwnProtoResultSet_(std::move(proto))
+        , ProtoResultSet_(OwnProtoResultSet_)
+    {
+        Init();
+    }
+
+    TImpl(Ydb::ResultSet* proto, std::shared_ptr<google::protobuf::Arena> arena)
+        : Arena_(std::move(arena))
+        , ProtoResultSet_(*proto)
     {
         Init();
     }
@@ -55,8 +64,12 @@ public:
         }
     }
 
+private:
+    std::shared_ptr<google::protobuf::Arena> Arena_;
+    Ydb::ResultSet OwnProtoResultSet_;
+
 public:
-    const Ydb::ResultSet ProtoResultSet_;
+    const Ydb::ResultSet& ProtoResultSet_;
     std::vector<TColumn> ColumnsMeta_;
 };
 
@@ -68,6 +81,9 @@ TResultSet::TResultSet(const Ydb::ResultSet& proto)
 TResultSet::TResultSet(Ydb::ResultSet&& proto)
     : Impl_(new TResultSet::TImpl(std::move(proto))) {}
 
+TResultSet::TResultSet(Ydb::ResultSet* proto, std::shared_ptr<google::protobuf::Arena> arena)
+    : Impl_(new TResultSet::TImpl(proto, std::move(arena))) {}
+
 size_t TResultSet::ColumnsCount() const {
     return Impl_->ColumnsMeta_.size();
 }
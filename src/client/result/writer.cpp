@@ -0,0 +1,525 @@
+#include <ydb-cpp-sdk/client/result/writer.h>
+
+#include <ydb-cpp-sdk/client/proto/accessor.h>
+#include <ydb-cpp-sdk/client/result/result.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+#include <src/library/decimal/yql_decimal.h>
+#include <src/library/string_utils/base64/base64.h>
+#include <src/library/uuid/uuid.h>
+
+#include <library/cpp/json/writer/json.h>
+
+#include <util/generic/size_literals.h>
+#include <util/generic/yexception.h>
+#include <util/stream/str.h>
+
+#include <charconv>
+#include <cmath>
+
+namespace NYdb::inline V3 {
+
+namespace {
+
+// Rows are collected in a buffer that is written to the stream in large chunks
+constexpr size_t FLUSH_SIZE = 64_KB;
+
+constexpr size_t FORMAT_BUFFER_SIZE = 64;
+
+constexpr i64 SECONDS_PER_DAY = 86400;
+constexpr i64 MICROSECONDS_PER_SECOND = 1000000;
+
+i64 FloorDiv(i64 value, i64 divisor) {
+    return value / divisor - (value % divisor < 0 ? 1 : 0);
+}
+
+char* WritePadded(char* p, ui64 value, int width) {
+    for (int i = width - 1; i >= 0; --i) {
+        p[i] = '0' + value % 10;
+        value /= 10;
+    }
+    return p + width;
+}
+
+char* WriteYear(char* p, i64 year) {
+    if (year < 0) {
+        *p++ = '-';
+        year = -year;
+    }
+    if (year > 9999) {
+        return std::to_chars(p, p + 20, year).ptr;
+    }
+    return WritePadded(p, year, 4);
+}
+
+// Proleptic Gregorian calendar date of the day since the epoch, days may be negative
+char* WriteDate(char* p, i64 days) {
+    days += 719468;
+    const i64 era = FloorDiv(days, 146097);
+    const i64 dayOfEra = days - era * 146097;
+    const i64 yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const i64 dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const i64 shiftedMonth = (5 * dayOfYear + 2) / 153;
+    const i64 day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+    const i64 month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    const i64 year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+    p = WriteYear(p, year);
+    *p++ = '-';
+    p = WritePadded(p, month, 2);
+    *p++ = '-';
+    return WritePadded(p, day, 2);
+}
+
+char* WriteDatetime(char* p, i64 seconds) {
+    const i64 days = FloorDiv(seconds, SECONDS_PER_DAY);
+    const i64 secondOfDay = seconds - days * SECONDS_PER_DAY;
+
+    p = WriteDate(p, days);
+    *p++ = 'T';
+    p = WritePadded(p, secondOfDay / 3600, 2);
+    *p++ = ':';
+    p = WritePadded(p, secondOfDay / 60 % 60, 2);
+    *p++ = ':';
+    return WritePadded(p, secondOfDay % 60, 2);
+}
+
+char* WriteTimestamp(char* p, i64 microseconds) {
+    const i64 seconds = FloorDiv(microseconds, MICROSECONDS_PER_SECOND);
+
+    p = WriteDatetime(p, seconds);
+    *p++ = '.';
+    return WritePadded(p, microseconds - seconds * MICROSECONDS_PER_SECOND, 6);
+}
+
+template <typename T>
+TStringBuf FormatNumber(char* buf, T value) {
+    return TStringBuf(buf, std::to_chars(buf, buf + FORMAT_BUFFER_SIZE, value).ptr);
+}
+
+enum class ETextKind {
+    Literal, // number or boolean, written without quotes in JSON
+    Text,
+    Binary,
+};
+
+struct TPrimitiveText {
+    TStringBuf Text;
+    ETextKind Kind;
+};
+
+// Text of a primitive value, either in buf or in the value itself
+TPrimitiveText FormatPrimitive(Ydb::Type::PrimitiveTypeId typeId, const Ydb::Value& value, char* buf) {
+    switch (typeId) {
+        case Ydb::Type::BOOL:
+            return {value.bool_value() ? TStringBuf("true") : TStringBuf("false"), ETextKind::Literal};
+        case Ydb::Type::INT8:
+        case Ydb::Type::INT16:
+        case Ydb::Type::INT32:
+            return {FormatNumber(buf, value.int32_value()), ETextKind::Literal};
+        case Ydb::Type::UINT8:
+        case Ydb::Type::UINT16:
+        case Ydb::Type::UINT32:
+            return {FormatNumber(buf, value.uint32_value()), ETextKind::Literal};
+        case Ydb::Type::INT64:
+        case Ydb::Type::INTERVAL:
+        case Ydb::Type::INTERVAL64:
+            return {FormatNumber(buf, value.int64_value()), ETextKind::Literal};
+        case Ydb::Type::UINT64:
+            return {FormatNumber(buf, value.uint64_value()), ETextKind::Literal};
+        case Ydb::Type::FLOAT:
+            if (!std::isfinite(value.float_value())) {
+                return {FormatNumber(buf, value.float_value()), ETextKind::Text};
+            }
+            return {FormatNumber(buf, value.float_value()), ETextKind::Literal};
+        case Ydb::Type::DOUBLE:
+            if (!std::isfinite(value.double_value())) {
+                return {FormatNumber(buf, value.double_value()), ETextKind::Text};
+            }
+            return {FormatNumber(buf, value.double_value()), ETextKind::Literal};
+        case Ydb::Type::DATE:
+            return {TStringBuf(buf, WriteDate(buf, value.uint32_value())), ETextKind::Text};
+        case Ydb::Type::DATE32:
+            return {TStringBuf(buf, WriteDate(buf, value.int32_value())), ETextKind::Text};
+        case Ydb::Type::DATETIME: {
+            char* end = WriteDatetime(buf, value.uint32_value());
+            *end++ = 'Z';
+            return {TStringBuf(buf, end), ETextKind::Text};
+        }
+        case Ydb::Type::DATETIME64: {
+            char* end = WriteDatetime(buf, value.int64_value());
+            *end++ = 'Z';
+            return {TStringBuf(buf, end), ETextKind::Text};
+        }
+        case Ydb::Type::TIMESTAMP: {
+            char* end = WriteTimestamp(buf, static_cast<i64>(value.uint64_value()));
+            *end++ = 'Z';
+            return {TStringBuf(buf, end), ETextKind::Text};
+        }
+        case Ydb::Type::TIMESTAMP64: {
+            char* end = WriteTimestamp(buf, value.int64_value());
+            *end++ = 'Z';
+            return {TStringBuf(buf, end), ETextKind::Text};
+        }
+        case Ydb::Type::UUID:
+            NUuid::UuidHalfsToChars(value.low_128(), value.high_128(), buf);
+            return {TStringBuf(buf, NUuid::UUID_TEXT_LEN), ETextKind::Text};
+        case Ydb::Type::STRING:
+        case Ydb::Type::YSON:
+            return {value.bytes_value(), ETextKind::Binary};
+        case Ydb::Type::UTF8:
+        case Ydb::Type::JSON:
+        case Ydb::Type::JSON_DOCUMENT:
+        case Ydb::Type::DYNUMBER:
+        case Ydb::Type::TZ_DATE:
+        case Ydb::Type::TZ_DATETIME:
+        case Ydb::Type::TZ_TIMESTAMP:
+            return {value.text_value(), ETextKind::Text};
+        default:
+            ythrow yexception() << "unsupported primitive type " << Ydb::Type::PrimitiveTypeId_Name(typeId);
+    }
+}
+
+TStringBuf FormatDecimal(const Ydb::DecimalType& type, const Ydb::Value& value) {
+    const char* text = NDecimal::ToString(NDecimal::FromHalfs(value.low_128(), value.high_128()),
+        type.precision(), type.scale());
+    return text ? TStringBuf(text) : TStringBuf();
+}
+
+// Value under the optional wrappers, null if one of them is empty. Mirrors TValueParser::OpenOptional.
+const Ydb::Value* UnwrapOptional(const Ydb::Value& value, ui32 depth) {
+    const Ydb::Value* current = &value;
+    for (ui32 i = 0; i < depth; ++i) {
+        if (current->value_case() == Ydb::Value::kNestedValue) {
+            current = &current->nested_value();
+        } else if (current->value_case() == Ydb::Value::kNullFlagValue) {
+            return nullptr;
+        }
+    }
+    return current;
+}
+
+// Formatting of a column is chosen once for its type: optional levels are unwrapped
+// and primitive columns skip the generic type dispatch
+struct TColumnFormat {
+    const Ydb::Type* Type;
+    ui32 OptionalDepth = 0;
+    std::optional<Ydb::Type::PrimitiveTypeId> Primitive;
+};
+
+std::vector<TColumnFormat> MakeColumnFormats(const Ydb::ResultSet& resultSet) {
+    std::vector<TColumnFormat> formats;
+    formats.reserve(resultSet.columns_size());
+    for (const auto& column : resultSet.columns()) {
+        TColumnFormat format;
+        format.Type = &column.type();
+        while (format.Type->has_optional_type()) {
+            format.Type = &format.Type->optional_type().item();
+            ++format.OptionalDepth;
+        }
+        if (format.Type->has_type_id()) {
+            format.Primitive = format.Type->type_id();
+        }
+        formats.push_back(format);
+    }
+    return formats;
+}
+
+// Writes values of any type as JSON: lists and tuples as arrays, structs as objects,
+// dicts as arrays of [key, payload] pairs and variants as [index or name, value]
+class TJsonValueWriter {
+public:
+    explicit TJsonValueWriter(bool binaryAsBase64)
+        : BinaryAsBase64_(binaryAsBase64)
+    {}
+
+    void WritePrimitive(NJsonWriter::TBuf& json, Ydb::Type::PrimitiveTypeId typeId, const Ydb::Value& value) {
+        const auto text = FormatPrimitive(typeId, value, Buffer_);
+        switch (text.Kind) {
+            case ETextKind::Literal:
+                json.UnsafeWriteValue(text.Text);
+                break;
+            case ETextKind::Text:
+                json.WriteString(text.Text);
+                break;
+            case ETextKind::Binary:
+                if (BinaryAsBase64_) {
+                    Base64Encode(text.Text, Base64_);
+                    json.WriteString(Base64_);
+                } else {
+                    json.WriteString(text.Text);
+                }
+                break;
+        }
+    }
+
+    void Write(NJsonWriter::TBuf& json, const Ydb::Type& type, const Ydb::Value& value) {
+        switch (type.type_case()) {
+            case Ydb::Type::kTypeId:
+                WritePrimitive(json, type.type_id(), value);
+                break;
+            case Ydb::Type::kDecimalType:
+                json.WriteString(FormatDecimal(type.decimal_type(), value));
+                break;
+            case Ydb::Type::kOptionalType:
+                if (auto* item = UnwrapOptional(value, 1)) {
+                    Write(json, type.optional_type().item(), *item);
+                } else {
+                    json.WriteNull();
+                }
+                break;
+            case Ydb::Type::kListType:
+                json.BeginList();
+                for (const auto& item : value.items()) {
+                    Write(json, type.list_type().item(), item);
+                }
+                json.EndList();
+                break;
+            case Ydb::Type::kTupleType:
+                json.BeginList();
+                for (int i = 0; i < value.items_size(); ++i) {
+                    Write(json, type.tuple_type().elements(i), value.items(i));
+                }
+                json.EndList();
+                break;
+            case Ydb::Type::kStructType:
+                json.BeginObject();
+                for (int i = 0; i < value.items_size(); ++i) {
+                    const auto& member = type.struct_type().members(i);
+                    json.WriteKey(member.name());
+                    Write(json, member.type(), value.items(i));
+                }
+                json.EndObject();
+                break;
+            case Ydb::Type::kDictType:
+                json.BeginList();
+                for (const auto& pair : value.pairs()) {
+                    json.BeginList();
+                    Write(json, type.dict_type().key(), pair.key());
+                    Write(json, type.dict_type().payload(), pair.payload());
+                    json.EndList();
+                }
+                json.EndList();
+                break;
+            case Ydb::Type::kVariantType: {
+                const auto& variant = type.variant_type();
+                const auto index = value.variant_index();
+                json.BeginList();
+                if (variant.has_tuple_items()) {
+                    json.WriteULongLong(index);
+                    Write(json, variant.tuple_items().elements(index), value.nested_value());
+                } else {
+                    const auto& member = variant.struct_items().members(index);
+                    json.WriteString(member.name());
+                    Write(json, member.type(), value.nested_value());
+                }
+                json.EndList();
+                break;
+            }
+            case Ydb::Type::kTaggedType:
+                Write(json, type.tagged_type().type(), value);
+                break;
+            case Ydb::Type::kPgType:
+                if (value.value_case() == Ydb::Value::kNullFlagValue) {
+                    json.WriteNull();
+                } else {
+                    json.WriteString(value.value_case() == Ydb::Value::kTextValue ? value.text_value() : value.bytes_value());
+                }
+                break;
+            case Ydb::Type::kEmptyListType:
+            case Ydb::Type::kEmptyDictType:
+                json.BeginList();
+                json.EndList();
+                break;
+            default:
+                json.WriteNull();
+                break;
+        }
+    }
+
+private:
+    const bool BinaryAsBase64_;
+    char Buffer_[FORMAT_BUFFER_SIZE];
+    std::string Base64_;
+};
+
+class TResultSetWriterBase : public IResultSetWriter {
+public:
+    explicit TResultSetWriterBase(IOutputStream& out)
+        : Out_(out)
+    {
+        Buffer_.reserve(FLUSH_SIZE);
+    }
+
+    void Write(const TResultSet& resultSet) override {
+        const auto& proto = TProtoAccessor::GetProto(resultSet);
+        if (Formats_.empty()) {
+            Formats_ = MakeColumnFormats(proto);
+            OnColumns(proto);
+        } else {
+            Y_ENSURE(static_cast<size_t>(proto.columns_size()) == Formats_.size(),
+                "result set has " << proto.columns_size() << " columns, previous parts had " << Formats_.size());
+        }
+
+        for (const auto& row : proto.rows()) {
+            WriteRow(row);
+            if (Buffer_.size() >= FLUSH_SIZE) {
+                Flush();
+            }
+        }
+        Flush();
+    }
+
+protected:
+    virtual void OnColumns(const Ydb::ResultSet& resultSet) = 0;
+    virtual void WriteRow(const Ydb::Value& row) = 0;
+
+    void Flush() {
+        Out_.Write(Buffer_.data(), Buffer_.size());
+        Buffer_.clear();
+    }
+
+protected:
+    IOutputStream& Out_;
+    TString Buffer_;
+    std::vector<TColumnFormat> Formats_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TCsvWriter : public TResultSetWriterBase {
+public:
+    TCsvWriter(IOutputStream& out, const TCsvWriterSettings& settings)
+        : TResultSetWriterBase(out)
+        , Settings_(settings)
+        , JsonWriter_(false)
+    {
+        SpecialChars_[0] = Settings_.Delimiter_;
+    }
+
+private:
+    void OnColumns(const Ydb::ResultSet& resultSet) override {
+        if (!Settings_.Header_) {
+            return;
+        }
+        for (int i = 0; i < resultSet.columns_size(); ++i) {
+            if (i) {
+                Buffer_.push_back(Settings_.Delimiter_);
+            }
+            WriteField(resultSet.columns(i).name());
+        }
+        Buffer_.push_back('\n');
+    }
+
+    void WriteRow(const Ydb::Value& row) override {
+        for (size_t i = 0; i < Formats_.size(); ++i) {
+            if (i) {
+                Buffer_.push_back(Settings_.Delimiter_);
+            }
+
+            const auto& format = Formats_[i];
+            const auto* value = UnwrapOptional(row.items(i), format.OptionalDepth);
+            if (!value) {
+                Buffer_.append(Settings_.NullValue_);
+            } else if (format.Primitive) {
+                const auto text = FormatPrimitive(*format.Primitive, *value, FormatBuffer_);
+                if (text.Kind == ETextKind::Literal) {
+                    Buffer_.append(text.Text);
+                } else {
+                    WriteField(text.Text);
+                }
+            } else if (format.Type->has_decimal_type()) {
+                Buffer_.append(FormatDecimal(format.Type->decimal_type(), *value));
+            } else {
+                Json_.clear();
+                TStringOutput output(Json_);
+                NJsonWriter::TBuf json(NJsonWriter::HEM_DONT_ESCAPE_HTML, &output);
+                JsonWriter_.Write(json, *format.Type, *value);
+                WriteField(Json_);
+            }
+        }
+        Buffer_.push_back('\n');
+    }
+
+    void WriteField(TStringBuf text) {
+        if (text.find_first_of(TStringBuf(SpecialChars_, sizeof(SpecialChars_))) == TStringBuf::npos) {
+            Buffer_.append(text);
+            return;
+        }
+
+        Buffer_.push_back('"');
+        for (char c : text) {
+            if (c == '"') {
+                Buffer_.push_back('"');
+            }
+            Buffer_.push_back(c);
+        }
+        Buffer_.push_back('"');
+    }
+
+private:
+    const TCsvWriterSettings Settings_;
+    char SpecialChars_[4] = {',', '"', '\r', '\n'};
+    char FormatBuffer_[FORMAT_BUFFER_SIZE];
+    TJsonValueWriter JsonWriter_;
+    TString Json_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TJsonLinesWriter : public TResultSetWriterBase {
+public:
+    TJsonLinesWriter(IOutputStream& out, const TJsonLinesWriterSettings& settings)
+        : TResultSetWriterBase(out)
+        , JsonWriter_(settings.BinaryAsBase64_)
+        , Output_(Buffer_)
+    {}
+
+private:
+    void OnColumns(const Ydb::ResultSet& resultSet) override {
+        // Column names are escaped once and written as is for every row
+        for (const auto& column : resultSet.columns()) {
+            NJsonWriter::TBuf json;
+            json.WriteString(column.name());
+            const auto& quoted = json.Str();
+            EscapedNames_.emplace_back(quoted.substr(1, quoted.size() - 2));
+        }
+    }
+
+    void WriteRow(const Ydb::Value& row) override {
+        NJsonWriter::TBuf json(NJsonWriter::HEM_DONT_ESCAPE_HTML, &Output_);
+        json.BeginObject();
+        for (size_t i = 0; i < Formats_.size(); ++i) {
+            json.UnsafeWriteKey(EscapedNames_[i]);
+
+            const auto& format = Formats_[i];
+            const auto* value = UnwrapOptional(row.items(i), format.OptionalDepth);
+            if (!value) {
+                json.WriteNull();
+            } else if (format.Primitive) {
+                JsonWriter_.WritePrimitive(json, *format.Primitive, *value);
+            } else {
+                JsonWriter_.Write(json, *format.Type, *value);
+            }
+        }
+        json.EndObject();
+        Buffer_.push_back('\n');
+    }
+
+private:
+    TJsonValueWriter JsonWriter_;
+    TStringOutput Output_;
+    std::vector<std::string> EscapedNames_;
+};
+
+} // namespace
+
+std::unique_ptr<IResultSetWriter> CreateCsvWriter(IOutputStream& out, const TCsvWriterSettings& settings) {
+    return std::make_unique<TCsvWriter>(out, settings);
+}
+
+std::unique_ptr<IResultSetWriter> CreateJsonLinesWriter(IOutputStream& out, const TJsonLinesWriterSettings& settings) {
+    return std::make_unique<TJsonLinesWriter>(out, settings);
+}
+
+} // namespace NYdb
@@ -0,0 +1,205 @@
+#include <ydb-cpp-sdk/client/table/csv_upsert.h>
+
+#include <src/client/table/impl/csv_splitter.h>
+
+#include <util/system/filemap.h>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace NYdb::inline V3 {
+namespace NTable {
+
+using namespace NThreading;
+
+namespace {
+
+// Sends chunks by BulkUpsert requests, at most MaxInFlight at once
+class TCsvUploader {
+public:
+    TCsvUploader(TTableClient& client, const std::string& table, const TCsvUpsertSettings& settings,
+        const Ydb::Formats::CsvSettings& csvSettings, const TCsvFormat& format, std::string&& header)
+        : Client_(client)
+        , Table_(table)
+        , Settings_(settings)
+        , BulkUpsertSettings_(settings.BulkUpsertSettings_)
+        , Format_(format)
+        , Header_(std::move(header))
+        , Start_(TInstant::Now())
+    {
+        // Every request has its own header and nothing to skip
+        auto requestCsvSettings = csvSettings;
+        requestCsvSettings.set_skip_rows(0);
+        BulkUpsertSettings_.FormatSettings(requestCsvSettings.SerializeAsString());
+    }
+
+    // Blocks while MaxInFlight requests are running, false after a request has failed
+    bool Upload(std::string_view chunk) {
+        if (chunk.empty()) {
+            return true;
+        }
+
+        auto data = std::make_shared<std::string>();
+        data->reserve(Header_.size() + chunk.size());
+        data->append(Header_).append(chunk);
+        const uint64_t rows = Format_.CountRows(chunk);
+
+        {
+            std::unique_lock guard(Lock_);
+            CanSend_.wait(guard, [this]() {
+                return Error_ || InFlight_ < std::max<uint32_t>(Settings_.MaxInFlight_, 1);
+            });
+            if (Error_) {
+                return false;
+            }
+            ++InFlight_;
+        }
+
+        Client_.RetryOperation([table = Table_, data, settings = BulkUpsertSettings_](TTableClient& client) {
+            return client.BulkUpsert(table, EDataFormat::CSV, *data, {}, settings)
+                .Apply([](const TAsyncBulkUpsertResult& future) {
+                    return TStatus(future.GetValue());
+                });
+        }, Settings_.RetrySettings_).Subscribe([this, rows, bytes = chunk.size()](const TAsyncStatus& future) {
+            OnDone(future.GetValue(), rows, bytes);
+        });
+        return true;
+    }
+
+    TCsvUpsertResult Finish() {
+        std::unique_lock guard(Lock_);
+        CanSend_.wait(guard, [this]() {
+            return InFlight_ == 0;
+        });
+        Progress_.Elapsed = TInstant::Now() - Start_;
+        return TCsvUpsertResult(Error_ ? TStatus(*Error_) : TStatus(EStatus::SUCCESS, {}), Progress_);
+    }
+
+private:
+    void OnDone(const TStatus& status, uint64_t rows, uint64_t bytes) {
+        std::optional<TCsvUpsertProgress> progress;
+        {
+            std::lock_guard guard(Lock_);
+            if (status.IsSuccess()) {
+                Progress_.Rows += rows;
+                Progress_.Bytes += bytes;
+                ++Progress_.Requests;
+                Progress_.Elapsed = TInstant::Now() - Start_;
+                progress = Progress_;
+            } else if (!Error_) {
+                Error_ = status;
+            }
+        }
+
+        if (progress && Settings_.ProgressCallback_) {
+            Settings_.ProgressCallback_(*progress);
+        }
+
+        // The uploader may be destroyed as soon as the last request is accounted
+        std::lock_guard guard(Lock_);
+        --InFlight_;
+        CanSend_.notify_all();
+    }
+
+private:
+    TTableClient Client_;
+    const std::string Table_;
+    const TCsvUpsertSettings Settings_;
+    TBulkUpsertSettings BulkUpsertSettings_;
+    const TCsvFormat Format_;
+    const std::string Header_;
+    const TInstant Start_;
+
+    std::mutex Lock_;
+    std::condition_variable CanSend_;
+    uint32_t InFlight_ = 0;
+    std::optional<TStatus> Error_;
+    TCsvUpsertProgress Progress_;
+};
+
+std::optional<TCsvUpsertResult> ParseCsvSettings(const TCsvUpsertSettings& settings, Ydb::Formats::CsvSettings& csvSettings) {
+    const auto& formatSettings = settings.BulkUpsertSettings_.FormatSettings_;
+    if (!formatSettings.empty() && !csvSettings.ParseFromString(TStringType{formatSettings})) {
+        NYdb::NIssue::TIssues issues;
+        issues.AddIssue(NYdb::NIssue::TIssue("FormatSettings is not a serialized Ydb.Formats.CsvSettings"));
+        return TCsvUpsertResult(TStatus(EStatus::BAD_REQUEST, std::move(issues)), {});
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+double TCsvUpsertProgress::GetRowsPerSecond() const {
+    return Elapsed ? Rows / Elapsed.SecondsFloat() : 0;
+}
+
+double TCsvUpsertProgress::GetBytesPerSecond() const {
+    return Elapsed ? Bytes / Elapsed.SecondsFloat() : 0;
+}
+
+TCsvUpsertResult::TCsvUpsertResult(TStatus&& status, const TCsvUpsertProgress& progress)
+    : TStatus(std::move(status))
+    , Progress_(progress)
+{}
+
+const TCsvUpsertProgress& TCsvUpsertResult::GetProgress() const {
+    return Progress_;
+}
+
+TCsvUpsertResult BulkUpsertCsvFile(TTableClient& client, const std::string& table, const std::string& path,
+    const TCsvUpsertSettings& settings)
+{
+    Ydb::Formats::CsvSettings csvSettings;
+    if (auto error = ParseCsvSettings(settings, csvSettings)) {
+        return std::move(*error);
+    }
+    const TCsvFormat format(csvSettings);
+
+    std::optional<TFileMap> map;
+    std::string_view data;
+    try {
+        map.emplace(TString(path), TMemoryMapCommon::oRdOnly);
+        if (map->Length() > 0) {
+            map->Map(0, map->Length());
+            data = std::string_view(static_cast<const char*>(map->Ptr()), map->MappedSize());
+        }
+    } catch (const TFileError& e) {
+        NYdb::NIssue::TIssues issues;
+        issues.AddIssue(NYdb::NIssue::TIssue("Can't map " + path + ": " + e.what()));
+        return TCsvUpsertResult(TStatus(EStatus::BAD_REQUEST, std::move(issues)), {});
+    }
+
+    std::string header;
+    const size_t bodyStart = ParseCsvPreamble(data, csvSettings, format, header).value_or(data.size());
+    const auto body = data.substr(bodyStart);
+
+    TCsvUploader uploader(client, table, settings, csvSettings, format, std::move(header));
+    size_t begin = 0;
+    for (size_t end : SplitCsvRows(body, format, settings.ChunkSize_, settings.SplitThreads_)) {
+        if (!uploader.Upload(body.substr(begin, end - begin))) {
+            break;
+        }
+        begin = end;
+    }
+    return uploader.Finish();
+}
+
+TCsvUpsertResult BulkUpsertCsv(TTableClient& client, const std::string& table, IInputStream& input,
+    const TCsvUpsertSettings& settings)
+{
+    Ydb::Formats::CsvSettings csvSettings;
+    if (auto error = ParseCsvSettings(settings, csvSettings)) {
+        return std::move(*error);
+    }
+    const TCsvFormat format(csvSettings);
+
+    TCsvStreamSplitter splitter(input, csvSettings, format, settings.ChunkSize_);
+    TCsvUploader uploader(client, table, settings, csvSettings, format, std::string(splitter.GetHeader()));
+    std::string_view chunk;
+    while (splitter.Next(chunk) && uploader.Upload(chunk)) {
+    }
+    return uploader.Finish();
+}
+
+} // namespace NTable
+} // namespace NYdb
@@ -0,0 +1,189 @@
+#include "csv_splitter.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace NYdb::inline V3 {
+namespace NTable {
+
+TCsvFormat::TCsvFormat(const Ydb::Formats::CsvSettings& settings)
+    : Quoting_(!settings.quoting().disabled())
+    , Quote_(settings.quoting().quote_char().empty() ? '"' : settings.quoting().quote_char()[0])
+{}
+
+size_t TCsvFormat::FindRowEnd(std::string_view data, size_t from, bool& inQuotes) const {
+    if (!Quoting_) {
+        const size_t pos = data.find('\n', from);
+        return pos == std::string_view::npos ? pos : pos + 1;
+    }
+
+    const char special[] = {'\n', Quote_};
+    for (size_t pos = from; ; ++pos) {
+        pos = data.find_first_of(std::string_view(special, sizeof(special)), pos);
+        if (pos == std::string_view::npos) {
+            return pos;
+        }
+        if (data[pos] == Quote_) {
+            inQuotes = !inQuotes;
+        } else if (!inQuotes) {
+            return pos + 1;
+        }
+    }
+}
+
+bool TCsvFormat::ChangesQuoteState(std::string_view data) const {
+    return Quoting_ && std::count(data.begin(), data.end(), Quote_) % 2 == 1;
+}
+
+uint64_t TCsvFormat::CountRows(std::string_view data) const {
+    uint64_t rows = 0;
+    bool inQuotes = false;
+    for (size_t pos = 0; (pos = FindRowEnd(data, pos, inQuotes)) != std::string_view::npos; ) {
+        ++rows;
+    }
+    if (!data.empty() && data.back() != '\n') {
+        ++rows;
+    }
+    return rows;
+}
+
+std::optional<size_t> ParseCsvPreamble(std::string_view data, const Ydb::Formats::CsvSettings& settings,
+    const TCsvFormat& format, std::string& header)
+{
+    size_t pos = 0;
+    for (uint32_t i = 0; i < settings.skip_rows(); ++i) {
+        pos = data.find('\n', pos);
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        ++pos;
+    }
+
+    if (settings.header()) {
+        bool inQuotes = false;
+        const size_t end = format.FindRowEnd(data, pos, inQuotes);
+        if (end == std::string_view::npos) {
+            return std::nullopt;
+        }
+        header = data.substr(pos, end - pos);
+        pos = end;
+    }
+    return pos;
+}
+
+std::vector<size_t> SplitCsvRows(std::string_view data, const TCsvFormat& format, uint64_t chunkSize, uint32_t threads) {
+    chunkSize = std::max<uint64_t>(chunkSize, 1);
+    const size_t regionsCount = std::clamp<size_t>(data.size() / chunkSize, 1, std::max<uint32_t>(threads, 1));
+    const size_t regionSize = (data.size() + regionsCount - 1) / regionsCount;
+
+    auto region = [&](size_t index) {
+        const size_t begin = std::min(index * regionSize, data.size());
+        return std::make_pair(begin, std::min(begin + regionSize, data.size()));
+    };
+
+    auto runRegions = [regionsCount](const std::function<void(size_t)>& func) {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < regionsCount; ++i) {
+            workers.emplace_back(func, i);
+        }
+        func(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    std::vector<char> startsInQuotes(regionsCount, false);
+    runRegions([&](size_t index) {
+        if (index + 1 < regionsCount) {
+            auto [begin, end] = region(index);
+            startsInQuotes[index + 1] = format.ChangesQuoteState(data.substr(begin, end - begin));
+        }
+    });
+    for (size_t i = 1; i < regionsCount; ++i) {
+        startsInQuotes[i] ^= startsInQuotes[i - 1];
+    }
+
+    std::vector<std::vector<size_t>> regionCuts(regionsCount);
+    runRegions([&](size_t index) {
+        auto [begin, end] = region(index);
+        bool inQuotes = startsInQuotes[index];
+        size_t pos = begin;
+        for (uint64_t target = (begin / chunkSize + 1) * chunkSize; target < end; ) {
+            inQuotes ^= format.ChangesQuoteState(data.substr(pos, target - pos));
+            // May run past the end of the region, the quote state is still known
+            const size_t cut = format.FindRowEnd(data, target, inQuotes);
+            if (cut == std::string_view::npos) {
+                break;
+            }
+            regionCuts[index].push_back(cut);
+            pos = cut;
+            inQuotes = false;
+            target = (cut / chunkSize + 1) * chunkSize;
+        }
+    });
+
+    std::vector<size_t> cuts;
+    for (const auto& partCuts : regionCuts) {
+        cuts.insert(cuts.end(), partCuts.begin(), partCuts.end());
+    }
+    cuts.push_back(data.size());
+    std::sort(cuts.begin(), cuts.end());
+    cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+    return cuts;
+}
+
+TCsvStreamSplitter::TCsvStreamSplitter(IInputStream& input, const Ydb::Formats::CsvSettings& settings,
+    const TCsvFormat& format, uint64_t chunkSize)
+    : Input_(input)
+    , Format_(format)
+    , ReadSize_(std::max<uint64_t>(chunkSize, 1))
+{
+    std::optional<size_t> bodyStart;
+    while (!bodyStart && !Eof_) {
+        Read();
+        bodyStart = ParseCsvPreamble(Buffer_, settings, Format_, Header_);
+    }
+    Buffer_.erase(0, bodyStart.value_or(Buffer_.size()));
+}
+
+bool TCsvStreamSplitter::Next(std::string_view& chunk) {
+    if (Consumed_) {
+        Buffer_.erase(0, Consumed_);
+        Scanned_ -= Consumed_;
+        RowsEnd_ = 0;
+        Consumed_ = 0;
+    }
+
+    while (!Done_) {
+        // Rows are returned as soon as a chunk worth of data is read
+        for (size_t pos = Scanned_; (pos = Format_.FindRowEnd(Buffer_, pos, InQuotes_)) != std::string::npos; ) {
+            RowsEnd_ = pos;
+        }
+        Scanned_ = Buffer_.size();
+
+        if (Eof_) {
+            Done_ = true;
+            chunk = Buffer_;
+            return !chunk.empty();
+        }
+        if (RowsEnd_ >= ReadSize_) {
+            chunk = std::string_view(Buffer_).substr(0, RowsEnd_);
+            Consumed_ = RowsEnd_;
+            return true;
+        }
+        Read();
+    }
+    return false;
+}
+
+void TCsvStreamSplitter::Read() {
+    const size_t size = Buffer_.size();
+    Buffer_.resize(size + ReadSize_);
+    const size_t loaded = Input_.Load(Buffer_.data() + size, ReadSize_);
+    Buffer_.resize(size + loaded);
+    Eof_ = loaded < ReadSize_;
+}
+
+} // namespace NTable
+} // namespace NYdb
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <src/api/protos/ydb_formats.pb.h>
+
+#include <util/stream/input.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NYdb::inline V3 {
+namespace NTable {
+
+// Row boundaries of CSV data. Quote characters are expected to enclose whole fields,
+// a doubled quote inside a quoted field toggles the quote state twice.
+class TCsvFormat {
+public:
+    explicit TCsvFormat(const Ydb::Formats::CsvSettings& settings);
+
+    // Position after the first line break at or after from that is not inside quotes, npos if there is none.
+    // inQuotes is the state at from and is updated up to the returned position or the end of data.
+    size_t FindRowEnd(std::string_view data, size_t from, bool& inQuotes) const;
+
+    // Whether the quote state changes across data
+    bool ChangesQuoteState(std::string_view data) const;
+
+    uint64_t CountRows(std::string_view data) const;
+
+private:
+    const bool Quoting_;
+    const char Quote_;
+};
+
+// Skips skip_rows lines and reads the header row, returns the position of the first data row
+// or nullopt if the data ends before that
+std::optional<size_t> ParseCsvPreamble(std::string_view data, const Ydb::Formats::CsvSettings& settings,
+    const TCsvFormat& format, std::string& header);
+
+// Ends of row aligned chunks of about chunkSize bytes, the last one is the end of data.
+// The data is split into regions scanned by separate threads: the first pass finds the quote state
+// at the start of every region, the second one finds the first row end after every multiple of chunkSize.
+std::vector<size_t> SplitCsvRows(std::string_view data, const TCsvFormat& format, uint64_t chunkSize, uint32_t threads);
+
+// Reads row aligned chunks of at least chunkSize bytes from a stream, the incomplete last row
+// is carried over to the next chunk. The preamble is read by the constructor.
+class TCsvStreamSplitter {
+public:
+    TCsvStreamSplitter(IInputStream& input, const Ydb::Formats::CsvSettings& settings,
+        const TCsvFormat& format, uint64_t chunkSize);
+
+    const std::string& GetHeader() const {
+        return Header_;
+    }
+
+    // False after the end of input, the chunk is valid until the next call
+    bool Next(std::string_view& chunk);
+
+private:
+    void Read();
+
+private:
+    IInputStream& Input_;
+    const TCsvFormat& Format_;
+    const size_t ReadSize_;
+
+    std::string Header_;
+    std::string Buffer_;
+    // Data is scanned for row ends up to Scanned_, the last one found is RowsEnd_
+    size_t Scanned_ = 0;
+    size_t RowsEnd_ = 0;
+    bool InQuotes_ = false;
+    // Size of the chunk returned last, it is dropped from the buffer by the next call
+    size_t Consumed_ = 0;
+    bool Eof_ = false;
+    bool Done_ = false;
+};
+
+} // namespace NTable
+} // namespace NYdb
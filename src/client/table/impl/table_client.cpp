@@ -6,7 +6,9 @@ namespace NTable {
 
 using namespace NThreading;
 
-const TKeepAliveSettings TTableClient::TImpl::KeepAliveSettings = TKeepAliveSettings().ClientTimeout(KEEP_ALIVE_CLIENT_TIMEOUT);
+const TKeepAliveSettings TTableClient::TImpl::KeepAliveSettings = TKeepAliveSettings()
+    .ClientTimeout(KEEP_ALIVE_CLIENT_TIMEOUT)
+    .Priority(ERequestPriority::Background);
 
 
 TDuration GetMinTimeToTouch(const TSessionPoolSettings& settings) {
@@ -285,6 +287,12 @@ void TTableClient::TImpl::StartPeriodicHostScanTask() {
     Connections_->AddPeriodicTask(std::move(periodicCb), HOSTSCAN_PERIODIC_ACTION_INTERVAL);
 }
 
+void TTableClient::TImpl::WarmUpSessionPool() {
+    const auto& sessionPoolSettings = Settings_.SessionPoolSettings_;
+    NSessionPool::WarmUpSessions(Min(sessionPoolSettings.WarmUpSessions_, sessionPoolSettings.MaxActiveSessions_),
+        [this] { return GetSession(TCreateSessionSettings()); });
+}
+
 TAsyncCreateSessionResult TTableClient::TImpl::GetSession(const TCreateSessionSettings& settings) {
     using namespace NSessionPool;
 
@@ -341,6 +349,7 @@ TAsyncCreateSessionResult TTableClient::TImpl::GetSession(const TCreateSessionSe
 
     auto ctx = std::make_unique<TTableClientGetSessionCtx>(shared_from_this(), settings.ClientTimeout_);
     auto future = ctx->GetFuture();
+    SessionPool_.RecordAcquireLatency(future);
     SessionPool_.GetSession(std::move(ctx));
     return future;
 }
@@ -1009,6 +1018,9 @@ TAsyncBulkUpsertResult TTableClient::TImpl::BulkUpsert(const std::string& table,
         *request->mutable_rows()->mutable_value() = rows.GetProto();
     }
 
+    auto rpcSettings = TRpcRequestSettings::Make(settings);
+    rpcSettings.Compress = settings.Compress_;
+
     auto promise = NewPromise<TBulkUpsertResult>();
     auto extractor = [promise](google::protobuf::Any* any, TPlainStatus status) mutable {
         Y_UNUSED(any);
@@ -1023,7 +1035,7 @@ TAsyncBulkUpsertResult TTableClient::TImpl::BulkUpsert(const std::string& table,
             &Ydb::Table::V1::TableService::Stub::AsyncBulkUpsert,
             DbDriverState_,
             INITIAL_DEFERRED_CALL_DELAY,
-            TRpcRequestSettings::Make(settings));
+            rpcSettings);
     } else {
         Connections_->RunDeferred<Ydb::Table::V1::TableService, Ydb::Table::BulkUpsertRequest, Ydb::Table::BulkUpsertResponse>(
             std::move(*holder),
@@ -1031,7 +1043,7 @@ TAsyncBulkUpsertResult TTableClient::TImpl::BulkUpsert(const std::string& table,
             &Ydb::Table::V1::TableService::Stub::AsyncBulkUpsert,
             DbDriverState_,
             INITIAL_DEFERRED_CALL_DELAY,
-            TRpcRequestSettings::Make(settings));
+            rpcSettings);
     }
     return promise.GetFuture();
 }
@@ -1055,6 +1067,9 @@ TAsyncBulkUpsertResult TTableClient::TImpl::BulkUpsert(const std::string& table,
     }
     request.set_data(TStringType{data});
 
+    auto rpcSettings = TRpcRequestSettings::Make(settings);
+    rpcSettings.Compress = settings.Compress_;
+
     auto promise = NewPromise<TBulkUpsertResult>();
 
     auto extractor = [promise]
@@ -1070,7 +1085,7 @@ TAsyncBulkUpsertResult TTableClient::TImpl::BulkUpsert(const std::string& table,
         &Ydb::Table::V1::TableService::Stub::AsyncBulkUpsert,
         DbDriverState_,
         INITIAL_DEFERRED_CALL_DELAY,
-        TRpcRequestSettings::Make(settings));
+        rpcSettings);
 
     return promise.GetFuture();
 }
@@ -1253,5 +1268,9 @@ void TTableClient::TImpl::CollectRetryStatSync(EStatus status) {
     RetryOperationStatCollector.IncSyncRetryOperation(status);
 }
 
+void TTableClient::TImpl::CollectRetryRejectedStat(NRetry::ERetryDecision decision) {
+    RetryOperationStatCollector.IncRetryRejected(decision);
+}
+
 } // namespace NTable
 } // namespace NYdb
@@ -4,6 +4,7 @@
 #include <src/client/impl/ydb_internal/session_client/session_client.h>
 #include <src/client/impl/ydb_internal/scheme_helpers/helpers.h>
 #include <src/client/impl/ydb_internal/table_helpers/helpers.h>
+#include <src/client/impl/ydb_internal/make_request/arena_pool.h>
 #include <src/client/impl/ydb_internal/make_request/make.h>
 #include <src/client/impl/ydb_internal/session_pool/session_pool.h>
 #undef INCLUDE_YDB_INTERNAL_H
@@ -50,6 +51,7 @@ public:
         std::unordered_map<ui64, size_t>& sessions, bool allNodes);
     static NMath::TStats CalcCV(const std::unordered_map<ui64, size_t>& in);
     void StartPeriodicHostScanTask();
+    void WarmUpSessionPool();
 
     TAsyncCreateSessionResult GetSession(const TCreateSessionSettings& settings);
     i64 GetActiveSessionCount() const;
@@ -150,6 +152,7 @@ public:
         const TStreamExecScanQuerySettings& settings);
     void CollectRetryStatAsync(EStatus status);
     void CollectRetryStatSync(EStatus status);
+    void CollectRetryRejectedStat(NRetry::ERetryDecision decision);
 
 public:
     TClientSettings Settings_;
@@ -212,9 +215,26 @@ private:
         const TTxControl& txControl, TParamsType params,
         const TExecDataQuerySettings& settings, bool fromCache
     ) {
-        auto request = MakeOperationRequest<Ydb::Table::ExecuteDataQueryRequest>(settings);
-        request.set_session_id(TStringType{session.GetId()});
-        auto txControlProto = request.mutable_tx_control();
+        if constexpr (std::is_pointer_v<TParamsType>) {
+            // Moved params are swapped into the request, it is cheap only if both live on the heap
+            auto request = MakeOperationRequest<Ydb::Table::ExecuteDataQueryRequest>(settings);
+            FillExecuteDataQueryRequest(session, query, txControl, params, settings, &request);
+            return RunExecuteDataQuery(std::move(request), session, query, settings, fromCache);
+        } else {
+            auto arena = TArenaPool::Acquire();
+            auto request = MakeOperationRequestOnArena<Ydb::Table::ExecuteDataQueryRequest>(settings, arena.get());
+            FillExecuteDataQueryRequest(session, query, txControl, params, settings, request);
+            return RunExecuteDataQuery({request, std::move(arena)}, session, query, settings, fromCache);
+        }
+    }
+
+    template <typename TQueryType, typename TParamsType>
+    void FillExecuteDataQueryRequest(const TSession& session, const TQueryType& query,
+        const TTxControl& txControl, TParamsType params,
+        const TExecDataQuerySettings& settings, Ydb::Table::ExecuteDataQueryRequest* request
+    ) {
+        request->set_session_id(TStringType{session.GetId()});
+        auto txControlProto = request->mutable_tx_control();
         txControlProto->set_commit_tx(txControl.CommitTx_);
         if (txControl.Tx_.has_value()) {
             txControlProto->set_tx_id(TStringType{txControl.Tx_->GetId()});
@@ -222,16 +242,23 @@ private:
             SetTxSettings(txControl.BeginTx_, txControlProto->mutable_begin_tx());
         }
 
-        request.set_collect_stats(GetStatsCollectionMode(settings.CollectQueryStats_));
+        request->set_collect_stats(GetStatsCollectionMode(settings.CollectQueryStats_));
 
-        SetQuery(query, request.mutable_query());
+        SetQuery(query, request->mutable_query());
         CollectQuerySize(query, QuerySizeHistogram);
 
-        SetParams(params, &request);
+        SetParams(params, request);
         CollectParams(params, ParamsSizeHistogram);
 
-        SetQueryCachePolicy(query, settings, request.mutable_query_cache_policy());
+        SetQueryCachePolicy(query, settings, request->mutable_query_cache_policy());
+    }
 
+    template <typename TQueryType>
+    TAsyncDataQueryResult RunExecuteDataQuery(
+        TGRpcConnectionsImpl::TRequestWrapper<Ydb::Table::ExecuteDataQueryRequest>&& request,
+        const TSession& session, const TQueryType& query,
+        const TExecDataQuerySettings& settings, bool fromCache
+    ) {
         auto promise = NewPromise<TDataQueryResult>();
         bool keepInCache = settings.KeepInQueryCache_ && settings.KeepInQueryCache_.value();
 
@@ -253,11 +280,13 @@ private:
 
                 auto queryText = GetQueryText(query);
                 if (any) {
-                    Ydb::Table::ExecuteQueryResult result;
+                    // Result sets keep the arena, so rows are parsed without per-message allocations
+                    auto arena = TArenaPool::Acquire();
+                    auto& result = *google::protobuf::Arena::CreateMessage<Ydb::Table::ExecuteQueryResult>(arena.get());
                     any->UnpackTo(&result);
 
                     for (size_t i = 0; i < static_cast<size_t>(result.result_sets_size()); i++) {
-                        res.push_back(TResultSet(*result.mutable_result_sets(i)));
+                        res.push_back(TResultSet(result.mutable_result_sets(i), arena));
                     }
 
                     if (result.has_tx_meta()) {
@@ -0,0 +1,494 @@
+#include <ydb-cpp-sdk/client/table/table.h>
+#include <ydb-cpp-sdk/client/proto/accessor.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+#include <src/client/impl/ydb_internal/retry/retry.h>
+#include <src/client/table/impl/table_client.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace NYdb::inline V3 {
+namespace NTable {
+
+using namespace NThreading;
+
+namespace {
+
+// Key ranges of the shards. With WithKeyShardBoundary the description already covers
+// the whole key space up to the open range of the last shard.
+std::vector<TKeyRange> GetShardRanges(const TTableDescription& description) {
+    std::vector<TKeyRange> ranges = description.GetKeyRanges();
+    if (ranges.empty()) {
+        ranges.emplace_back(std::nullopt, std::nullopt);
+    }
+    return ranges;
+}
+
+// Primary key of the last row of the part as a tuple, if all the key columns were read
+std::optional<TValue> GetLastKey(const TResultSet& part, const std::vector<std::string>& keyColumns) {
+    const auto& resultSet = TProtoAccessor::GetProto(part);
+    if (resultSet.rows_size() == 0 || keyColumns.empty()) {
+        return std::nullopt;
+    }
+
+    Ydb::Type type;
+    Ydb::Value value;
+    const auto& row = resultSet.rows(resultSet.rows_size() - 1);
+    for (const auto& name : keyColumns) {
+        int column = 0;
+        while (column < resultSet.columns_size() && resultSet.columns(column).name() != name) {
+            ++column;
+        }
+        if (column == resultSet.columns_size()) {
+            return std::nullopt;
+        }
+        *type.mutable_tuple_type()->add_elements() = resultSet.columns(column).type();
+        *value.add_items() = row.items(column);
+    }
+    return TValue(TType(std::move(type)), std::move(value));
+}
+
+// Retries of a range stream, a new state is started once the stream makes progress
+class TRangeRetryState : public NRetry::TRetryContextBase {
+public:
+    explicit TRangeRetryState(const TRetryOperationSettings& settings)
+        : TRetryContextBase(settings)
+    {}
+
+    NRetry::NextStep OnFailure(const TStatus& status) {
+        const auto nextStep = GetNextStep(status);
+        if (nextStep != NRetry::NextStep::Finish) {
+            ++RetryNumber_;
+            LogRetry(status);
+        }
+        return nextStep;
+    }
+
+    const TBackoffSettings& GetBackoffSettings(bool fast) const {
+        return fast ? Settings_.FastBackoffSettings_ : Settings_.SlowBackoffSettings_;
+    }
+
+    ui32 GetRetryNumber() const {
+        return RetryNumber_;
+    }
+};
+
+TReadTableResultPart MakeStatusPart(TStatus status) {
+    return TReadTableResultPart(TResultSet(Ydb::ResultSet()), std::move(status));
+}
+
+} // namespace
+
+// Ranges are read by at most MaxStreams streams at once. A stream reads ahead up to MaxBufferedParts
+// parts and waits for ReadNext calls after that. In ordered mode only ranges within MaxStreams
+// of the range being returned are started, so finished ranges can't pile up behind a slow one.
+// Every range is read in key order, so a stream broken by a retryable error is restarted
+// right after the last key it has received.
+class TParallelTablePartIterator::TReaderImpl : public std::enable_shared_from_this<TReaderImpl> {
+public:
+    TReaderImpl(const TTableClient& client, std::shared_ptr<IClientImplCommon> clientImpl, const std::string& path,
+        const TParallelReadTableSettings& settings, std::vector<TKeyRange>&& ranges, const std::vector<std::string>& keyColumns)
+        : Client_(client)
+        , ClientImpl_(std::move(clientImpl))
+        , Path_(path)
+        , Settings_(settings)
+        , RetrySettings_(TRetryOperationSettings(settings.RetrySettings_).Idempotent(true))
+        , KeyColumns_(keyColumns)
+        , Ordered_(settings.ReadTableSettings_.Ordered_)
+        , MaxStreams_(std::max<uint32_t>(settings.MaxStreams_, 1))
+        , MaxBufferedParts_(std::max<uint32_t>(settings.MaxBufferedParts_, 1))
+    {
+        Ranges_.reserve(ranges.size());
+        for (auto& range : ranges) {
+            Ranges_.emplace_back(std::move(range));
+        }
+    }
+
+    void Start() {
+        TActions actions;
+        {
+            std::lock_guard guard(Lock_);
+            StartRanges(actions);
+        }
+        Run(actions);
+    }
+
+    TAsyncParallelReadTablePart ReadNext() {
+        auto promise = NewPromise<TParallelReadTablePart>();
+        TActions actions;
+        {
+            std::lock_guard guard(Lock_);
+            Waiters_.push_back(promise);
+            Deliver(actions);
+        }
+        Run(actions);
+        return promise.GetFuture();
+    }
+
+    size_t GetRangesCount() const {
+        return Ranges_.size();
+    }
+
+private:
+    using TActions = std::vector<std::function<void()>>;
+
+    struct TRange {
+        explicit TRange(TKeyRange&& keyRange)
+            : KeyRange(std::move(keyRange))
+        {}
+
+        TKeyRange KeyRange;
+        std::optional<TSession> Session;
+        std::optional<TTablePartIterator> Iterator;
+        std::deque<TReadTableResultPart> Parts;
+        bool ReadInFlight = false;
+        bool Finished = false;
+        // Progress of the range for restarting a broken stream
+        std::optional<TValue> LastKey;
+        uint64_t RowsReceived = 0;
+        std::unique_ptr<TRangeRetryState> Retry;
+    };
+
+    // Futures may be completed in place, so callbacks are never run under the lock
+    static void Run(TActions& actions) {
+        for (auto& action : actions) {
+            action();
+        }
+    }
+
+    void StartRanges(TActions& actions) {
+        while (!Failed_ && ActiveStreams_ < MaxStreams_ && NextRange_ < Ranges_.size()
+            && (!Ordered_ || NextRange_ < CurrentRange_ + MaxStreams_))
+        {
+            ++ActiveStreams_;
+            actions.emplace_back([self = shared_from_this(), index = NextRange_++]() {
+                self->StartRange(index);
+            });
+        }
+    }
+
+    void StartRange(size_t index) {
+        Client_.GetSession().Subscribe([self = shared_from_this(), index](const TAsyncCreateSessionResult& future) {
+            self->OnSession(index, future.GetValue());
+        });
+    }
+
+    void OnSession(size_t index, const TCreateSessionResult& result) {
+        if (!result.IsSuccess()) {
+            RetryRange(index, TStatus(result));
+            return;
+        }
+
+        auto settings = Settings_.ReadTableSettings_;
+        settings.Ordered(true);
+
+        auto session = result.GetSession();
+        {
+            std::lock_guard guard(Lock_);
+            if (Failed_) {
+                return;
+            }
+            auto& range = Ranges_[index];
+            range.Session = session;
+            settings.From_ = range.LastKey ? TKeyBound::Exclusive(*range.LastKey) : range.KeyRange.From();
+            settings.To_ = range.KeyRange.To();
+            if (settings.RowLimit_) {
+                *settings.RowLimit_ -= range.RowsReceived;
+            }
+        }
+        session.ReadTable(Path_, settings).Subscribe([self = shared_from_this(), index](const TAsyncTablePartIterator& future) {
+            self->OnIterator(index, future.GetValue());
+        });
+    }
+
+    void OnIterator(size_t index, const TTablePartIterator& iterator) {
+        if (!iterator.IsSuccess()) {
+            RetryRange(index, TStatus(iterator));
+            return;
+        }
+
+        TActions actions;
+        {
+            std::lock_guard guard(Lock_);
+            if (Failed_) {
+                return;
+            }
+            Ranges_[index].Iterator = iterator;
+            ReadAhead(index, actions);
+        }
+        Run(actions);
+    }
+
+    void ReadAhead(size_t index, TActions& actions) {
+        auto& range = Ranges_[index];
+        if (!range.Iterator || range.ReadInFlight || range.Finished || range.Parts.size() >= MaxBufferedParts_) {
+            return;
+        }
+
+        range.ReadInFlight = true;
+        actions.emplace_back([self = shared_from_this(), iterator = *range.Iterator, index]() mutable {
+            iterator.ReadNext().Subscribe([self, index](TAsyncSimpleStreamPart<TResultSet> future) {
+                self->OnPart(index, future.ExtractValue());
+            });
+        });
+    }
+
+    void OnPart(size_t index, TReadTableResultPart&& part) {
+        if (!part.EOS() && !part.IsSuccess()) {
+            RetryRange(index, TStatus(part));
+            return;
+        }
+
+        std::optional<TValue> lastKey;
+        uint64_t rows = 0;
+        if (!part.EOS()) {
+            lastKey = GetLastKey(part.GetPart(), KeyColumns_);
+            rows = part.GetPart().RowsCount();
+        }
+
+        TActions actions;
+        {
+            std::lock_guard guard(Lock_);
+            if (Failed_) {
+                return;
+            }
+
+            auto& range = Ranges_[index];
+            range.ReadInFlight = false;
+            if (part.EOS()) {
+                FinishRange(range, actions);
+            } else {
+                if (lastKey) {
+                    range.LastKey = std::move(lastKey);
+                }
+                range.RowsReceived += rows;
+                range.Retry.reset();
+                range.Parts.push_back(std::move(part));
+                if (!Ordered_) {
+                    Ready_.push_back(index);
+                }
+                ReadAhead(index, actions);
+            }
+            Deliver(actions);
+        }
+        Run(actions);
+    }
+
+    void FinishRange(TRange& range, TActions& actions) {
+        range.Finished = true;
+        --ActiveStreams_;
+        ++FinishedRanges_;
+        // The session goes back to the pool
+        actions.emplace_back([iterator = std::move(range.Iterator), session = std::move(range.Session)]() {});
+        range.Iterator.reset();
+        range.Session.reset();
+        range.Retry.reset();
+        StartRanges(actions);
+    }
+
+    // Restarts the stream of the range after a retryable error, fails the reader otherwise
+    void RetryRange(size_t index, TStatus&& status) {
+        TActions actions;
+        bool failed = true;
+        {
+            std::lock_guard guard(Lock_);
+            if (Failed_) {
+                return;
+            }
+
+            auto& range = Ranges_[index];
+            range.ReadInFlight = false;
+            actions.emplace_back([iterator = std::move(range.Iterator), session = std::move(range.Session)]() {});
+            range.Iterator.reset();
+            range.Session.reset();
+
+            const auto& rowLimit = Settings_.ReadTableSettings_.RowLimit_;
+            if (rowLimit && range.RowsReceived >= *rowLimit) {
+                FinishRange(range, actions);
+                Deliver(actions);
+                failed = false;
+            } else if (!range.RowsReceived || range.LastKey) {
+                // Without the last key the rows already received would be read again
+                if (!range.Retry) {
+                    range.Retry = std::make_unique<TRangeRetryState>(RetrySettings_);
+                }
+                const auto nextStep = range.Retry->OnFailure(status);
+                failed = nextStep == NRetry::NextStep::Finish;
+                if (nextStep == NRetry::NextStep::RetryImmediately) {
+                    actions.emplace_back([self = shared_from_this(), index]() {
+                        self->StartRange(index);
+                    });
+                } else if (!failed) {
+                    actions.emplace_back([self = shared_from_this(), index,
+                        backoff = range.Retry->GetBackoffSettings(nextStep == NRetry::NextStep::RetryFastBackoff),
+                        retryNumber = range.Retry->GetRetryNumber()]()
+                    {
+                        NRetry::AsyncBackoff(self->ClientImpl_, backoff, retryNumber, [self, index]() {
+                            self->StartRange(index);
+                        });
+                    });
+                }
+            }
+        }
+        Run(actions);
+
+        if (failed) {
+            Fail(std::move(status));
+        }
+    }
+
+    void Fail(TStatus&& status) {
+        TActions actions;
+        {
+            std::lock_guard guard(Lock_);
+            if (Failed_) {
+                return;
+            }
+            Failed_ = std::move(status);
+            // Streams are cancelled when their iterators are destroyed
+            for (auto& range : Ranges_) {
+                actions.emplace_back([iterator = std::move(range.Iterator), session = std::move(range.Session)]() {});
+                range.Iterator.reset();
+                range.Session.reset();
+                range.Parts.clear();
+            }
+            Ready_.clear();
+            Deliver(actions);
+        }
+        Run(actions);
+    }
+
+    // Index of the range with the next part to return, if any
+    std::optional<size_t> NextReadyRange(TActions& actions) {
+        if (!Ordered_) {
+            if (Ready_.empty()) {
+                return std::nullopt;
+            }
+            const size_t index = Ready_.front();
+            Ready_.pop_front();
+            return index;
+        }
+
+        const size_t current = CurrentRange_;
+        while (CurrentRange_ < Ranges_.size() && Ranges_[CurrentRange_].Finished && Ranges_[CurrentRange_].Parts.empty()) {
+            ++CurrentRange_;
+        }
+        if (CurrentRange_ != current) {
+            StartRanges(actions);
+        }
+        if (CurrentRange_ < Ranges_.size() && !Ranges_[CurrentRange_].Parts.empty()) {
+            return CurrentRange_;
+        }
+        return std::nullopt;
+    }
+
+    void Deliver(TActions& actions) {
+        while (!Waiters_.empty()) {
+            auto promise = Waiters_.front();
+
+            if (Failed_) {
+                actions.emplace_back([promise, status = *Failed_]() mutable {
+                    promise.SetValue(TParallelReadTablePart(MakeStatusPart(std::move(status)), 0));
+                });
+            } else if (auto index = NextReadyRange(actions)) {
+                auto& range = Ranges_[*index];
+                actions.emplace_back([promise, part = std::move(range.Parts.front()), index = *index]() mutable {
+                    promise.SetValue(TParallelReadTablePart(std::move(part), index));
+                });
+                range.Parts.pop_front();
+                ReadAhead(*index, actions);
+            } else if (FinishedRanges_ == Ranges_.size()) {
+                actions.emplace_back([promise]() mutable {
+                    promise.SetValue(TParallelReadTablePart(
+                        MakeStatusPart(TStatus(EStatus::CLIENT_OUT_OF_RANGE, NYdb::NIssue::TIssues())), 0));
+                });
+            } else {
+                break;
+            }
+
+            Waiters_.pop_front();
+        }
+    }
+
+private:
+    TTableClient Client_;
+    const std::shared_ptr<IClientImplCommon> ClientImpl_;
+    const std::string Path_;
+    const TParallelReadTableSettings Settings_;
+    // Reading is idempotent, so transport errors are retried too
+    const TRetryOperationSettings RetrySettings_;
+    const std::vector<std::string> KeyColumns_;
+    const bool Ordered_;
+    const size_t MaxStreams_;
+    const size_t MaxBufferedParts_;
+
+    std::mutex Lock_;
+    std::vector<TRange> Ranges_;
+    size_t NextRange_ = 0;
+    size_t ActiveStreams_ = 0;
+    size_t FinishedRanges_ = 0;
+    // Ordered mode: the range whose parts are returned now
+    size_t CurrentRange_ = 0;
+    // Unordered mode: range of every buffered part in the order of arrival
+    std::deque<size_t> Ready_;
+    std::deque<TPromise<TParallelReadTablePart>> Waiters_;
+    std::optional<TStatus> Failed_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TParallelTablePartIterator::TParallelTablePartIterator(
+    std::shared_ptr<TReaderImpl> impl,
+    TStatus&& status)
+    : TStatus(std::move(status))
+    , ReaderImpl_(std::move(impl))
+{}
+
+TAsyncParallelReadTablePart TParallelTablePartIterator::ReadNext() {
+    if (!ReaderImpl_) {
+        return MakeFuture(TParallelReadTablePart(MakeStatusPart(TStatus(*this)), 0));
+    }
+    return ReaderImpl_->ReadNext();
+}
+
+size_t TParallelTablePartIterator::GetRangesCount() const {
+    return ReaderImpl_ ? ReaderImpl_->GetRangesCount() : 0;
+}
+
+TAsyncParallelTablePartIterator TTableClient::ReadTableParallel(const std::string& path,
+    const TParallelReadTableSettings& settings)
+{
+    if (settings.ReadTableSettings_.From_ || settings.ReadTableSettings_.To_) {
+        NYdb::NIssue::TIssues issues;
+        issues.AddIssue(NYdb::NIssue::TIssue("From and To are not supported by ReadTableParallel"));
+        return MakeFuture(TParallelTablePartIterator(nullptr, TStatus(EStatus::BAD_REQUEST, std::move(issues))));
+    }
+
+    auto client = *this;
+    std::shared_ptr<IClientImplCommon> clientImpl = Impl_;
+    auto describeResult = std::make_shared<std::optional<TDescribeTableResult>>();
+
+    return RetryOperation([path, describeResult](TSession session) {
+        return session.DescribeTable(path, TDescribeTableSettings().WithKeyShardBoundary(true))
+            .Apply([describeResult](const TAsyncDescribeTableResult& future) {
+                describeResult->emplace(future.GetValue());
+                return MakeFuture<TStatus>(**describeResult);
+            });
+    }, settings.RetrySettings_).Apply([client, clientImpl, path, settings, describeResult](const TAsyncStatus& future) {
+        auto status = future.GetValue();
+        if (!status.IsSuccess()) {
+            return TParallelTablePartIterator(nullptr, std::move(status));
+        }
+
+        const auto& description = (*describeResult)->GetTableDescription();
+        auto impl = std::make_shared<TParallelTablePartIterator::TReaderImpl>(client, clientImpl, path, settings,
+            GetShardRanges(description), description.GetPrimaryKeyColumns());
+        impl->Start();
+        return TParallelTablePartIterator(std::move(impl), std::move(status));
+    });
+}
+
+} // namespace NTable
+} // namespace NYdb
@@ -1395,6 +1395,7 @@ TTableClient::TTableClient(const TDriver& driver, const TClientSettings& setting
     Impl_->StartPeriodicSessionPoolTask();
     Impl_->StartPeriodicHostScanTask();
     Impl_->InitStopper();
+    Impl_->WarmUpSessionPool();
 }
 
 TAsyncCreateSessionResult TTableClient::CreateSession(const TCreateSessionSettings& settings) {
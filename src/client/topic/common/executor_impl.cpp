@@ -20,10 +20,11 @@ void TThreadPoolExecutor::PostImpl(TFunction&& f) {
     ThreadPool->SafeAddFunc(std::move(f));
 }
 
-TSerialExecutor::TSerialExecutor(IAsyncExecutor::TPtr executor)
+TSerialExecutor::TSerialExecutor(IExecutor::TPtr executor)
     : Executor(executor)
 {
     Y_ABORT_UNLESS(executor);
+    Y_ABORT_UNLESS(executor->IsAsync());
 }
 
 void TSerialExecutor::PostImpl(std::vector<TFunction>&& fs) {
@@ -50,15 +51,13 @@ void TSerialExecutor::PostNext() {
         return;
     }
 
-    auto weakThis = weak_from_this();
-    Executor->Post([weakThis, f = std::move(ExecutionQueue.front())]() {
-        if (auto sharedThis = weakThis.lock()) {
-            f();
-            {
-                std::lock_guard guard(sharedThis->Mutex);
-                sharedThis->Busy = false;
-                sharedThis->PostNext();
-            }
+    // The executor is kept alive until all posted functions are executed.
+    Executor->Post([self = TIntrusivePtr<TSerialExecutor>(this), f = std::move(ExecutionQueue.front())]() {
+        f();
+        {
+            std::lock_guard guard(self->Mutex);
+            self->Busy = false;
+            self->PostNext();
         }
     });
     ExecutionQueue.pop();
@@ -53,17 +53,22 @@ private:
     size_t ThreadsCount = 0;
 };
 
-class TSerialExecutor : public IAsyncExecutor, public std::enable_shared_from_this<TSerialExecutor> {
+// Runs posted functions one after another in order of posting on the wrapped asynchronous executor.
+class TSerialExecutor : public IAsyncExecutor {
 private:
-    IAsyncExecutor::TPtr Executor; //!< Wrapped executor that is actually doing the job
+    IExecutor::TPtr Executor; //!< Wrapped executor that is actually doing the job
     bool Busy = false; //!< Set if some closure was scheduled for execution and did not finish yet
     std::mutex Mutex = {};
     std::queue<TFunction> ExecutionQueue = {};
 
 public:
-    TSerialExecutor(IAsyncExecutor::TPtr executor);
+    TSerialExecutor(IExecutor::TPtr executor);
     ~TSerialExecutor() = default;
 
+    void DoStart() override {
+        Executor->Start();
+    }
+
 private:
     void PostImpl(std::vector<TFunction>&& fs) override;
     void PostImpl(TFunction&& f) override;
@@ -0,0 +1,150 @@
+#include "read_memory_governor_impl.h"
+
+#include <util/generic/ymath.h>
+
+namespace NYdb::inline V3::NTopic {
+
+TReadMemoryGovernor::TReadMemoryGovernor(ui64 maxMemoryUsageBytes, TIntrusivePtr<::NMonitoring::TDynamicCounters> counters)
+    : MaxMemoryUsageBytes(Max<ui64>(1, maxMemoryUsageBytes))
+{
+    if (!counters) {
+        counters = MakeIntrusive<::NMonitoring::TDynamicCounters>();
+    }
+
+    MemoryLimitCounter = counters->GetCounter("memoryLimitBytes", false);
+    MemoryUsageCounter = counters->GetCounter("memoryUsageBytes", false);
+    SessionsCounter = counters->GetCounter("sessions", false);
+    ThrottledSessionsCounter = counters->GetCounter("throttledSessions", false);
+    WakeUpsCounter = counters->GetCounter("wakeUps", true);
+
+    *MemoryLimitCounter = MaxMemoryUsageBytes;
+}
+
+IReadMemoryGovernor::TSessionId TReadMemoryGovernor::RegisterSession(TWakeUpCallback wakeUp) {
+    std::lock_guard guard(Lock);
+    const TSessionId sessionId = NextSessionId++;
+    Sessions[sessionId].WakeUp = std::move(wakeUp);
+    UpdateCountersImpl();
+    return sessionId;
+}
+
+std::vector<IReadMemoryGovernor::TWakeUpCallback> TReadMemoryGovernor::UnregisterSession(TSessionId sessionId) {
+    std::lock_guard guard(Lock);
+    auto it = Sessions.find(sessionId);
+    if (it == Sessions.end()) {
+        return {};
+    }
+
+    MemoryUsage -= it->second.MemoryUsage;
+    if (it->second.Throttled) {
+        --ThrottledCount;
+    }
+    Sessions.erase(it);
+
+    auto wakeUps = WakeUpThrottledImpl();
+    UpdateCountersImpl();
+    return wakeUps;
+}
+
+ui64 TReadMemoryGovernor::GetSessionLimit(TSessionId sessionId) const {
+    std::lock_guard guard(Lock);
+    auto it = Sessions.find(sessionId);
+    if (it == Sessions.end()) {
+        return MaxMemoryUsageBytes;
+    }
+    return GetSessionLimitImpl(it->second);
+}
+
+std::vector<IReadMemoryGovernor::TWakeUpCallback> TReadMemoryGovernor::UpdateSessionUsage(TSessionId sessionId, ui64 memoryUsage) {
+    std::lock_guard guard(Lock);
+    auto it = Sessions.find(sessionId);
+    if (it == Sessions.end()) {
+        return {};
+    }
+
+    TSessionInfo& session = it->second;
+    const bool released = memoryUsage < session.MemoryUsage;
+    MemoryUsage = MemoryUsage - session.MemoryUsage + memoryUsage;
+    session.MemoryUsage = memoryUsage;
+
+    // Session is throttled if common budget doesn't let it grow by a fair share.
+    if (!session.Throttled && GetFreeMemoryImpl() < GetFairShareImpl()) {
+        session.Throttled = true;
+        ++ThrottledCount;
+        ThrottledQueue.push_back(sessionId);
+    }
+
+    std::vector<TWakeUpCallback> wakeUps;
+    if (released) {
+        wakeUps = WakeUpThrottledImpl();
+    }
+    UpdateCountersImpl();
+    return wakeUps;
+}
+
+ui64 TReadMemoryGovernor::GetMemoryUsageBytes() const {
+    std::lock_guard guard(Lock);
+    return MemoryUsage;
+}
+
+size_t TReadMemoryGovernor::GetSessionsCount() const {
+    std::lock_guard guard(Lock);
+    return Sessions.size();
+}
+
+ui64 TReadMemoryGovernor::GetFairShareImpl() const {
+    return Max<ui64>(1, MaxMemoryUsageBytes / Max<size_t>(1, Sessions.size()));
+}
+
+ui64 TReadMemoryGovernor::GetFreeMemoryImpl() const {
+    return MaxMemoryUsageBytes > MemoryUsage ? MaxMemoryUsageBytes - MemoryUsage : 0;
+}
+
+ui64 TReadMemoryGovernor::GetSessionLimitImpl(const TSessionInfo& session) const {
+    return Max(GetFairShareImpl(), session.MemoryUsage + GetFreeMemoryImpl());
+}
+
+std::vector<IReadMemoryGovernor::TWakeUpCallback> TReadMemoryGovernor::WakeUpThrottledImpl() {
+    std::vector<TWakeUpCallback> wakeUps;
+    if (GetFreeMemoryImpl() == 0) {
+        return wakeUps;
+    }
+
+    const bool wakeUpAll = GetFreeMemoryImpl() >= GetFairShareImpl();
+    while (!ThrottledQueue.empty()) {
+        const TSessionId sessionId = ThrottledQueue.front();
+        ThrottledQueue.pop_front();
+
+        auto it = Sessions.find(sessionId);
+        if (it == Sessions.end() || !it->second.Throttled) {
+            continue;
+        }
+
+        it->second.Throttled = false;
+        --ThrottledCount;
+        if (it->second.WakeUp) {
+            wakeUps.push_back(it->second.WakeUp);
+        }
+
+        if (!wakeUpAll) {
+            break;
+        }
+    }
+
+    *WakeUpsCounter += wakeUps.size();
+    return wakeUps;
+}
+
+void TReadMemoryGovernor::UpdateCountersImpl() {
+    *MemoryUsageCounter = MemoryUsage;
+    *SessionsCounter = Sessions.size();
+    *ThrottledSessionsCounter = ThrottledCount;
+}
+
+IReadMemoryGovernor::TPtr CreateReadMemoryGovernor(ui64 maxMemoryUsageBytes,
+                                                   TIntrusivePtr<::NMonitoring::TDynamicCounters> counters)
+{
+    return MakeIntrusive<TReadMemoryGovernor>(maxMemoryUsageBytes, std::move(counters));
+}
+
+} // namespace NYdb::NTopic
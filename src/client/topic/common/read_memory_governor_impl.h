@@ -0,0 +1,63 @@
+#pragma once
+
+#include <ydb-cpp-sdk/client/topic/read_memory_governor.h>
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace NYdb::inline V3::NTopic {
+
+class TReadMemoryGovernor : public IReadMemoryGovernor {
+public:
+    TReadMemoryGovernor(ui64 maxMemoryUsageBytes, TIntrusivePtr<::NMonitoring::TDynamicCounters> counters);
+
+    TSessionId RegisterSession(TWakeUpCallback wakeUp) override;
+    std::vector<TWakeUpCallback> UnregisterSession(TSessionId sessionId) override;
+
+    ui64 GetSessionLimit(TSessionId sessionId) const override;
+    std::vector<TWakeUpCallback> UpdateSessionUsage(TSessionId sessionId, ui64 memoryUsage) override;
+
+    ui64 GetMaxMemoryUsageBytes() const override {
+        return MaxMemoryUsageBytes;
+    }
+
+    ui64 GetMemoryUsageBytes() const override;
+    size_t GetSessionsCount() const override;
+
+private:
+    struct TSessionInfo {
+        ui64 MemoryUsage = 0;
+        TWakeUpCallback WakeUp;
+        bool Throttled = false;
+    };
+
+    ui64 GetFairShareImpl() const;
+    ui64 GetFreeMemoryImpl() const;
+    ui64 GetSessionLimitImpl(const TSessionInfo& session) const;
+
+    // Picks throttled sessions to wake up after memory has been released.
+    // If there is enough free memory for a fair share, all throttled sessions are woken up,
+    // otherwise the one that waits the longest.
+    std::vector<TWakeUpCallback> WakeUpThrottledImpl();
+
+    void UpdateCountersImpl();
+
+private:
+    const ui64 MaxMemoryUsageBytes;
+
+    mutable std::mutex Lock;
+    std::unordered_map<TSessionId, TSessionInfo> Sessions;
+    std::deque<TSessionId> ThrottledQueue;
+    TSessionId NextSessionId = 1;
+    ui64 MemoryUsage = 0;
+    size_t ThrottledCount = 0;
+
+    ::NMonitoring::TDynamicCounters::TCounterPtr MemoryLimitCounter;
+    ::NMonitoring::TDynamicCounters::TCounterPtr MemoryUsageCounter;
+    ::NMonitoring::TDynamicCounters::TCounterPtr SessionsCounter;
+    ::NMonitoring::TDynamicCounters::TCounterPtr ThrottledSessionsCounter;
+    ::NMonitoring::TDynamicCounters::TCounterPtr WakeUpsCounter;
+};
+
+} // namespace NYdb::NTopic
@@ -3,6 +3,47 @@
 
 namespace NYdb::inline V3::NTopic {
 
+namespace {
+
+class TBudgetedRetryPolicy : public ::IRetryPolicy<EStatus> {
+    class TBudgetedRetryState : public IRetryState {
+    public:
+        TBudgetedRetryState(IRetryState::TPtr state, NRetry::TRetryBudget::TPtr budget)
+            : State(std::move(state))
+            , Budget(std::move(budget))
+        {}
+
+        TMaybe<TDuration> GetNextRetryDelay(EStatus status) override {
+            auto delay = State->GetNextRetryDelay(status);
+            // Sessions never report successes, so circuit breakers of the budget are not used
+            if (delay && Budget->TakeRetry() != NRetry::ERetryDecision::Allow) {
+                return Nothing();
+            }
+            return delay;
+        }
+
+    private:
+        IRetryState::TPtr State;
+        NRetry::TRetryBudget::TPtr Budget;
+    };
+
+public:
+    TBudgetedRetryPolicy(TPtr policy, NRetry::TRetryBudget::TPtr budget)
+        : Policy(std::move(policy))
+        , Budget(std::move(budget))
+    {}
+
+    IRetryState::TPtr CreateRetryState() const override {
+        return std::make_unique<TBudgetedRetryState>(Policy->CreateRetryState(), Budget);
+    }
+
+private:
+    TPtr Policy;
+    NRetry::TRetryBudget::TPtr Budget;
+};
+
+}
+
 IRetryPolicy::TPtr IRetryPolicy::GetDefaultPolicy() {
     static IRetryPolicy::TPtr policy = GetExponentialBackoffPolicy();
     return policy;
@@ -29,4 +70,9 @@ IRetryPolicy::GetFixedIntervalPolicy(TDuration delay, TDuration longRetryDelay,
         longRetryDelay, maxRetries, maxTime);
 }
 
-}  // namespace NYdb::NTopic
\ No newline at end of file
+IRetryPolicy::TPtr IRetryPolicy::GetBudgetedPolicy(TPtr policy, NRetry::TRetryBudget::TPtr budget) {
+    Y_ABORT_UNLESS(policy && budget);
+    return std::make_shared<TBudgetedRetryPolicy>(std::move(policy), std::move(budget));
+}
+
+}  // namespace NYdb::NTopic
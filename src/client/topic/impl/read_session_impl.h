@@ -13,6 +13,7 @@
 #include <ydb-cpp-sdk/client/topic/read_session.h>
 #include <src/client/persqueue_public/include/read_session.h>
 #include <src/client/topic/common/callback_context.h>
+#include <src/client/topic/common/executor_impl.h>
 #include <src/client/topic/impl/topic_impl.h>
 
 #include <ydb-cpp-sdk/client/table/table.h>
@@ -160,6 +161,7 @@ public:
     void DeferStartSession(TCallbackContextPtr<UseMigrationProtocol> cbContext);
     void DeferSignalWaiter(TWaiter&& waiter);
     void DeferDestroyDecompressionInfos(std::vector<TDataDecompressionInfoPtr<UseMigrationProtocol>>&& infos);
+    void DeferWakeUpSessions(std::vector<IReadMemoryGovernor::TWakeUpCallback>&& wakeUps);
 
 private:
     void DoActions();
@@ -173,6 +175,7 @@ private:
     void Reconnect();
     void SignalWaiters();
     void StartSessions();
+    void WakeUpSessions();
 
 private:
     // Read.
@@ -217,6 +220,9 @@ private:
     std::vector<TCallbackContextPtr<UseMigrationProtocol>> CbContexts;
 
     std::vector<TDataDecompressionInfoPtr<UseMigrationProtocol>> DecompressionInfos;
+
+    // Read sessions throttled by memory governor.
+    std::vector<IReadMemoryGovernor::TWakeUpCallback> WakeUps;
 };
 
 template <bool UseMigrationProtocol>
@@ -823,6 +829,15 @@ public:
         return Lock;
     }
 
+    // Serial executor for handlers of this partition stream events on top of the session handlers executor.
+    // Assumes that we're under events queue lock.
+    typename IAExecutor<UseMigrationProtocol>::TPtr GetHandlersExecutor(const typename IAExecutor<UseMigrationProtocol>::TPtr& sessionExecutor) {
+        if (!HandlersExecutor) {
+            HandlersExecutor = MakeIntrusive<TSerialExecutor>(sessionExecutor);
+        }
+        return HandlersExecutor;
+    }
+
 private:
     const TKey Key;
     ui64 AssignId;
@@ -836,6 +851,7 @@ private:
     TDisjointIntervalTree<ui64> ClientCommits;
 
     std::mutex Lock;
+    typename IAExecutor<UseMigrationProtocol>::TPtr HandlersExecutor;
 };
 
 
@@ -898,11 +914,13 @@ public:
         return true;
     }
 
-    bool TryApplyCallbackToEventImpl(typename TParent::TEvent& event,
+    bool TryApplyCallbackToEventImpl(const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream,
+                                     typename TParent::TEvent& event,
                                      TDeferredActions<UseMigrationProtocol>& deferred,
                                      TCallbackContextPtr<UseMigrationProtocol>& cbContext);
     bool HasDataEventCallback() const;
-    void ApplyCallbackToEventImpl(TADataReceivedEvent<UseMigrationProtocol>& event,
+    void ApplyCallbackToEventImpl(const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream,
+                                  TADataReceivedEvent<UseMigrationProtocol>& event,
                                   TUserRetrievedEventsInfoAccumulator<UseMigrationProtocol>&& eventsInfo,
                                   TDeferredActions<UseMigrationProtocol>& deferred);
 
@@ -945,10 +963,12 @@ private:
         THandlersVisitor(const TAReadSessionSettings<UseMigrationProtocol>& settings,
                          typename TParent::TEvent& event,
                          TDeferredActions<UseMigrationProtocol>& deferred,
-                         TCallbackContextPtr<UseMigrationProtocol>& cbContext)
+                         TCallbackContextPtr<UseMigrationProtocol>& cbContext,
+                         typename IAExecutor<UseMigrationProtocol>::TPtr executor = {})
             : TParent::TBaseHandlersVisitor(settings, event)
             , Deferred(deferred)
-            , CbContext(cbContext) {
+            , CbContext(cbContext)
+            , Executor(std::move(executor)) {
         }
 
 #define DECLARE_HANDLER(type, handler, answer)                      \
@@ -1066,13 +1086,17 @@ private:
         }
 
         void Post(const typename IAExecutor<UseMigrationProtocol>::TPtr& executor, typename IAExecutor<UseMigrationProtocol>::TFunction&& f) override {
-            Deferred.DeferStartExecutorTask(executor, std::move(f));
+            Deferred.DeferStartExecutorTask(Executor ? Executor : executor, std::move(f));
         }
 
         TDeferredActions<UseMigrationProtocol>& Deferred;
         TCallbackContextPtr<UseMigrationProtocol> CbContext;
+        typename IAExecutor<UseMigrationProtocol>::TPtr Executor; // Overrides handlers executor from settings if set.
     };
 
+    // Executor for handlers of partition stream events.
+    typename IAExecutor<UseMigrationProtocol>::TPtr GetHandlersExecutorImpl(const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream); // Assumes that we're under lock.
+
     TADataReceivedEvent<UseMigrationProtocol>
         GetDataEventImpl(TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>> stream,
                          size_t& maxByteSize,
@@ -1085,6 +1109,7 @@ private:
 
 private:
     bool HasEventCallbacks;
+    bool ParallelPartitionHandlers = false;
     TCallbackContextPtr<UseMigrationProtocol> CbContext;
 };
 
@@ -1285,16 +1310,32 @@ private:
 
     void StartDecompressionTasksImpl(TDeferredActions<UseMigrationProtocol>& deferred); // Assumes that we're under lock.
 
+    // Session memory limit, taking into account the budget of the shared memory governor.
+    size_t GetMemoryLimit() const {
+        if (MemoryGovernor) {
+            return Min<size_t>(Settings.MaxMemoryUsageBytes_, MemoryGovernor->GetSessionLimit(MemoryGovernorSessionId));
+        }
+        return Settings.MaxMemoryUsageBytes_;
+    }
+
     i64 GetCompressedDataSizeLimit() const {
-        const double overallLimit = static_cast<double>(Settings.MaxMemoryUsageBytes_);
-        // CompressedDataSize + CompressedDataSize * AverageCompressionRatio <= Settings.MaxMemoryUsageBytes_
+        return GetCompressedDataSizeLimit(GetMemoryLimit());
+    }
+
+    i64 GetCompressedDataSizeLimit(size_t memoryLimit) const {
+        const double overallLimit = static_cast<double>(memoryLimit);
+        // CompressedDataSize + CompressedDataSize * AverageCompressionRatio <= memoryLimit
         return Max<i64>(1l, static_cast<i64>(overallLimit / (1.0 + AverageCompressionRatio)));
     }
 
-    i64 GetDecompressedDataSizeLimit() const {
-        return Max<i64>(1l, static_cast<i64>(Settings.MaxMemoryUsageBytes_) - GetCompressedDataSizeLimit());
+    i64 GetDecompressedDataSizeLimit(size_t memoryLimit) const {
+        return Max<i64>(1l, static_cast<i64>(memoryLimit) - GetCompressedDataSizeLimit(memoryLimit));
     }
 
+    void RegisterInMemoryGovernor();
+    void OnMemoryGovernorWakeUp();
+    void UpdateMemoryGovernorUsageImpl(TDeferredActions<UseMigrationProtocol>& deferred); // Assumes that we're under lock.
+
     bool GetRangesMode() const;
 
     void CallCloseCallbackImpl();
@@ -1437,6 +1478,8 @@ private:
     i64 DecompressedDataSize = 0;
     double AverageCompressionRatio = 1.0; // Weighted average for compression memory usage estimate.
     TInstant UsageStatisticsLastUpdateTime = TInstant::Now();
+    IReadMemoryGovernor::TPtr MemoryGovernor; // Only for ydb_topic
+    IReadMemoryGovernor::TSessionId MemoryGovernorSessionId = 0;
 
     bool WaitingReadResponse = false;
     std::shared_ptr<TServerMessage<UseMigrationProtocol>> ServerMessage; // Server message to write server response to.
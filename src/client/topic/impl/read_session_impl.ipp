@@ -189,12 +189,12 @@ void TRawPartitionStreamEventQueue<UseMigrationProtocol>::SignalReadyEvents(TInt
                                                               std::move(compressedMessages),
                                                               stream);
 
-                queue.ApplyCallbackToEventImpl(data, std::move(accumulator), deferred);
+                queue.ApplyCallbackToEventImpl(stream, data, std::move(accumulator), deferred);
             } else {
                 moveToReadyQueue(std::move(front));
             }
         } else {
-            if (queue.TryApplyCallbackToEventImpl(front.GetEvent(), deferred, CbContext)) {
+            if (queue.TryApplyCallbackToEventImpl(stream, front.GetEvent(), deferred, CbContext)) {
                 NotReady.pop_front();
             } else {
                 moveToReadyQueue(std::move(front));
@@ -247,6 +247,12 @@ TSingleClusterReadSessionImpl<UseMigrationProtocol>::~TSingleClusterReadSessionI
     for (auto& e : DecompressionQueue) {
         e.OnDestroyReadSession();
     }
+
+    if (MemoryGovernor) {
+        for (auto& wakeUp : MemoryGovernor->UnregisterSession(MemoryGovernorSessionId)) {
+            wakeUp();
+        }
+    }
 }
 
 template<bool UseMigrationProtocol>
@@ -259,11 +265,55 @@ void TSingleClusterReadSessionImpl<UseMigrationProtocol>::Start() {
     Y_ABORT_UNLESS(this->SelfContext);
     Settings.DecompressionExecutor_->Start();
     Settings.EventHandlers_.HandlersExecutor_->Start();
+    RegisterInMemoryGovernor();
     if (!Reconnect(TPlainStatus())) {
         AbortSession(EStatus::ABORTED, "Driver is stopping");
     }
 }
 
+template<bool UseMigrationProtocol>
+void TSingleClusterReadSessionImpl<UseMigrationProtocol>::RegisterInMemoryGovernor() {
+    if constexpr (!UseMigrationProtocol) {
+        if (!Settings.MemoryGovernor_) {
+            return;
+        }
+
+        auto wakeUp = [cbContext = this->SelfContext]() {
+            if (auto session = cbContext->LockShared()) {
+                session->OnMemoryGovernorWakeUp();
+            }
+        };
+
+        std::lock_guard guard(Lock);
+        MemoryGovernor = Settings.MemoryGovernor_;
+        MemoryGovernorSessionId = MemoryGovernor->RegisterSession(std::move(wakeUp));
+    }
+}
+
+template<bool UseMigrationProtocol>
+void TSingleClusterReadSessionImpl<UseMigrationProtocol>::OnMemoryGovernorWakeUp() {
+    TDeferredActions<UseMigrationProtocol> deferred;
+    std::lock_guard guard(Lock);
+    if (Aborting || Closing) {
+        return;
+    }
+
+    ContinueReadingDataImpl();
+    StartDecompressionTasksImpl(deferred);
+}
+
+template<bool UseMigrationProtocol>
+void TSingleClusterReadSessionImpl<UseMigrationProtocol>::UpdateMemoryGovernorUsageImpl(TDeferredActions<UseMigrationProtocol>& deferred) {
+    Y_ABORT_UNLESS(Lock.IsLocked());
+
+    if (!MemoryGovernor) {
+        return;
+    }
+
+    const ui64 memoryUsage = static_cast<ui64>(Max<i64>(0, CompressedDataSize + DecompressedDataSize));
+    deferred.DeferWakeUpSessions(MemoryGovernor->UpdateSessionUsage(MemoryGovernorSessionId, memoryUsage));
+}
+
 template<bool UseMigrationProtocol>
 bool TSingleClusterReadSessionImpl<UseMigrationProtocol>::Reconnect(const TPlainStatus& status) {
     TDuration delay = TDuration::Zero();
@@ -561,13 +611,15 @@ template<bool UseMigrationProtocol>
 void TSingleClusterReadSessionImpl<UseMigrationProtocol>::ContinueReadingDataImpl() {
     Y_ABORT_UNLESS(Lock.IsLocked());
 
+    const size_t memoryLimit = GetMemoryLimit();
+
     if (!Closing
         && !Aborting
         && !WaitingReadResponse
         && !DataReadingSuspended
         && Processor
-        && CompressedDataSize < GetCompressedDataSizeLimit()
-        && static_cast<size_t>(CompressedDataSize + DecompressedDataSize) < Settings.MaxMemoryUsageBytes_)
+        && CompressedDataSize < GetCompressedDataSizeLimit(memoryLimit)
+        && static_cast<size_t>(CompressedDataSize + DecompressedDataSize) < memoryLimit)
     {
         TClientMessage<UseMigrationProtocol> req;
         if constexpr (UseMigrationProtocol) {
@@ -1733,10 +1785,11 @@ void TSingleClusterReadSessionImpl<UseMigrationProtocol>::StartDecompressionTask
         return;
     }
     UpdateMemoryUsageStatisticsImpl();
-    const i64 limit = GetDecompressedDataSizeLimit();
+    const size_t memoryLimit = GetMemoryLimit();
+    const i64 limit = GetDecompressedDataSizeLimit(memoryLimit);
     Y_ABORT_UNLESS(limit > 0);
     while (DecompressedDataSize < limit
-           && (static_cast<size_t>(CompressedDataSize + DecompressedDataSize) < Settings.MaxMemoryUsageBytes_
+           && (static_cast<size_t>(CompressedDataSize + DecompressedDataSize) < memoryLimit
                || DecompressedDataSize == 0 /* Allow decompression of at least one message even if memory is full. */)
            && !DecompressionQueue.empty())
     {
@@ -1751,6 +1804,8 @@ void TSingleClusterReadSessionImpl<UseMigrationProtocol>::StartDecompressionTask
             break;
         }
     }
+
+    UpdateMemoryGovernorUsageImpl(deferred);
 }
 
 template<bool UseMigrationProtocol>
@@ -2297,6 +2352,10 @@ TReadSessionEventsQueue<UseMigrationProtocol>::TReadSessionEventsQueue(
                              || h.PartitionSessionStatusHandler_
                              || h.PartitionSessionClosedHandler_
                              || h.SessionClosedHandler_);
+
+        ParallelPartitionHandlers = h.ParallelPartitionHandlers_
+                                    && h.HandlersExecutor_
+                                    && h.HandlersExecutor_->IsAsync();
     }
 }
 
@@ -2322,7 +2381,7 @@ bool TReadSessionEventsQueue<UseMigrationProtocol>::PushEvent(TIntrusivePtr<TPar
 
     if (!HasDataEventCallback() && !std::holds_alternative<TADataReceivedEvent<UseMigrationProtocol>>(event)) {
         // Call non-dataEvent callbacks immediately.
-        if (TryApplyCallbackToEventImpl(event, deferred, CbContext)) {
+        if (TryApplyCallbackToEventImpl(stream, event, deferred, CbContext)) {
             return true;
         }
     }
@@ -2600,11 +2659,22 @@ void TReadSessionEventsQueue<UseMigrationProtocol>::SignalReadyEventsImpl(
 }
 
 template <bool UseMigrationProtocol>
-bool TReadSessionEventsQueue<UseMigrationProtocol>::TryApplyCallbackToEventImpl(typename TParent::TEvent& event,
+typename IAExecutor<UseMigrationProtocol>::TPtr TReadSessionEventsQueue<UseMigrationProtocol>::GetHandlersExecutorImpl(
+    const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream)
+{
+    if (ParallelPartitionHandlers && partitionStream) {
+        return partitionStream->GetHandlersExecutor(TParent::Settings.EventHandlers_.HandlersExecutor_);
+    }
+    return TParent::Settings.EventHandlers_.HandlersExecutor_;
+}
+
+template <bool UseMigrationProtocol>
+bool TReadSessionEventsQueue<UseMigrationProtocol>::TryApplyCallbackToEventImpl(const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream,
+                                                                                typename TParent::TEvent& event,
                                                                                 TDeferredActions<UseMigrationProtocol>& deferred,
                                                                                 TCallbackContextPtr<UseMigrationProtocol>& cbContext)
 {
-    THandlersVisitor visitor(TParent::Settings, event, deferred, cbContext);
+    THandlersVisitor visitor(TParent::Settings, event, deferred, cbContext, GetHandlersExecutorImpl(partitionStream));
     return visitor.Visit();
 }
 
@@ -2626,7 +2696,8 @@ bool TReadSessionEventsQueue<UseMigrationProtocol>::HasDataEventCallback() const
 }
 
 template <bool UseMigrationProtocol>
-void TReadSessionEventsQueue<UseMigrationProtocol>::ApplyCallbackToEventImpl(TADataReceivedEvent<UseMigrationProtocol>& data,
+void TReadSessionEventsQueue<UseMigrationProtocol>::ApplyCallbackToEventImpl(const TIntrusivePtr<TPartitionStreamImpl<UseMigrationProtocol>>& partitionStream,
+                                                                             TADataReceivedEvent<UseMigrationProtocol>& data,
                                                                              TUserRetrievedEventsInfoAccumulator<UseMigrationProtocol>&& eventsInfo,
                                                                              TDeferredActions<UseMigrationProtocol>& deferred)
 {
@@ -2640,7 +2711,7 @@ void TReadSessionEventsQueue<UseMigrationProtocol>::ApplyCallbackToEventImpl(TAD
             eventsInfo.OnUserRetrievedEvent();
         };
 
-        deferred.DeferStartExecutorTask(TParent::Settings.EventHandlers_.HandlersExecutor_, std::move(action));
+        deferred.DeferStartExecutorTask(GetHandlersExecutorImpl(partitionStream), std::move(action));
     } else if (TParent::Settings.EventHandlers_.CommonHandler_) {
         auto action = [func = TParent::Settings.EventHandlers_.CommonHandler_,
                        data = std::move(data),
@@ -2651,7 +2722,7 @@ void TReadSessionEventsQueue<UseMigrationProtocol>::ApplyCallbackToEventImpl(TAD
             eventsInfo.OnUserRetrievedEvent();
         };
 
-        deferred.DeferStartExecutorTask(TParent::Settings.EventHandlers_.HandlersExecutor_, std::move(action));
+        deferred.DeferStartExecutorTask(GetHandlersExecutorImpl(partitionStream), std::move(action));
     } else {
         Y_ABORT_UNLESS(false);
     }
@@ -3217,6 +3288,14 @@ void TDeferredActions<UseMigrationProtocol>::DeferDestroyDecompressionInfos(std:
     DecompressionInfos = std::move(infos);
 }
 
+template<bool UseMigrationProtocol>
+void TDeferredActions<UseMigrationProtocol>::DeferWakeUpSessions(std::vector<IReadMemoryGovernor::TWakeUpCallback>&& wakeUps)
+{
+    for (auto& wakeUp : wakeUps) {
+        WakeUps.emplace_back(std::move(wakeUp));
+    }
+}
+
 template<bool UseMigrationProtocol>
 void TDeferredActions<UseMigrationProtocol>::DoActions() {
     Read();
@@ -3228,6 +3307,7 @@ void TDeferredActions<UseMigrationProtocol>::DoActions() {
     Reconnect();
     SignalWaiters();
     StartSessions();
+    WakeUpSessions();
 }
 
 template<bool UseMigrationProtocol>
@@ -3313,4 +3393,11 @@ void TDeferredActions<UseMigrationProtocol>::SignalWaiters() {
     }
 }
 
+template<bool UseMigrationProtocol>
+void TDeferredActions<UseMigrationProtocol>::WakeUpSessions() {
+    for (auto& wakeUp : WakeUps) {
+        wakeUp();
+    }
+}
+
 } // namespace NYdb::NTopic
@@ -98,6 +98,9 @@ TWriteSessionImpl::TWriteSessionImpl(
     } else {
         Counters = MakeIntrusive<TWriterCounters>(new ::NMonitoring::TDynamicCounters());
     }
+    if (Settings.SpoolDirectory_) {
+        Spool = std::make_unique<TWriteSpool>(*Settings.SpoolDirectory_, Settings.SpoolSegmentSize_);
+    }
 }
 
 void TWriteSessionImpl::Start(const TDuration& delay) {
@@ -632,6 +635,7 @@ void TWriteSessionImpl::DeleteTx(const TTransactionId& txId)
 void TWriteSessionImpl::WriteInternal(TContinuationToken&&, TWriteMessage&& message) {
     TInstant createdAtValue = message.CreateTimestamp_.value_or(TInstant::Now());
     bool readyToAccept = false;
+    std::optional<uint64_t> spoolTicket;
     size_t bufferSize = message.Data.size();
     {
         std::lock_guard guard(Lock);
@@ -651,20 +655,171 @@ void TWriteSessionImpl::WriteInternal(TContinuationToken&&, TWriteMessage&& mess
             WrittenInTx[seqNo] = txId;
         }
 
-        CurrentBatch.Add(
-                seqNo, createdAtValue, message.Data, message.Codec, message.OriginalSize,
-                message.MessageMeta_,
-                MakeTransactionId(message.GetTxPtr())
-        );
+        if (IsSpoolingImpl()) {
+            spoolTicket = SpoolMessageImpl(seqNo, createdAtValue, message);
+        } else {
+            CurrentBatch.Add(
+                    seqNo, createdAtValue, message.Data, message.Codec, message.OriginalSize,
+                    message.MessageMeta_,
+                    MakeTransactionId(message.GetTxPtr())
+            );
 
-        FlushWriteIfRequiredImpl();
-        readyToAccept = OnMemoryUsageChangedImpl(bufferSize).NowOk;
+            FlushWriteIfRequiredImpl();
+            readyToAccept = OnMemoryUsageChangedImpl(bufferSize).NowOk;
+        }
+
+        if (Spool) {
+            readyToAccept = IsReadyToAcceptImpl();
+            TokenWithheld = !readyToAccept;
+        }
+    }
+    if (spoolTicket) {
+        PushToSpool(*spoolTicket, message.Data);
     }
     if (readyToAccept) {
         EventsQueue->PushEvent(TWriteSessionEvent::TReadyToAcceptEvent{IssueContinuationToken()});
     }
 }
 
+// Once a message is spooled, all the following ones are spooled too until the spool is drained, to keep the write order
+bool TWriteSessionImpl::IsSpoolingImpl() const {
+    Y_ABORT_UNLESS(Lock.IsLocked());
+
+    return Spool && (!SpooledMessages.empty() || MemoryUsage > Settings.MaxMemoryUsage_);
+}
+
+bool TWriteSessionImpl::IsReadyToAcceptImpl() const {
+    Y_ABORT_UNLESS(Lock.IsLocked());
+
+    if (!Spool) {
+        return MemoryUsage <= Settings.MaxMemoryUsage_;
+    }
+    return !IsSpoolingImpl() || SpooledBytes < Settings.MaxSpoolSize_;
+}
+
+// Queues the message metadata, the caller pushes the payload with PushToSpool() after releasing Lock.
+// Returns the ticket of the payload.
+uint64_t TWriteSessionImpl::SpoolMessageImpl(uint64_t id, TInstant createdAt, const TWriteMessage& message) {
+    Y_ABORT_UNLESS(Lock.IsLocked());
+
+    const uint64_t ticket = SpoolTickets++;
+    SpooledMessages.push_back(TSpooledMessage{
+        id, createdAt, message.Codec, message.OriginalSize, message.MessageMeta_, MakeTransactionId(message.GetTxPtr()),
+        message.Data.size(), ticket
+    });
+    SpooledBytes += message.Data.size();
+    return ticket;
+}
+
+// Concurrent writers may leave Lock in any order, tickets make them push payloads in the order of SpooledMessages
+void TWriteSessionImpl::PushToSpool(uint64_t ticket, std::string_view data) {
+    std::string error;
+    {
+        std::unique_lock guard(SpoolLock);
+        SpoolPushed.wait(guard, [&] { return SpoolPushedCount == ticket || SpoolError; });
+        if (SpoolError) {
+            return;
+        }
+        try {
+            Spool->Push(data);
+            ++SpoolPushedCount;
+        } catch (const std::exception& e) {
+            error = e.what();
+            SpoolError = error;
+        }
+    }
+    SpoolPushed.notify_all();
+
+    if (!error.empty()) {
+        std::lock_guard guard(Lock);
+        LOG_LAZY(DbDriverState->Log, TLOG_ERR, LogPrefixImpl() << "Write session: failed to spool message: " << error);
+        CloseImpl(EStatus::CLIENT_INTERNAL_ERROR, TStringBuilder() << "Failed to write to the spool: " << error);
+    }
+}
+
+// Called after acks: moves spooled messages to the current batch while memory usage is within the limit
+// and issues the continuation token withheld by the last write once the session can accept messages again.
+// Spool files are read without Lock, messages stay in SpooledMessages until they are added to the batch,
+// so new writes keep spooling in the meantime.
+void TWriteSessionImpl::DrainSpool() {
+    {
+        std::lock_guard guard(Lock);
+        if (SpoolDraining) {
+            // The running drain sees the memory released by this ack
+            return;
+        }
+        SpoolDraining = true;
+    }
+
+    std::vector<std::string> payloads;
+    while (true) {
+        size_t count = 0;
+        uint64_t lastTicket = 0;
+        bool readyToAccept = false;
+        {
+            std::lock_guard guard(Lock);
+            uint64_t memoryUsage = MemoryUsage;
+            while (count < SpooledMessages.size() && memoryUsage <= Settings.MaxMemoryUsage_ && !Aborting.load()) {
+                memoryUsage += SpooledMessages[count].Size;
+                lastTicket = SpooledMessages[count].Ticket;
+                ++count;
+            }
+            if (count == 0) {
+                SpoolDraining = false;
+                if (TokenWithheld && IsReadyToAcceptImpl() && !Aborting.load()) {
+                    TokenWithheld = false;
+                    readyToAccept = true;
+                }
+            }
+        }
+        if (count == 0) {
+            if (readyToAccept) {
+                EventsQueue->PushEvent(TWriteSessionEvent::TReadyToAcceptEvent{IssueContinuationToken()});
+            }
+            return;
+        }
+
+        std::string error;
+        payloads.clear();
+        {
+            std::unique_lock guard(SpoolLock);
+            SpoolPushed.wait(guard, [&] { return SpoolPushedCount > lastTicket || SpoolError; });
+            if (SpoolError) {
+                error = TStringBuilder() << "Failed to write to the spool: " << *SpoolError;
+            } else {
+                try {
+                    for (size_t i = 0; i < count; ++i) {
+                        payloads.emplace_back(Spool->Front());
+                        Spool->Pop();
+                    }
+                } catch (const std::exception& e) {
+                    error = TStringBuilder() << "Failed to read from the spool: " << e.what();
+                }
+            }
+        }
+
+        std::lock_guard guard(Lock);
+        if (!error.empty()) {
+            LOG_LAZY(DbDriverState->Log, TLOG_ERR, LogPrefixImpl() << "Write session: " << error);
+            SpoolDraining = false;
+            CloseImpl(EStatus::CLIENT_INTERNAL_ERROR, error);
+            return;
+        }
+        for (const auto& data : payloads) {
+            auto& message = SpooledMessages.front();
+            CurrentBatch.Add(message.Id, message.CreatedAt, data, message.Codec, message.OriginalSize,
+                message.MessageMeta, std::move(message.Tx));
+            // Copy the payload to the batch before the buffer is reused
+            MessagesAcquired += static_cast<uint64_t>(CurrentBatch.Acquire());
+            OnMemoryUsageChangedImpl(data.size());
+
+            SpooledBytes -= message.Size;
+            SpooledMessages.pop_front();
+            FlushWriteIfRequiredImpl();
+        }
+    }
+}
+
 // Client method.
 void TWriteSessionImpl::Write(TContinuationToken&& token, TWriteMessage&& message) {
     WriteInternal(std::move(token), std::move(message));
@@ -978,6 +1133,10 @@ void TWriteSessionImpl::OnReadDone(NYdbGrpc::TGrpcStatus&& grpcStatus, size_t co
         EventsQueue->PushEvent(std::move(event));
     }
 
+    if (processResult.DrainSpool) {
+        DrainSpool();
+    }
+
     if (doRead)
         ReadFromProcessor();
 
@@ -1155,7 +1314,13 @@ TWriteSessionImpl::TProcessSrvMessageResult TWriteSessionImpl::ProcessServerMess
                     writeStat,
                 });
 
-                if (CleanupOnAcknowledgedImpl(msgId)) {
+                bool readyToAccept = CleanupOnAcknowledgedImpl(msgId);
+                if (Spool) {
+                    // The spool is drained after Lock is released, see OnReadDone()
+                    readyToAccept = false;
+                    result.DrainSpool = true;
+                }
+                if (readyToAccept) {
                     result.Events.emplace_back(TWriteSessionEvent::TReadyToAcceptEvent{IssueContinuationToken()});
                 }
             }
@@ -1301,7 +1466,8 @@ void TWriteSessionImpl::OnCompressed(TBlock&& block, bool isSyncCompression) {
     } else {
         memoryUsage = OnCompressedImpl(std::move(block));
     }
-    if (memoryUsage.NowOk && !memoryUsage.WasOk) {
+    // With the spool, tokens withheld by writes are issued when acks drain it
+    if (memoryUsage.NowOk && !memoryUsage.WasOk && !Spool) {
         EventsQueue->PushEvent(TWriteSessionEvent::TReadyToAcceptEvent{IssueContinuationToken()});
     }
 }
@@ -1597,7 +1763,7 @@ bool TWriteSessionImpl::Close(TDuration closeTimeout) {
     while (remaining > TDuration::Zero()) {
         {
             std::lock_guard guard(Lock);
-            if (OriginalMessagesToSend.empty() && SentOriginalMessages.empty()) {
+            if (OriginalMessagesToSend.empty() && SentOriginalMessages.empty() && SpooledMessages.empty()) {
                 ready = true;
             }
             if (Aborting.load())
@@ -1611,7 +1777,7 @@ bool TWriteSessionImpl::Close(TDuration closeTimeout) {
     }
     {
         std::lock_guard guard(Lock);
-        ready = (OriginalMessagesToSend.empty() && SentOriginalMessages.empty()) && !Aborting.load();
+        ready = (OriginalMessagesToSend.empty() && SentOriginalMessages.empty() && SpooledMessages.empty()) && !Aborting.load();
         CloseImpl(EStatus::SUCCESS, NYdb::NIssue::TIssues{});
         needSetSeqNoValue = !InitSeqNoSetDone && (InitSeqNoSetDone = true);
         if (ready) {
@@ -5,9 +5,11 @@
 #include <src/client/topic/common/callback_context.h>
 #include <src/client/topic/impl/common.h>
 #include <src/client/topic/impl/topic_impl.h>
+#include <src/client/topic/impl/write_spool.h>
 
 #include <util/generic/buffer.h>
 
+#include <condition_variable>
 
 namespace NYdb::inline V3::NTopic {
 
@@ -179,6 +181,19 @@ private:
         {}
     };
 
+    // Message moved to the disk spool, its payload is stored in TWriteSpool in the same order
+    struct TSpooledMessage {
+        uint64_t Id;
+        TInstant CreatedAt;
+        std::optional<ECodec> Codec;
+        ui32 OriginalSize;
+        std::vector<std::pair<std::string, std::string>> MessageMeta;
+        std::optional<TTransactionId> Tx;
+        uint64_t Size;
+        // Position of the payload in the spool, see PushToSpool()
+        uint64_t Ticket;
+    };
+
     struct TMessageBatch {
         TBuffer Data;
         std::vector<TMessage> Messages;
@@ -302,6 +317,7 @@ private:
         std::optional<uint64_t> InitSeqNo;
         std::vector<TWriteSessionEvent::TEvent> Events;
         bool Ok = true;
+        bool DrainSpool = false;
     };
 
     struct TPartitionLocation {
@@ -376,6 +392,11 @@ private:
 
     void FlushWriteIfRequiredImpl();
     size_t WriteBatchImpl();
+    bool IsSpoolingImpl() const;
+    bool IsReadyToAcceptImpl() const;
+    uint64_t SpoolMessageImpl(uint64_t id, TInstant createdAt, const TWriteMessage& message);
+    void PushToSpool(uint64_t ticket, std::string_view data);
+    void DrainSpool();
     void Start(const TDuration& delay);
     void InitWriter();
 
@@ -461,6 +482,26 @@ private:
 
     TMessageBatch CurrentBatch;
 
+    //! Disk spool for messages written while memory usage is over the limit, null if not configured.
+    //! Spool files are only accessed under SpoolLock, so disk I/O does not block the session Lock.
+    std::unique_ptr<TWriteSpool> Spool;
+    std::deque<TSpooledMessage> SpooledMessages;
+    //! Payload size of SpooledMessages
+    uint64_t SpooledBytes = 0;
+    uint64_t SpoolTickets = 0;
+    //! Some thread moves spooled messages to the current batch
+    bool SpoolDraining = false;
+    //! Continuation token was not issued after the last write, spool mode only
+    bool TokenWithheld = false;
+
+    std::mutex SpoolLock;
+    //! Signalled when a payload is pushed to the spool or pushing fails
+    std::condition_variable SpoolPushed;
+    //! Number of payloads pushed to the spool, guarded by SpoolLock
+    uint64_t SpoolPushedCount = 0;
+    //! Spool write error, guarded by SpoolLock
+    std::optional<std::string> SpoolError;
+
     std::queue<TOriginalMessage> OriginalMessagesToSend;
     std::priority_queue<TBlock, std::vector<TBlock>, Greater> PackedMessagesToSend;
     //! Messages that are sent but yet not acknowledged
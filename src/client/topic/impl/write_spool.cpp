@@ -0,0 +1,129 @@
+#include "write_spool.h"
+
+#include <util/folder/path.h>
+#include <util/system/file.h>
+#include <util/system/fs.h>
+#include <util/system/getpid.h>
+
+#include <zlib.h>
+
+#include <atomic>
+#include <cstring>
+
+namespace NYdb::inline V3::NTopic {
+
+namespace {
+
+struct TRecordHeader {
+    ui32 Size;
+    ui32 Crc;
+};
+
+constexpr ui64 RECORD_ALIGNMENT = alignof(TRecordHeader);
+
+ui64 GetRecordSize(size_t dataSize) {
+    return (sizeof(TRecordHeader) + dataSize + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+}
+
+ui32 GetCrc(std::string_view data) {
+    return crc32(crc32(0, nullptr, 0), reinterpret_cast<const Bytef*>(data.data()), data.size());
+}
+
+std::string MakeNamePrefix() {
+    static std::atomic<ui64> spoolsCreated = 0;
+    return "ydb-topic-spool-" + std::to_string(GetPID()) + "-" + std::to_string(spoolsCreated.fetch_add(1)) + "-";
+}
+
+TFile CreateSegmentFile(const std::string& path, ui64 capacity) {
+    TFile file(TString(path), CreateAlways | RdWr);
+    file.Resize(capacity);
+    return file;
+}
+
+} // namespace
+
+TWriteSpool::TSegment::TSegment(const std::string& path, ui64 capacity)
+    : Path(path)
+    , Capacity(capacity)
+    , Map(CreateSegmentFile(path, capacity), TMemoryMapCommon::oRdWr)
+{
+    Map.Map(0, Capacity);
+}
+
+TWriteSpool::TSegment::~TSegment() {
+    Map.Unmap();
+    NFs::Remove(TString(Path));
+}
+
+TWriteSpool::TWriteSpool(const std::string& directory, ui64 segmentSize)
+    : Directory_(directory)
+    , SegmentSize_(segmentSize)
+    , NamePrefix_(MakeNamePrefix())
+{
+    NFs::MakeDirectoryRecursive(TString(Directory_));
+}
+
+TWriteSpool::~TWriteSpool() = default;
+
+void TWriteSpool::Push(std::string_view data) {
+    if (data.size() > std::numeric_limits<ui32>::max()) {
+        ythrow TWriteSpoolError() << "message of " << data.size() << " bytes is too large for the spool";
+    }
+
+    const ui64 recordSize = GetRecordSize(data.size());
+    if (Segments_.empty() || Segments_.back()->Capacity - Segments_.back()->WriteOffset < recordSize) {
+        const auto path = TFsPath(TString(Directory_)) / (NamePrefix_ + std::to_string(SegmentsCreated_++) + ".seg");
+        Segments_.emplace_back(std::make_unique<TSegment>(path.GetPath(), std::max(SegmentSize_, recordSize)));
+    }
+
+    auto& segment = *Segments_.back();
+    char* record = segment.Data() + segment.WriteOffset;
+    const TRecordHeader header{static_cast<ui32>(data.size()), GetCrc(data)};
+    std::memcpy(record, &header, sizeof(header));
+    std::memcpy(record + sizeof(header), data.data(), data.size());
+
+    segment.WriteOffset += recordSize;
+    Size_ += recordSize;
+}
+
+std::string_view TWriteSpool::Front() const {
+    Y_ABORT_UNLESS(!Empty());
+
+    const auto& segment = *Segments_.front();
+    const char* record = segment.Data() + segment.ReadOffset;
+    TRecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+
+    if (segment.ReadOffset + GetRecordSize(header.Size) > segment.WriteOffset) {
+        ythrow TWriteSpoolError() << "corrupted record size in " << segment.Path << " at offset " << segment.ReadOffset;
+    }
+    const std::string_view data(record + sizeof(header), header.Size);
+    if (GetCrc(data) != header.Crc) {
+        ythrow TWriteSpoolError() << "checksum mismatch in " << segment.Path << " at offset " << segment.ReadOffset;
+    }
+    return data;
+}
+
+void TWriteSpool::Pop() {
+    Y_ABORT_UNLESS(!Empty());
+
+    auto& segment = *Segments_.front();
+    TRecordHeader header;
+    std::memcpy(&header, segment.Data() + segment.ReadOffset, sizeof(header));
+
+    const ui64 recordSize = GetRecordSize(header.Size);
+    segment.ReadOffset += recordSize;
+    Size_ -= recordSize;
+
+    if (segment.ReadOffset == segment.WriteOffset) {
+        if (Segments_.size() > 1 || segment.Capacity > SegmentSize_) {
+            Segments_.pop_front();
+        } else {
+            // The last segment is reused, its pages are already in the page cache
+            segment.ReadOffset = 0;
+            segment.WriteOffset = 0;
+        }
+    }
+}
+
+} // namespace NYdb::NTopic
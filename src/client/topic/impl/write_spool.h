@@ -0,0 +1,63 @@
+#pragma once
+
+#include <util/generic/yexception.h>
+#include <util/system/filemap.h>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace NYdb::inline V3::NTopic {
+
+class TWriteSpoolError: public yexception {};
+
+// Queue of message payloads in memory mapped segment files, used by the write session
+// to keep accepting messages while its memory limit is exceeded. Every record has a CRC
+// of its payload that is checked when the record is read back.
+// Not thread safe, the write session calls it under its spool lock.
+class TWriteSpool {
+public:
+    TWriteSpool(const std::string& directory, ui64 segmentSize);
+    ~TWriteSpool();
+
+    bool Empty() const {
+        return Segments_.empty() || Segments_.front()->ReadOffset == Segments_.front()->WriteOffset;
+    }
+
+    // Disk space taken by the records that are not popped yet
+    ui64 GetSize() const {
+        return Size_;
+    }
+
+    void Push(std::string_view data);
+
+    // Payload of the oldest record, valid until Pop()
+    std::string_view Front() const;
+    void Pop();
+
+private:
+    struct TSegment {
+        TSegment(const std::string& path, ui64 capacity);
+        ~TSegment();
+
+        char* Data() const {
+            return static_cast<char*>(Map.Ptr());
+        }
+
+        const std::string Path;
+        const ui64 Capacity;
+        TFileMap Map;
+        ui64 WriteOffset = 0;
+        ui64 ReadOffset = 0;
+    };
+
+    const std::string Directory_;
+    const ui64 SegmentSize_;
+    const std::string NamePrefix_;
+    ui64 SegmentsCreated_ = 0;
+    ui64 Size_ = 0;
+    std::deque<std::unique_ptr<TSegment>> Segments_;
+};
+
+} // namespace NYdb::NTopic
@@ -8,6 +8,9 @@
 
 #include <util/string/cast.h>
 
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace NYdb::inline V3 {
 
 class TStatus::TImpl {
@@ -27,14 +30,80 @@ public:
     void RaiseError(const std::string& str) const {
         ythrow TContractViolation(str);
     }
+
+    // Statuses are immutable, so every plain SUCCESS (no issues, no metadata, no cost info)
+    // coming from the same endpoint can share one impl instead of allocating a new one.
+    static std::shared_ptr<TImpl> Make(TPlainStatus&& status) {
+        if (!IsPlainSuccess(status)) {
+            return std::make_shared<TImpl>(std::move(status));
+        }
+        if (status.Endpoint.empty()) {
+            static const std::shared_ptr<TImpl> success = std::make_shared<TImpl>(TPlainStatus());
+            return success;
+        }
+        return GetSuccessCache().Get(std::move(status));
+    }
+
+private:
+    static bool IsPlainSuccess(const TPlainStatus& status) {
+        return status.Ok()
+            && status.Issues.Empty()
+            && status.Metadata.empty()
+            && status.CostInfo.consumed_units() == 0;
+    }
+
+    // Interns success impls by endpoint. The number of endpoints a driver talks to is small,
+    // the cap only protects against unbounded growth with ever-changing endpoints.
+    class TSuccessCache {
+        static constexpr size_t MaxEndpoints = 1024;
+
+        struct THash {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view value) const {
+                return std::hash<std::string_view>()(value);
+            }
+        };
+
+    public:
+        std::shared_ptr<TImpl> Get(TPlainStatus&& status) {
+            {
+                std::shared_lock lock(Mutex_);
+                if (auto it = Impls_.find(status.Endpoint); it != Impls_.end()) {
+                    return it->second;
+                }
+            }
+
+            std::unique_lock lock(Mutex_);
+            if (auto it = Impls_.find(status.Endpoint); it != Impls_.end()) {
+                return it->second;
+            }
+            if (Impls_.size() >= MaxEndpoints) {
+                return std::make_shared<TImpl>(std::move(status));
+            }
+            std::string endpoint = status.Endpoint;
+            auto impl = std::make_shared<TImpl>(std::move(status));
+            Impls_.emplace(std::move(endpoint), impl);
+            return impl;
+        }
+
+    private:
+        std::shared_mutex Mutex_;
+        std::unordered_map<std::string, std::shared_ptr<TImpl>, THash, std::equal_to<>> Impls_;
+    };
+
+    static TSuccessCache& GetSuccessCache() {
+        static TSuccessCache cache;
+        return cache;
+    }
 };
 
 TStatus::TStatus(EStatus statusCode, NYdb::NIssue::TIssues&& issues)
-    : Impl_(std::make_shared<TImpl>(TPlainStatus{statusCode, std::move(issues)}))
+    : Impl_(TImpl::Make(TPlainStatus{statusCode, std::move(issues)}))
 { }
 
 TStatus::TStatus(TPlainStatus&& plain)
-    : Impl_(std::make_shared<TImpl>(std::move(plain)))
+    : Impl_(TImpl::Make(std::move(plain)))
 { }
 
 const NYdb::NIssue::TIssues& TStatus::GetIssues() const {
@@ -1022,22 +1022,17 @@ TUuidValue::TUuidValue(const Ydb::Value& valueProto) {
 }
 
 TUuidValue::TUuidValue(const std::string& uuidString) {
-    ui16 dw[8];
-    if (!NUuid::ParseUuidToArray(uuidString, dw, false)) {
+    static_assert(sizeof(Buf_.Bytes) == NUuid::UUID_LEN);
+    // TODO: check output on big-endian machines here and everywhere.
+    if (!NUuid::ParseUuidToBytes(uuidString.data(), uuidString.size(), Buf_.Bytes, false)) {
         ThrowFatalError(TStringBuilder() << "Unable to parse string as uuid");
     }
-    static_assert(sizeof(dw) == sizeof(Buf_.Bytes));
-    // TODO: check output on big-endian machines here and everywhere.
-    std::memcpy(Buf_.Bytes, dw, sizeof(dw));
 }
 
 std::string TUuidValue::ToString() const {
-    TStringStream s;
-    ui16 dw[8];
-    static_assert(sizeof(dw) == sizeof(Buf_.Bytes));
-    std::memcpy(dw, Buf_.Bytes, sizeof(dw));
-    NUuid::UuidToString(dw, s);
-    return s.Str();
+    std::string result(NUuid::UUID_TEXT_LEN, '\0');
+    NUuid::UuidBytesToChars(Buf_.Bytes, result.data());
+    return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,5 +1,6 @@
 #include "yql_decimal.h"
 
+#include <algorithm>
 #include <cstring>
 #include <ostream>
 #include <string>
@@ -33,6 +34,53 @@ bool IsNormal(TInt128 v) {
     return v < Inf() && v > -Inf();
 }
 
+namespace {
+    constexpr char DigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    // Writes decimal digits of v right before end, two at a time, returns the first one
+    char* WriteDigits(ui64 v, char* end) {
+        while (v >= 100) {
+            end -= 2;
+            std::memcpy(end, DigitPairs + (v % 100) * 2, 2);
+            v /= 100;
+        }
+        if (v >= 10) {
+            end -= 2;
+            std::memcpy(end, DigitPairs + v * 2, 2);
+        } else {
+            *--end = '0' + v;
+        }
+        return end;
+    }
+
+    // Wide division is slow, so it is done once per 18 digits rather than for every digit
+    char* WriteDigits(TUint128 v, char* end) {
+        static const TUint128 MaxChunk(std::numeric_limits<ui64>::max());
+        static const TUint128 ChunkDivider(1000000000000000000ULL);
+        constexpr size_t ChunkDigits = 18;
+
+        while (v > MaxChunk) {
+            char* const chunkEnd = end;
+            end = WriteDigits(ui64(v % ChunkDivider), end);
+            while (end != chunkEnd - ChunkDigits) {
+                *--end = '0';
+            }
+            v /= ChunkDivider;
+        }
+        return WriteDigits(ui64(v), end);
+    }
+}
+
 const char* ToString(TInt128 val, ui8 precision, ui8 scale) {
     if (precision == 0 || precision > MaxPrecision || scale > precision) {
         return "";
@@ -62,39 +110,32 @@ const char* ToString(TInt128 val, ui8 precision, ui8 scale) {
     auto end = str + sizeof(str);
     *--end = 0;
 
-    auto s = end;
-
-    do {
-        if (precision == 0) {
-            return "";
-        }
-        --precision;
-
-
-        const auto digit = ui8(v % Ten);
-        if (digit || !scale || s != end) {
-            *--s = "0123456789"[digit];
-        }
+    auto s = WriteDigits(v, end);
+    const size_t digits = end - s;
+    if (digits > precision) {
+        return "";
+    }
 
-        if (scale && !--scale && s != end) {
-            *--s = '.';
+    // Trailing zeros of the fraction are dropped
+    size_t fraction = std::min<size_t>(scale, digits);
+    while (fraction && end[-1] == '0') {
+        --end;
+        --fraction;
+    }
+    *end = 0;
+
+    if (digits > scale) {
+        if (fraction) {
+            const size_t integral = digits - scale;
+            std::memmove(s - 1, s, integral);
+            --s;
+            s[integral] = '.';
         }
-    } while (v /= Ten);
-
-    if (scale) {
-        do {
-            if (precision == 0) {
-                return nullptr;
-            }
-            --precision;
-
+    } else {
+        for (size_t zeros = scale - digits; zeros; --zeros) {
             *--s = '0';
-        } while (--scale);
-
+        }
         *--s = '.';
-    }
-
-    if (*s == '.') {
         *--s = '0';
     }
 
@@ -19,6 +19,7 @@
 #endif
 
 #include <format>
+#include <limits>
 
 namespace NYdbGrpc {
 inline namespace V3 {
@@ -111,12 +112,32 @@ grpc_socket_mutator_vtable TGRpcKeepAliveSocketMutator::VTable =
     };
 #endif
 
-TChannelPool::TChannelPool(const TTcpKeepAliveSettings& tcpKeepAliveSettings, const TDuration& expireTime)
+TChannelPool::TChannelPool(const TTcpKeepAliveSettings& tcpKeepAliveSettings, const TDuration& expireTime,
+    size_t channelsPerEndpoint, bool separateStreamingChannels)
     : TcpKeepAliveSettings_(tcpKeepAliveSettings)
     , ExpireTime_(expireTime)
     , UpdateReUseTime_(ExpireTime_ * 0.3 < TDuration::Seconds(20) ? ExpireTime_ * 0.3 : TDuration::Seconds(20))
+    , ChannelsPerEndpoint_(Max<size_t>(channelsPerEndpoint, 1))
+    , SeparateStreamingChannels_(separateStreamingChannels)
 {}
 
+void TChannelPool::GetStubsHolderLocked(
+    const std::string& endpoint,
+    EChannelClass channelClass,
+    const TGRpcClientConfig& config,
+    std::function<void(TStubsHolder&)> cb)
+{
+    if (!UseDedicatedConnections()) {
+        return GetStubsHolderLocked(endpoint, config, std::move(cb));
+    }
+
+    // The local subchannel pool keeps gRPC from sharing one TCP connection between channels
+    // with equal arguments, so every sub-channel gets a connection of its own
+    TGRpcClientConfig subChannelConfig = config;
+    subChannelConfig.IntChannelParams[GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL] = 1;
+    GetStubsHolderLocked(SelectSubChannel(endpoint, channelClass), subChannelConfig, std::move(cb));
+}
+
 void TChannelPool::GetStubsHolderLocked(
     const std::string& channelId,
     const TGRpcClientConfig& config,
@@ -156,8 +177,19 @@ void TChannelPool::GetStubsHolderLocked(
     }
 }
 
-void TChannelPool::DeleteChannel(const std::string& channelId) {
+void TChannelPool::DeleteChannel(const std::string& endpoint) {
     std::unique_lock writeLock(RWMutex_);
+    DeleteChannelLocked(endpoint);
+    if (UseDedicatedConnections()) {
+        for (auto channelClass : {EChannelClass::Unary, EChannelClass::Streaming}) {
+            for (size_t i = 0; i < ChannelsPerEndpoint_; ++i) {
+                DeleteChannelLocked(MakeSubChannelId(endpoint, channelClass, i));
+            }
+        }
+    }
+}
+
+void TChannelPool::DeleteChannelLocked(const std::string& channelId) {
     auto poolIt = Pool_.find(channelId);
     if (poolIt != Pool_.end()) {
         EraseFromQueueByTime(poolIt->second.GetLastUseTime(), channelId);
@@ -165,6 +197,46 @@ void TChannelPool::DeleteChannel(const std::string& channelId) {
     }
 }
 
+void TChannelPool::WarmUpChannel(const std::string& endpoint, const TGRpcClientConfig& config) {
+    // Only the first unary channel: the rest are opened on demand when the load grows
+    GetStubsHolderLocked(endpoint, EChannelClass::Unary, config, [](TStubsHolder& holder) {
+        holder.Connect();
+    });
+}
+
+bool TChannelPool::UseDedicatedConnections() const {
+    return ChannelsPerEndpoint_ > 1 || SeparateStreamingChannels_;
+}
+
+std::string TChannelPool::MakeSubChannelId(const std::string& endpoint, EChannelClass channelClass, size_t index) const {
+    if (!SeparateStreamingChannels_) {
+        channelClass = EChannelClass::Unary;
+    }
+    return TStringBuilder() << endpoint
+        << '#' << (channelClass == EChannelClass::Unary ? 'u' : 's')
+        << index;
+}
+
+std::string TChannelPool::SelectSubChannel(const std::string& endpoint, EChannelClass channelClass) {
+    size_t bestIndex = 0;
+    i64 bestInFlight = std::numeric_limits<i64>::max();
+
+    std::shared_lock readGuard(RWMutex_);
+    for (size_t i = 0; i < ChannelsPerEndpoint_; ++i) {
+        const auto it = Pool_.find(MakeSubChannelId(endpoint, channelClass, i));
+        // Sub-channel which is not created yet has no outstanding requests
+        const i64 inFlight = it == Pool_.end() ? 0 : it->second.GetInFlight();
+        if (inFlight < bestInFlight) {
+            bestIndex = i;
+            bestInFlight = inFlight;
+            if (inFlight == 0) {
+                break;
+            }
+        }
+    }
+    return MakeSubChannelId(endpoint, channelClass, bestIndex);
+}
+
 void TChannelPool::DeleteExpiredStubsHolders() {
     std::unique_lock writeLock(RWMutex_);
     auto lastExpired = LastUsedQueue_.lower_bound(Now() - ExpireTime_);
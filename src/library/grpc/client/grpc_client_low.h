@@ -200,6 +200,7 @@ struct TCallMeta {
     std::shared_ptr<grpc::CallCredentials> CallCredentials;
     std::vector<std::pair<std::string, std::string>> Aux;
     std::variant<TDuration, TInstant> Timeout; // timeout as duration from now or time point in future
+    grpc_compression_algorithm CompressionAlgorithm = GRPC_COMPRESS_NONE;
 };
 
 class TGRpcRequestProcessorCommon {
@@ -211,6 +212,9 @@ protected:
         if (meta.CallCredentials) {
             Context.set_credentials(meta.CallCredentials);
         }
+        if (meta.CompressionAlgorithm != GRPC_COMPRESS_NONE) {
+            Context.set_compression_algorithm(meta.CompressionAlgorithm);
+        }
         if (const TDuration* timeout = std::get_if<TDuration>(&meta.Timeout)) {
             if (*timeout) {
                 auto deadline = gpr_time_add(
@@ -488,6 +492,23 @@ public:
             state == GRPC_CHANNEL_TRANSIENT_FAILURE;
     }
 
+    // Starts connecting an idle channel in background, no-op for channels already connected
+    void Connect() {
+        ChannelInterface_->GetState(true);
+    }
+
+    // Counts the request as outstanding on this channel until the returned guard is destroyed
+    std::shared_ptr<void> AcquireInFlight() {
+        InFlight_->fetch_add(1, std::memory_order_relaxed);
+        return std::shared_ptr<void>(InFlight_.get(), [inFlight = InFlight_](void*) {
+            inFlight->fetch_sub(1, std::memory_order_relaxed);
+        });
+    }
+
+    i64 GetInFlight() const {
+        return InFlight_->load(std::memory_order_relaxed);
+    }
+
     template<typename TStub>
     std::shared_ptr<TStub> GetOrCreateStub() {
         const auto& stubId = typeid(TStub);
@@ -519,19 +540,37 @@ public:
     }
 private:
     TInstant LastUsed_ = Now();
+    // Shared with in-flight guards, which may outlive the holder
+    std::shared_ptr<std::atomic<i64>> InFlight_ = std::make_shared<std::atomic<i64>>(0);
     std::shared_mutex RWMutex_;
     std::unordered_map<TypeInfoRef, std::shared_ptr<void>, THasher, TEqualTo> Stubs_;
     std::shared_ptr<grpc::ChannelInterface> ChannelInterface_;
 };
 
+// Requests of different classes may be sent over different TCP connections,
+// so large streams don't block latency-sensitive unary calls
+enum class EChannelClass {
+    Unary,
+    Streaming,
+};
+
 class TChannelPool {
 public:
-    TChannelPool(const TTcpKeepAliveSettings& tcpKeepAliveSettings, const TDuration& expireTime = TDuration::Minutes(6));
+    // channelsPerEndpoint - number of TCP connections opened to one endpoint for each channel class
+    // separateStreamingChannels - use dedicated connections for streaming calls
+    TChannelPool(const TTcpKeepAliveSettings& tcpKeepAliveSettings, const TDuration& expireTime = TDuration::Minutes(6),
+        size_t channelsPerEndpoint = 1, bool separateStreamingChannels = false);
     //Allows to CreateStub from TStubsHolder under lock
     //The callback will be called just during GetStubsHolderLocked call
     void GetStubsHolderLocked(const std::string& channelId, const TGRpcClientConfig& config, std::function<void(TStubsHolder&)> cb);
-    void DeleteChannel(const std::string& channelId);
+    //Same as above, but picks the endpoint sub-channel of given class with the least outstanding requests
+    void GetStubsHolderLocked(const std::string& endpoint, EChannelClass channelClass, const TGRpcClientConfig& config,
+        std::function<void(TStubsHolder&)> cb);
+    //Deletes all sub-channels of the endpoint
+    void DeleteChannel(const std::string& endpoint);
     void DeleteExpiredStubsHolders();
+    //Creates channel if it is absent and starts connecting it, so first request doesn't pay for handshake
+    void WarmUpChannel(const std::string& endpoint, const TGRpcClientConfig& config);
 private:
     std::shared_mutex RWMutex_;
     std::unordered_map<std::string, TStubsHolder> Pool_;
@@ -539,7 +578,13 @@ private:
     [[maybe_unused]] TTcpKeepAliveSettings TcpKeepAliveSettings_;
     TDuration ExpireTime_;
     TDuration UpdateReUseTime_;
+    const size_t ChannelsPerEndpoint_;
+    const bool SeparateStreamingChannels_;
     void EraseFromQueueByTime(const TInstant& lastUseTime, const std::string& channelId);
+    void DeleteChannelLocked(const std::string& channelId);
+    std::string MakeSubChannelId(const std::string& endpoint, EChannelClass channelClass, size_t index) const;
+    std::string SelectSubChannel(const std::string& endpoint, EChannelClass channelClass);
+    bool UseDedicatedConnections() const;
 };
 
 template<class TResponse>
@@ -1341,12 +1386,20 @@ private:
                        IQueueClientContextProvider* provider)
         : Stub_(holder.GetOrCreateStub<TStub>())
         , Provider_(provider)
+        , InFlightGuard_(holder.AcquireInFlight())
     {
         Y_ABORT_UNLESS(Provider_, "Connection does not have a queue provider");
     }
 
     std::shared_ptr<TStub> Stub_;
     IQueueClientContextProvider* Provider_;
+    std::shared_ptr<void> InFlightGuard_;
+
+public:
+    // Keep the guard alive while the request is running to account it as outstanding on the channel
+    const std::shared_ptr<void>& GetInFlightGuard() const {
+        return InFlightGuard_;
+    }
 };
 
 class TGRpcClientLow
@@ -2,46 +2,165 @@
 
 #include <util/stream/str.h>
 
+#if defined(_ssse3_)
+#include <tmmintrin.h>
+#endif
+
 namespace NYdb {
 inline namespace V3 {
 namespace NUuid {
 
-static void WriteHexDigit(ui8 digit, IOutputStream& out) {
-    if (digit <= 9) {
-        out << char('0' + digit);
-    }
-    else {
-        out << char('a' + digit - 10);
+namespace {
+
+// Text of a uuid is hex of its bytes in order 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, ..., 15 with dashes
+// after the 4th, 6th, 8th and 10th bytes. The order is its own inverse, so parsing uses it too.
+
+#if defined(_ssse3_)
+
+inline void FormatUuid(const char* bytes, char* out) {
+    const __m128i order = _mm_setr_epi8(3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i hexDigits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i lowNibble = _mm_set1_epi8(0x0f);
+
+    const __m128i value = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes)), order);
+    const __m128i high = _mm_shuffle_epi8(hexDigits, _mm_and_si128(_mm_srli_epi16(value, 4), lowNibble));
+    const __m128i low = _mm_shuffle_epi8(hexDigits, _mm_and_si128(value, lowNibble));
+    // 32 hex digits without dashes
+    const __m128i first = _mm_unpacklo_epi8(high, low);
+    const __m128i second = _mm_unpackhi_epi8(high, low);
+
+    // Dashes go to the zeroed positions 8, 13, 18 and 23
+    const __m128i head = _mm_or_si128(
+        _mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13)),
+        _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0));
+    const __m128i middle = _mm_or_si128(
+        _mm_or_si128(
+            _mm_shuffle_epi8(first, _mm_setr_epi8(14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+            _mm_shuffle_epi8(second, _mm_setr_epi8(-1, -1, -1, 0, 1, 2, 3, -1, 4, 5, 6, 7, 8, 9, 10, 11))),
+        _mm_setr_epi8(0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), head);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), middle);
+    const int tail = _mm_cvtsi128_si32(_mm_srli_si128(second, 12));
+    std::memcpy(out + 32, &tail, 4);
+}
+
+// Values of 16 hex digits, false if some char is not a hex digit
+inline bool DecodeHexDigits(__m128i chars, __m128i& values) {
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i isDigit = _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+        _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    const __m128i isLetter = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) {
+        return false;
     }
+    values = _mm_or_si128(
+        _mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+        _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+    return true;
 }
 
-static void WriteHex(ui16 bytes, IOutputStream& out, bool reverseBytes = false) {
-    if (reverseBytes) {
-        WriteHexDigit((bytes >> 4) & 0x0f, out);
-        WriteHexDigit(bytes & 0x0f, out);
-        WriteHexDigit((bytes >> 12) & 0x0f, out);
-        WriteHexDigit((bytes >> 8) & 0x0f, out);
+inline bool ParseUuid(const char* data, bool shortForm, char* bytes) {
+    __m128i first;
+    __m128i second;
+    if (shortForm) {
+        first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
     } else {
-        WriteHexDigit((bytes >> 12) & 0x0f, out);
-        WriteHexDigit((bytes >> 8) & 0x0f, out);
-        WriteHexDigit((bytes >> 4) & 0x0f, out);
-        WriteHexDigit(bytes & 0x0f, out);
+        if (data[8] != '-' || data[13] != '-' || data[18] != '-' || data[23] != '-') {
+            return false;
+        }
+        // Chars 0-15, 16-31 and 20-35, hex digits are gathered from them skipping the dashes
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+        const __m128i z = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 20));
+        first = _mm_or_si128(
+            _mm_shuffle_epi8(x, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -1, -1)),
+            _mm_shuffle_epi8(y, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1)));
+        second = _mm_or_si128(
+            _mm_shuffle_epi8(y, _mm_setr_epi8(3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+            _mm_shuffle_epi8(z, _mm_setr_epi8(-1, 0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+    }
+
+    if (!DecodeHexDigits(first, first) || !DecodeHexDigits(second, second)) {
+        return false;
+    }
+
+    // Every pair of digits becomes high * 16 + low
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    const __m128i value = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+    const __m128i order = _mm_setr_epi8(3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), _mm_shuffle_epi8(value, order));
+    return true;
+}
+
+#else
+
+constexpr ui8 TextOrder[UUID_LEN] = {3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15};
+
+// Offsets of the hex digit pairs in the text with dashes
+constexpr ui8 PairOffsets[UUID_LEN] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+constexpr char HexDigits[] = "0123456789abcdef";
+
+inline void FormatUuid(const char* bytes, char* out) {
+    out[8] = out[13] = out[18] = out[23] = '-';
+    for (ui32 i = 0; i < UUID_LEN; ++i) {
+        const ui8 byte = bytes[TextOrder[i]];
+        out[PairOffsets[i]] = HexDigits[byte >> 4];
+        out[PairOffsets[i] + 1] = HexDigits[byte & 0x0f];
     }
 }
 
+inline bool ParseUuid(const char* data, bool shortForm, char* bytes) {
+    if (!shortForm && (data[8] != '-' || data[13] != '-' || data[18] != '-' || data[23] != '-')) {
+        return false;
+    }
+    for (ui32 i = 0; i < UUID_LEN; ++i) {
+        const char* pair = data + (shortForm ? i * 2 : PairOffsets[i]);
+        ui32 high = 0;
+        ui32 low = 0;
+        if (!GetDigit(pair[0], high) || !GetDigit(pair[1], low)) {
+            return false;
+        }
+        bytes[TextOrder[i]] = high * 16 + low;
+    }
+    return true;
+}
+
+#endif
+
+} // namespace
+
 void UuidToString(ui16 dw[8], IOutputStream& out) {
-    WriteHex(dw[1], out);
-    WriteHex(dw[0], out);
-    out << '-';
-    WriteHex(dw[2], out);
-    out << '-';
-    WriteHex(dw[3], out);
-    out << '-';
-    WriteHex(dw[4], out, true);
-    out << '-';
-    WriteHex(dw[5], out, true);
-    WriteHex(dw[6], out, true);
-    WriteHex(dw[7], out, true);
+    char text[UUID_TEXT_LEN];
+    FormatUuid(reinterpret_cast<const char*>(dw), text);
+    out.Write(text, UUID_TEXT_LEN);
+}
+
+void UuidBytesToChars(const char* bytes, char* out) {
+    FormatUuid(bytes, out);
+}
+
+void UuidHalfsToChars(ui64 low, ui64 hi, char* out) {
+    const ui64 halfs[2] = {low, hi};
+    FormatUuid(reinterpret_cast<const char*>(halfs), out);
+}
+
+void UuidsBytesToChars(const char* bytes, size_t count, char* out) {
+    for (size_t i = 0; i < count; ++i) {
+        FormatUuid(bytes + i * UUID_LEN, out + i * UUID_TEXT_LEN);
+    }
+}
+
+bool ParseUuidToBytes(const char* data, size_t size, char* bytes, bool shortForm) {
+    if (size != (shortForm ? 32 : UUID_TEXT_LEN)) {
+        return false;
+    }
+    return ParseUuid(data, shortForm, bytes);
 }
 
 std::string UuidBytesToString(const std::string& in) {
@@ -14,6 +14,7 @@ inline namespace V3 {
 namespace NUuid {
 
 static constexpr ui32 UUID_LEN = 16;
+static constexpr ui32 UUID_TEXT_LEN = 36;
 
 std::string UuidBytesToString(const std::string& in);
 void UuidBytesToString(const std::string& in, IOutputStream& out);
@@ -21,6 +22,15 @@ void UuidHalfsToString(ui64 low, ui64 hi, IOutputStream& out);
 void UuidToString(ui16 dw[8], IOutputStream& out);
 void UuidHalfsToByteString(ui64 low, ui64 hi, IOutputStream& out);
 
+// Text form of UUID_LEN bytes, out must have room for UUID_TEXT_LEN chars
+void UuidBytesToChars(const char* bytes, char* out);
+void UuidHalfsToChars(ui64 low, ui64 hi, char* out);
+// Converts count uuids laid out one after another, out must have room for count * UUID_TEXT_LEN chars
+void UuidsBytesToChars(const char* bytes, size_t count, char* out);
+
+// Parses text (36 chars or 32 without dashes in short form) to UUID_LEN bytes
+bool ParseUuidToBytes(const char* data, size_t size, char* bytes, bool shortForm);
+
 inline bool GetDigit(char c, ui32& digit) {
     digit = 0;
     if ('0' <= c && c <= '9') {
@@ -61,43 +71,11 @@ inline bool IsValidUuid(const T& buf) {
 
 template<typename T>
 bool ParseUuidToArray(const T& buf, ui16* dw, bool shortForm) {
-    if (buf.size() != (shortForm ? 32 : 36)) {
+    char bytes[UUID_LEN];
+    if (!ParseUuidToBytes(buf.data(), buf.size(), bytes, shortForm)) {
         return false;
     }
-
-    size_t partId = 0;
-    ui64 partValue = 0;
-    size_t digitCount = 0;
-
-    for (size_t i = 0; i < buf.size(); ++i) {
-        const char c = buf.data()[i];
-
-        if (!shortForm && (i == 8 || i == 13 || i == 18 || i == 23)) {
-            if (c == '-') {
-                continue;
-            } else {
-                return false;
-            }
-        }
-
-        ui32 digit = 0;
-        if (!GetDigit(c, digit)) {
-            return false;
-        }
-
-        partValue = partValue * 16 + digit;
-
-        if (++digitCount == 4) {
-            dw[partId++] = partValue;
-            digitCount = 0;
-        }
-    }
-
-    std::swap(dw[0], dw[1]);
-    for (ui32 i = 4; i < 8; ++i) {
-        dw[i] = ((dw[i] >> 8) & 0xff) | ((dw[i] & 0xff) << 8);
-    }
-
+    std::memcpy(dw, bytes, UUID_LEN);
     return true;
 }
 
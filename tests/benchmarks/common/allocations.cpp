@@ -0,0 +1,26 @@
+#include "allocations.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace NYdb::NBenchmarks {
+
+std::atomic<size_t> AllocationsCount = 0;
+
+} // namespace NYdb::NBenchmarks
+
+void* operator new(size_t size) {
+    NYdb::NBenchmarks::AllocationsCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
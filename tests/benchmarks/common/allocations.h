@@ -0,0 +1,32 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace NYdb::NBenchmarks {
+
+// Number of global operator new calls made by the process
+extern std::atomic<size_t> AllocationsCount;
+
+// Reports the number of heap allocations per iteration next to the timings.
+class TAllocationCounter {
+public:
+    explicit TAllocationCounter(benchmark::State& state)
+        : State_(state)
+        , Start_(AllocationsCount.load(std::memory_order_relaxed))
+    {}
+
+    ~TAllocationCounter() {
+        const size_t allocations = AllocationsCount.load(std::memory_order_relaxed) - Start_;
+        State_.counters["allocs_per_iter"] = benchmark::Counter(
+            static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& State_;
+    const size_t Start_;
+};
+
+} // namespace NYdb::NBenchmarks
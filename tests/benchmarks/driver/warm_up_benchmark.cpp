@@ -0,0 +1,130 @@
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/table/table.h>
+
+#include <src/api/grpc/ydb_discovery_v1.grpc.pb.h>
+#include <src/api/grpc/ydb_table_v1.grpc.pb.h>
+
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace NYdb;
+
+namespace {
+
+const std::string Database = "/Root/Bench";
+
+class TFakeDiscoveryService : public Ydb::Discovery::V1::DiscoveryService::Service {
+public:
+    grpc::Status ListEndpoints(
+            grpc::ServerContext*,
+            const Ydb::Discovery::ListEndpointsRequest*,
+            Ydb::Discovery::ListEndpointsResponse* response) override
+    {
+        auto* op = response->mutable_operation();
+        op->set_ready(true);
+        op->set_status(Ydb::StatusIds::SUCCESS);
+        op->mutable_result()->PackFrom(Result);
+        return grpc::Status::OK;
+    }
+
+    Ydb::Discovery::ListEndpointsResult Result;
+};
+
+class TFakeTableService : public Ydb::Table::V1::TableService::Service {
+public:
+    grpc::Status CreateSession(
+            grpc::ServerContext*,
+            const Ydb::Table::CreateSessionRequest*,
+            Ydb::Table::CreateSessionResponse* response) override
+    {
+        Ydb::Table::CreateSessionResult result;
+        result.set_session_id("bench-session-" + std::to_string(++SessionsCount));
+
+        auto* op = response->mutable_operation();
+        op->set_ready(true);
+        op->set_status(Ydb::StatusIds::SUCCESS);
+        op->mutable_result()->PackFrom(result);
+        return grpc::Status::OK;
+    }
+
+    std::atomic<ui64> SessionsCount = 0;
+};
+
+// Discovery and table services on separate local ports, the same layout a real cluster has
+class TFakeCluster {
+public:
+    TFakeCluster() {
+        int tablePort = 0;
+        TableServer_ = Start(TableService_, tablePort);
+
+        auto* endpoint = DiscoveryService_.Result.add_endpoints();
+        endpoint->set_address("127.0.0.1");
+        endpoint->set_port(tablePort);
+
+        int discoveryPort = 0;
+        DiscoveryServer_ = Start(DiscoveryService_, discoveryPort);
+        DiscoveryEndpoint_ = "127.0.0.1:" + std::to_string(discoveryPort);
+    }
+
+    const std::string& GetDiscoveryEndpoint() const {
+        return DiscoveryEndpoint_;
+    }
+
+private:
+    template <class TService>
+    static std::unique_ptr<grpc::Server> Start(TService& service, int& port) {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+        builder.RegisterService(&service);
+        return builder.BuildAndStart();
+    }
+
+    TFakeDiscoveryService DiscoveryService_;
+    TFakeTableService TableService_;
+    std::unique_ptr<grpc::Server> DiscoveryServer_;
+    std::unique_ptr<grpc::Server> TableServer_;
+    std::string DiscoveryEndpoint_;
+};
+
+// Measures the latency of the first GetSession after the driver has started,
+// with channel and session warm-up disabled (0) or enabled (1)
+void BM_FirstSessionLatency(benchmark::State& state) {
+    static TFakeCluster cluster;
+    const bool warmUp = state.range(0);
+
+    for (auto _ : state) {
+        TDriver driver(TDriverConfig()
+            .SetEndpoint(cluster.GetDiscoveryEndpoint())
+            .SetDatabase(Database)
+            .SetWarmUpEndpointsCount(warmUp ? 1 : 0));
+
+        NTable::TTableClient client(driver, NTable::TClientSettings()
+            .SessionPoolSettings(NTable::TSessionPoolSettings()
+                .WarmUpSessions(warmUp ? 1 : 0)));
+
+        // Application start-up work happens here, warm-up runs in background meanwhile
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        const auto start = std::chrono::steady_clock::now();
+        auto result = client.GetSession().ExtractValueSync();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        if (!result.IsSuccess()) {
+            state.SkipWithError("GetSession failed");
+            break;
+        }
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        driver.Stop(true);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_FirstSessionLatency)->Arg(0)->Arg(1)->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,71 @@
+#include <src/client/impl/ydb_endpoints/endpoints.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace NYdb;
+
+namespace {
+
+std::vector<TEndpointRecord> MakeRecords(size_t count) {
+    std::vector<TEndpointRecord> records;
+    records.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        records.emplace_back("ydb-node-" + std::to_string(i) + ".example.net:2135", static_cast<i32>(i % 3), "", i + 1);
+    }
+    return records;
+}
+
+TEndpointElectorSafe& GetElector() {
+    static TEndpointElectorSafe* elector = [] {
+        auto* elector = new TEndpointElectorSafe();
+        elector->SetNewState(MakeRecords(64));
+        return elector;
+    }();
+    return *elector;
+}
+
+} // namespace
+
+static void BM_ElectorGetEndpoint(benchmark::State& state) {
+    auto& elector = GetElector();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(elector.GetEndpoint(TEndpointKey()));
+    }
+}
+BENCHMARK(BM_ElectorGetEndpoint)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ElectorGetPreferredEndpoint(benchmark::State& state) {
+    auto& elector = GetElector();
+    const TEndpointKey preferred("ydb-node-42.example.net:2135", 43);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(elector.GetEndpoint(preferred, true));
+    }
+}
+BENCHMARK(BM_ElectorGetPreferredEndpoint)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ElectorSetNewState(benchmark::State& state) {
+    const auto records = MakeRecords(state.range(0));
+    TEndpointElectorSafe elector;
+    for (auto _ : state) {
+        auto copy = records;
+        benchmark::DoNotOptimize(elector.SetNewState(std::move(copy)));
+    }
+}
+BENCHMARK(BM_ElectorSetNewState)->Arg(8)->Arg(256);
+
+static void BM_ElectorGetWithPessimization(benchmark::State& state) {
+    TEndpointElectorSafe elector;
+    elector.SetNewState(MakeRecords(64));
+    size_t i = 0;
+    for (auto _ : state) {
+        // Discovery resets pessimization, so restore the state from time to time
+        if (++i % 64 == 0) {
+            state.PauseTiming();
+            elector.SetNewState(MakeRecords(64));
+            state.ResumeTiming();
+        }
+        auto endpoint = elector.GetEndpoint(TEndpointKey());
+        elector.PessimizeEndpoint(endpoint.Endpoint);
+    }
+}
+BENCHMARK(BM_ElectorGetWithPessimization);
@@ -0,0 +1,254 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/query/client.h>
+#include <ydb-cpp-sdk/client/table/csv_upsert.h>
+#include <ydb-cpp-sdk/client/table/table.h>
+#include <ydb-cpp-sdk/client/value/value.h>
+
+#include <src/api/protos/ydb_formats.pb.h>
+
+#include <util/stream/mem.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace NYdb;
+
+namespace {
+
+// One fake server and driver per benchmark run, shared by all benchmark threads.
+// Thread 0 sets it up before the timed loop and tears it down after it.
+struct TLoadEnv {
+    explicit TLoadEnv(const NTests::TFakeServerSettings& settings)
+        : Server(settings)
+        , Driver(TDriverConfig()
+            .SetEndpoint(Server.GetEndpoint())
+            .SetDatabase(Server.GetDatabase()))
+        , TableClient(Driver)
+        , QueryClient(Driver)
+    {}
+
+    ~TLoadEnv() {
+        Driver.Stop(true);
+    }
+
+    NTests::TFakeServer Server;
+    TDriver Driver;
+    NTable::TTableClient TableClient;
+    NQuery::TQueryClient QueryClient;
+};
+
+std::unique_ptr<TLoadEnv> Env;
+
+NTests::TFakeServerSettings MakeSettings(const benchmark::State& state) {
+    return NTests::TFakeServerSettings()
+        .Latency(TDuration::MicroSeconds(state.range(0)))
+        .ErrorRate(state.range(1) / 100.0);
+}
+
+void Setup(const benchmark::State& state, const NTests::TFakeServerSettings& settings) {
+    if (state.thread_index() == 0) {
+        Env = std::make_unique<TLoadEnv>(settings);
+    }
+}
+
+void Setup(const benchmark::State& state) {
+    Setup(state, MakeSettings(state));
+}
+
+void Teardown(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        const auto stats = Env->Server.GetStats();
+        state.counters["calls"] = stats.Calls;
+        state.counters["errors"] = stats.InjectedErrors;
+        state.counters["sessions"] = stats.SessionsCreated;
+        Env.reset();
+    }
+}
+
+// Data query with retries through the table session pool,
+// arguments are server latency in microseconds and error rate in percent
+void BM_TableExecuteDataQuery(benchmark::State& state) {
+    Setup(state);
+
+    for (auto _ : state) {
+        auto status = Env->TableClient.RetryOperationSync([](NTable::TSession session) {
+            return session.ExecuteDataQuery("SELECT 1",
+                NTable::TTxControl::BeginTx(NTable::TTxSettings::SerializableRW()).CommitTx()).GetValueSync();
+        });
+        if (!status.IsSuccess()) {
+            state.SkipWithError("ExecuteDataQuery failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    Teardown(state);
+}
+
+// The same load through the query service, which streams result parts over an attached session
+void BM_QueryExecuteQuery(benchmark::State& state) {
+    Setup(state);
+
+    for (auto _ : state) {
+        auto status = Env->QueryClient.RetryQuerySync([](NQuery::TSession session) {
+            return session.ExecuteQuery("SELECT 1",
+                NQuery::TTxControl::BeginTx(NQuery::TTxSettings::SerializableRW()).CommitTx()).GetValueSync();
+        });
+        if (!status.IsSuccess()) {
+            state.SkipWithError("ExecuteQuery failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    Teardown(state);
+}
+
+void BM_BulkUpsert(benchmark::State& state) {
+    Setup(state);
+
+    const std::size_t rowsCount = 1000;
+    TValueBuilder rows;
+    rows.BeginList();
+    for (std::size_t i = 0; i < rowsCount; ++i) {
+        rows.AddListItem()
+            .BeginStruct()
+                .AddMember("id").Uint64(i)
+                .AddMember("payload").Utf8("payload")
+            .EndStruct();
+    }
+    rows.EndList();
+    const auto value = rows.Build();
+
+    for (auto _ : state) {
+        auto status = Env->TableClient.RetryOperationSync([&value](NTable::TTableClient& client) {
+            return client.BulkUpsert("/Root/Fake/bench", TValue(value)).GetValueSync();
+        });
+        if (!status.IsSuccess()) {
+            state.SkipWithError("BulkUpsert failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rowsCount);
+
+    Teardown(state);
+}
+
+// CSV upload split into chunks of the given size in KB, with a header and quoted fields
+void BM_BulkUpsertCsv(benchmark::State& state) {
+    Setup(state);
+
+    const std::size_t rowsCount = 100000;
+    std::string data = "id,payload\n";
+    for (std::size_t i = 0; i < rowsCount; ++i) {
+        data += std::to_string(i) + ",\"payload, number " + std::to_string(i) + "\"\n";
+    }
+
+    Ydb::Formats::CsvSettings csvSettings;
+    csvSettings.set_header(true);
+    const auto settings = NTable::TCsvUpsertSettings()
+        .ChunkSize(state.range(2) << 10)
+        .BulkUpsertSettings(NTable::TBulkUpsertSettings().FormatSettings(csvSettings.SerializeAsString()));
+
+    std::uint64_t rows = 0;
+    for (auto _ : state) {
+        TMemoryInput input(data.data(), data.size());
+        auto result = NTable::BulkUpsertCsv(Env->TableClient, "/Root/Fake/bench", input, settings);
+        if (!result.IsSuccess()) {
+            state.SkipWithError("BulkUpsertCsv failed");
+            break;
+        }
+        rows += result.GetProgress().Rows;
+    }
+    state.SetItemsProcessed(rows);
+    state.SetBytesProcessed(state.iterations() * data.size());
+
+    Teardown(state);
+}
+
+constexpr std::uint64_t READ_TABLE_PARTS_PER_SHARD = 16;
+
+// Full table read, arguments are server latency of every part in microseconds and number of shards
+NTests::TFakeServerSettings MakeReadTableSettings(const benchmark::State& state) {
+    return NTests::TFakeServerSettings()
+        .Latency(TDuration::MicroSeconds(state.range(0)))
+        .TableShards(state.range(1))
+        .ResultParts(READ_TABLE_PARTS_PER_SHARD);
+}
+
+void BM_ReadTable(benchmark::State& state) {
+    Setup(state, MakeReadTableSettings(state));
+
+    std::uint64_t rows = 0;
+    for (auto _ : state) {
+        auto session = Env->TableClient.GetSession().GetValueSync().GetSession();
+        auto iterator = session.ReadTable("/Root/Fake/bench").GetValueSync();
+        for (;;) {
+            auto part = iterator.ReadNext().GetValueSync();
+            if (part.EOS()) {
+                break;
+            }
+            if (!part.IsSuccess()) {
+                state.SkipWithError("ReadTable failed");
+                break;
+            }
+            rows += part.GetPart().RowsCount();
+        }
+    }
+    state.SetItemsProcessed(rows);
+
+    Teardown(state);
+}
+
+void BM_ReadTableParallel(benchmark::State& state) {
+    Setup(state, MakeReadTableSettings(state));
+
+    std::uint64_t rows = 0;
+    for (auto _ : state) {
+        auto iterator = Env->TableClient.ReadTableParallel("/Root/Fake/bench",
+            NTable::TParallelReadTableSettings().MaxStreams(state.range(1))).GetValueSync();
+        for (;;) {
+            auto part = iterator.ReadNext().GetValueSync();
+            if (part.EOS()) {
+                break;
+            }
+            if (!part.IsSuccess()) {
+                state.SkipWithError("ReadTableParallel failed");
+                break;
+            }
+            rows += part.GetPart().RowsCount();
+        }
+    }
+    state.SetItemsProcessed(rows);
+
+    Teardown(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_TableExecuteDataQuery)
+    ->Args({0, 0})->Args({1000, 0})->Args({1000, 5})
+    ->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_QueryExecuteQuery)
+    ->Args({0, 0})->Args({1000, 0})->Args({1000, 5})
+    ->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BulkUpsert)
+    ->Args({0, 0})->Args({1000, 5})
+    ->Threads(1)->Threads(8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ReadTable)
+    ->Args({100, 1})->Args({100, 8})->Args({100, 32})
+    ->Threads(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ReadTableParallel)
+    ->Args({100, 1})->Args({100, 8})->Args({100, 32})
+    ->Threads(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_BulkUpsertCsv)
+    ->Args({0, 0, 64})->Args({0, 0, 1024})->Args({1000, 0, 256})
+    ->Threads(1)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,186 @@
+#include <ydb-cpp-sdk/client/result/result.h>
+#include <ydb-cpp-sdk/type_switcher.h>
+
+#define INCLUDE_YDB_INTERNAL_H
+#include <src/client/impl/ydb_internal/make_request/arena_pool.h>
+#undef INCLUDE_YDB_INTERNAL_H
+
+#include <src/api/protos/ydb_query.pb.h>
+#include <src/api/protos/ydb_table.pb.h>
+
+#include <tests/benchmarks/common/allocations.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace NYdb;
+using NYdb::NBenchmarks::TAllocationCounter;
+
+namespace {
+
+TStringType MakeQueryPart(size_t rowsCount) {
+    Ydb::Query::ExecuteQueryResponsePart part;
+    part.set_status(Ydb::StatusIds::SUCCESS);
+    auto& resultSet = *part.mutable_result_set();
+
+    auto& idColumn = *resultSet.add_columns();
+    idColumn.set_name("id");
+    idColumn.mutable_type()->set_type_id(Ydb::Type::UINT64);
+
+    auto& nameColumn = *resultSet.add_columns();
+    nameColumn.set_name("name");
+    nameColumn.mutable_type()->set_type_id(Ydb::Type::UTF8);
+
+    for (size_t i = 0; i < rowsCount; ++i) {
+        auto& row = *resultSet.add_rows();
+        row.add_items()->set_uint64_value(i);
+        row.add_items()->set_text_value("name of the row number " + std::to_string(i));
+    }
+
+    TStringType data;
+    Y_ABORT_UNLESS(part.SerializeToString(&data));
+    return data;
+}
+
+google::protobuf::Map<TStringType, Ydb::TypedValue> MakeParams(size_t paramsCount) {
+    google::protobuf::Map<TStringType, Ydb::TypedValue> params;
+    for (size_t i = 0; i < paramsCount; ++i) {
+        auto& param = params["$param" + std::to_string(i)];
+        param.mutable_type()->set_type_id(Ydb::Type::UTF8);
+        param.mutable_value()->set_text_value("value of the parameter number " + std::to_string(i));
+    }
+    return params;
+}
+
+// Drops arenas on a thread of its own, as the gRPC and user threads do on the real paths
+class TArenaReleaser {
+public:
+    TArenaReleaser()
+        : Thread_([this] { Run(); })
+    {}
+
+    ~TArenaReleaser() {
+        {
+            std::lock_guard lock(Lock_);
+            Stopped_ = true;
+        }
+        Changed_.notify_all();
+        Thread_.join();
+    }
+
+    // Returns once the other thread has released all arenas
+    void Release(std::vector<std::shared_ptr<google::protobuf::Arena>>& arenas) {
+        std::unique_lock lock(Lock_);
+        Arenas_.swap(arenas);
+        Changed_.notify_all();
+        Changed_.wait(lock, [this] { return Arenas_.empty(); });
+    }
+
+private:
+    void Run() {
+        std::unique_lock lock(Lock_);
+        while (true) {
+            Changed_.wait(lock, [this] { return Stopped_ || !Arenas_.empty(); });
+            if (Stopped_) {
+                return;
+            }
+            Arenas_.clear();
+            Changed_.notify_all();
+        }
+    }
+
+    std::mutex Lock_;
+    std::condition_variable Changed_;
+    std::vector<std::shared_ptr<google::protobuf::Arena>> Arenas_;
+    bool Stopped_ = false;
+    std::thread Thread_;
+};
+
+} // namespace
+
+static void BM_ParseQueryPartHeap(benchmark::State& state) {
+    const auto data = MakeQueryPart(state.range(0));
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        Ydb::Query::ExecuteQueryResponsePart part;
+        Y_ABORT_UNLESS(part.ParseFromString(data));
+        TResultSet resultSet(std::move(*part.mutable_result_set()));
+        benchmark::DoNotOptimize(resultSet.RowsCount());
+    }
+}
+BENCHMARK(BM_ParseQueryPartHeap)->Arg(10)->Arg(1000);
+
+static void BM_ParseQueryPartArena(benchmark::State& state) {
+    const auto data = MakeQueryPart(state.range(0));
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        auto arena = TArenaPool::Acquire();
+        auto* part = google::protobuf::Arena::CreateMessage<Ydb::Query::ExecuteQueryResponsePart>(arena.get());
+        Y_ABORT_UNLESS(part->ParseFromString(data));
+        TResultSet resultSet(part->mutable_result_set(), std::move(arena));
+        benchmark::DoNotOptimize(resultSet.RowsCount());
+    }
+}
+BENCHMARK(BM_ParseQueryPartArena)->Arg(10)->Arg(1000);
+
+// Arenas are acquired here and released on the other thread, they must still be reused
+static void BM_ParseQueryPartArenaReleasedOnOtherThread(benchmark::State& state) {
+    constexpr size_t batchSize = 16;
+    const auto data = MakeQueryPart(state.range(0));
+    TArenaReleaser releaser;
+    std::vector<std::shared_ptr<google::protobuf::Arena>> arenas;
+    arenas.reserve(batchSize);
+
+    // Arenas of the first batch, every next batch must get the same ones back
+    std::vector<const google::protobuf::Arena*> reused;
+    reused.reserve(batchSize);
+
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batchSize; ++i) {
+            auto arena = TArenaPool::Acquire();
+            if (reused.size() < batchSize) {
+                reused.push_back(arena.get());
+            } else {
+                Y_ABORT_UNLESS(std::find(reused.begin(), reused.end(), arena.get()) != reused.end());
+            }
+            auto* part = google::protobuf::Arena::CreateMessage<Ydb::Query::ExecuteQueryResponsePart>(arena.get());
+            Y_ABORT_UNLESS(part->ParseFromString(data));
+            benchmark::DoNotOptimize(part->result_set().rows_size());
+            arenas.push_back(std::move(arena));
+        }
+        releaser.Release(arenas);
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_ParseQueryPartArenaReleasedOnOtherThread)->Arg(10)->Arg(1000);
+
+static void BM_BuildDataQueryRequestHeap(benchmark::State& state) {
+    const auto params = MakeParams(state.range(0));
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        Ydb::Table::ExecuteDataQueryRequest request;
+        request.set_session_id("ydb://session/3?node_id=1&id=NjhmZTk0MjYtNDJkNjE0YzgtYzg5YjE0MWItOTkwMzQ3NjA=");
+        request.mutable_query()->set_yql_text("DECLARE $param0 AS Utf8; SELECT $param0;");
+        *request.mutable_parameters() = params;
+        benchmark::DoNotOptimize(request.ByteSizeLong());
+    }
+}
+BENCHMARK(BM_BuildDataQueryRequestHeap)->Arg(1)->Arg(32);
+
+static void BM_BuildDataQueryRequestArena(benchmark::State& state) {
+    const auto params = MakeParams(state.range(0));
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        auto arena = TArenaPool::Acquire();
+        auto* request = google::protobuf::Arena::CreateMessage<Ydb::Table::ExecuteDataQueryRequest>(arena.get());
+        request->set_session_id("ydb://session/3?node_id=1&id=NjhmZTk0MjYtNDJkNjE0YzgtYzg5YjE0MWItOTkwMzQ3NjA=");
+        request->mutable_query()->set_yql_text("DECLARE $param0 AS Utf8; SELECT $param0;");
+        *request->mutable_parameters() = params;
+        benchmark::DoNotOptimize(request->ByteSizeLong());
+    }
+}
+BENCHMARK(BM_BuildDataQueryRequestArena)->Arg(1)->Arg(32);
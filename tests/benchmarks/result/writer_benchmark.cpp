@@ -0,0 +1,80 @@
+#include <ydb-cpp-sdk/client/result/result.h>
+#include <ydb-cpp-sdk/client/result/writer.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+
+#include <util/stream/null.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace NYdb;
+
+namespace {
+
+TResultSet MakeResultSet(size_t rowsCount) {
+    Ydb::ResultSet resultSet;
+
+    auto addColumn = [&resultSet](const std::string& name, Ydb::Type::PrimitiveTypeId typeId) {
+        auto& column = *resultSet.add_columns();
+        column.set_name(name);
+        column.mutable_type()->mutable_optional_type()->mutable_item()->set_type_id(typeId);
+    };
+    addColumn("id", Ydb::Type::UINT64);
+    addColumn("name", Ydb::Type::UTF8);
+    addColumn("created", Ydb::Type::TIMESTAMP);
+    addColumn("score", Ydb::Type::DOUBLE);
+
+    for (size_t i = 0; i < rowsCount; ++i) {
+        auto& row = *resultSet.add_rows();
+        row.add_items()->set_uint64_value(i);
+        if (i % 10 == 0) {
+            row.add_items()->set_null_flag_value(google::protobuf::NULL_VALUE);
+        } else {
+            row.add_items()->set_text_value("name of the row number " + std::to_string(i));
+        }
+        row.add_items()->set_uint64_value(1700000000000000 + i * 1000);
+        row.add_items()->set_double_value(i / 7.0);
+    }
+    return TResultSet(std::move(resultSet));
+}
+
+} // namespace
+
+// Baseline: cells are read through TResultSetParser column parsers and written with the stream operators
+static void BM_WriteResultSetParser(benchmark::State& state) {
+    const auto resultSet = MakeResultSet(state.range(0));
+    TNullOutput out;
+    for (auto _ : state) {
+        TResultSetParser parser(resultSet);
+        while (parser.TryNextRow()) {
+            out << parser.ColumnParser("id").GetOptionalUint64().value_or(0) << ',';
+            if (auto name = parser.ColumnParser("name").GetOptionalUtf8()) {
+                out << *name;
+            }
+            out << ',' << parser.ColumnParser("created").GetOptionalTimestamp().value_or(TInstant::Zero()).ToString();
+            out << ',' << parser.ColumnParser("score").GetOptionalDouble().value_or(0) << '\n';
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteResultSetParser)->Arg(1000)->Arg(100000);
+
+static void BM_WriteCsv(benchmark::State& state) {
+    const auto resultSet = MakeResultSet(state.range(0));
+    TNullOutput out;
+    for (auto _ : state) {
+        CreateCsvWriter(out)->Write(resultSet);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteCsv)->Arg(1000)->Arg(100000);
+
+static void BM_WriteJsonLines(benchmark::State& state) {
+    const auto resultSet = MakeResultSet(state.range(0));
+    TNullOutput out;
+    for (auto _ : state) {
+        CreateJsonLinesWriter(out)->Write(resultSet);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteJsonLines)->Arg(1000)->Arg(100000);
@@ -0,0 +1,90 @@
+#define INCLUDE_YDB_INTERNAL_H
+#include <src/client/impl/ydb_internal/session_pool/session_pool.h>
+#undef INCLUDE_YDB_INTERNAL_H
+
+#include <tests/benchmarks/common/allocations.h>
+
+#include <atomic>
+
+using namespace NYdb;
+using namespace NYdb::NSessionPool;
+using NYdb::NBenchmarks::TAllocationCounter;
+
+namespace {
+
+// Remembers the session given by the pool, new sessions are "created" in place
+class TGetSessionCtx : public IGetSessionCtx {
+public:
+    explicit TGetSessionCtx(TKqpSessionCommon*& session)
+        : Session_(session)
+    {}
+
+    void ReplySessionToUser(TKqpSessionCommon* session) override {
+        Session_ = session;
+    }
+
+    void ReplyError(TStatus) override {
+        Session_ = nullptr;
+    }
+
+    void ReplyNewSession() override {
+        static std::atomic<ui64> sessionId = 0;
+        Session_ = new TKqpSessionCommon(
+            "ydb://session/3?node_id=1&id=" + std::to_string(++sessionId), "ydb-node-01.example.net:2135", true);
+        Session_->MarkActive();
+        Session_->SetNeedUpdateActiveCounter(true);
+    }
+
+private:
+    TKqpSessionCommon*& Session_;
+};
+
+void DeleteSessions(TSessionPool& pool) {
+    pool.Drain([](std::unique_ptr<TKqpSessionCommon>&&) {
+        return true;
+    }, true);
+}
+
+} // namespace
+
+static void BM_SessionPoolGetReturn(benchmark::State& state) {
+    static TSessionPool* pool = nullptr;
+    if (state.thread_index() == 0) {
+        pool = new TSessionPool(0);
+    }
+
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TKqpSessionCommon* session = nullptr;
+        pool->GetSession(std::make_unique<TGetSessionCtx>(session));
+        session->MarkIdle();
+        pool->ReturnSession(session, true);
+    }
+
+    if (state.thread_index() == 0) {
+        DeleteSessions(*pool);
+        delete pool;
+    }
+}
+BENCHMARK(BM_SessionPoolGetReturn)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_SessionPoolWaiters(benchmark::State& state) {
+    // One session for all, every other request waits in the queue
+    TSessionPool pool(1);
+    TKqpSessionCommon* session = nullptr;
+    pool.GetSession(std::make_unique<TGetSessionCtx>(session));
+
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TKqpSessionCommon* next = nullptr;
+        pool.GetSession(std::make_unique<TGetSessionCtx>(next));
+        session->MarkIdle();
+        pool.ReturnSession(session, true);
+        session = next;
+    }
+
+    session->MarkIdle();
+    pool.ReturnSession(session, true);
+    DeleteSessions(pool);
+}
+BENCHMARK(BM_SessionPoolWaiters);
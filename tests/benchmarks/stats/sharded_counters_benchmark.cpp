@@ -0,0 +1,60 @@
+#include <src/client/impl/ydb_stats/sharded.h>
+
+#include <library/cpp/monlib/metrics/metric.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace NYdb::NSdkStats;
+
+namespace {
+
+// Every benchmark thread updates the same metric, like client threads updating
+// the per-database counters of one driver
+
+void BM_SharedRateInc(benchmark::State& state) {
+    static ::NMonitoring::TRate rate;
+
+    for (auto _ : state) {
+        rate.Inc();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ShardedCounterInc(benchmark::State& state) {
+    static TShardedCounter counter;
+
+    for (auto _ : state) {
+        counter.Inc();
+    }
+    benchmark::DoNotOptimize(counter.Get());
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SharedHistogramCollect(benchmark::State& state) {
+    static ::NMonitoring::THistogram histogram(::NMonitoring::ExponentialHistogram(20, 2, 1), true);
+
+    double value = 0;
+    for (auto _ : state) {
+        histogram.Record(value);
+        value = value < 1e6 ? value * 2 + 1 : 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ShardedHistogramCollect(benchmark::State& state) {
+    static ::NMonitoring::THistogram histogram(ShardedExponentialHistogram(20, 2, 1)(), true);
+
+    double value = 0;
+    for (auto _ : state) {
+        histogram.Record(value);
+        value = value < 1e6 ? value * 2 + 1 : 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_SharedRateInc)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ShardedCounterInc)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_SharedHistogramCollect)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ShardedHistogramCollect)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,81 @@
+#include <ydb-cpp-sdk/client/topic/codecs.h>
+
+#include <benchmark/benchmark.h>
+
+#include <util/system/spinlock.h>
+
+#include <mutex>
+
+using namespace NYdb::NTopic;
+
+namespace {
+
+// Codec registry as it was before lock-free lookups: adaptive lock and hash map per lookup.
+class TLockedCodecMap {
+public:
+    void Set(uint32_t codecId, std::unique_ptr<ICodec>&& codecImpl) {
+        std::lock_guard guard(Lock);
+        Codecs[codecId] = std::move(codecImpl);
+    }
+
+    const ICodec* GetOrThrow(uint32_t codecId) const {
+        std::lock_guard guard(Lock);
+        auto it = Codecs.find(codecId);
+        if (it == Codecs.end()) {
+            throw yexception() << "codec with id " << codecId << " not provided";
+        }
+        return it->second.get();
+    }
+
+private:
+    std::unordered_map<uint32_t, std::unique_ptr<ICodec>> Codecs;
+    TAdaptiveLock Lock;
+};
+
+TLockedCodecMap& GetLockedCodecMap() {
+    static TLockedCodecMap* codecMap = []() {
+        auto* codecMap = new TLockedCodecMap();
+        codecMap->Set(static_cast<uint32_t>(ECodec::GZIP), std::make_unique<TGzipCodec>());
+        codecMap->Set(static_cast<uint32_t>(ECodec::ZSTD), std::make_unique<TZstdCodec>());
+        return codecMap;
+    }();
+    return *codecMap;
+}
+
+} // namespace
+
+static void BM_CodecMapGetOrThrow(benchmark::State& state) {
+    auto& codecMap = TCodecMap::GetTheCodecMap();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codecMap.GetOrThrow(static_cast<uint32_t>(ECodec::ZSTD)));
+    }
+}
+BENCHMARK(BM_CodecMapGetOrThrow)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_LockedCodecMapGetOrThrow(benchmark::State& state) {
+    auto& codecMap = GetLockedCodecMap();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codecMap.GetOrThrow(static_cast<uint32_t>(ECodec::ZSTD)));
+    }
+}
+BENCHMARK(BM_LockedCodecMapGetOrThrow)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_CodecMapGetOrThrowCustom(benchmark::State& state) {
+    auto& codecMap = TCodecMap::GetTheCodecMap();
+    static const uint32_t customCodecId = [&codecMap]() {
+        const uint32_t codecId = static_cast<uint32_t>(ECodec::CUSTOM) + 1;
+        codecMap.Set(codecId, std::make_unique<TZstdCodec>());
+        return codecId;
+    }();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codecMap.GetOrThrow(customCodecId));
+    }
+}
+BENCHMARK(BM_CodecMapGetOrThrowCustom)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_GetCodecId(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GetCodecId(ECodec::ZSTD));
+    }
+}
+BENCHMARK(BM_GetCodecId)->ThreadRange(1, 64)->UseRealTime();
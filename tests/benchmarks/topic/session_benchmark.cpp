@@ -0,0 +1,126 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+using namespace NYdb;
+using namespace NYdb::NTopic;
+
+namespace {
+
+const std::string Topic = "bench-topic";
+
+TDriver MakeDriver(const NTests::TFakeServer& server) {
+    return TDriver(TDriverConfig()
+        .SetEndpoint(server.GetEndpoint())
+        .SetDatabase(server.GetDatabase()));
+}
+
+// Throughput of the write session pipeline: messages are written as fast as the
+// session accepts them, an iteration ends when all its messages are acknowledged
+void BM_TopicWriteSession(benchmark::State& state) {
+    const std::size_t messageSize = state.range(0);
+    const std::uint64_t messagesPerIteration = 1000;
+
+    NTests::TFakeServer server;
+    auto driver = MakeDriver(server);
+    TTopicClient client(driver);
+
+    auto session = client.CreateWriteSession(TWriteSessionSettings()
+        .Path(Topic)
+        .ProducerId("bench-producer")
+        .MessageGroupId("bench-producer")
+        .DirectWriteToPartition(false)
+        .Codec(ECodec::RAW));
+
+    const std::string payload(messageSize, 'x');
+    std::optional<TContinuationToken> token;
+    std::uint64_t written = 0;
+    std::uint64_t acked = 0;
+
+    for (auto _ : state) {
+        const auto target = written + messagesPerIteration;
+        while (acked < target) {
+            if (token && written < target) {
+                session->Write(std::move(*token), payload);
+                token.reset();
+                ++written;
+            }
+
+            for (auto& event : session->GetEvents(!token || written == target)) {
+                if (auto* ready = std::get_if<TWriteSessionEvent::TReadyToAcceptEvent>(&event)) {
+                    token = std::move(ready->ContinuationToken);
+                } else if (auto* acks = std::get_if<TWriteSessionEvent::TAcksEvent>(&event)) {
+                    acked += acks->Acks.size();
+                } else if (auto* closed = std::get_if<TSessionClosedEvent>(&event)) {
+                    state.SkipWithError(closed->DebugString().c_str());
+                    break;
+                }
+            }
+            if (state.error_occurred()) {
+                break;
+            }
+        }
+    }
+
+    session->Close(TDuration::Zero());
+    driver.Stop(true);
+
+    state.SetItemsProcessed(acked);
+    state.SetBytesProcessed(acked * messageSize);
+}
+
+// Throughput of the read session pipeline: the fake server sends data as soon as
+// the session has read budget, an iteration ends after a fixed number of messages
+void BM_TopicReadSession(benchmark::State& state) {
+    const std::size_t messageSize = state.range(0);
+    const std::uint64_t messagesPerIteration = 1000;
+
+    NTests::TFakeServer server(NTests::TFakeServerSettings()
+        .TopicMessageSize(messageSize));
+    auto driver = MakeDriver(server);
+    TTopicClient client(driver);
+
+    auto session = client.CreateReadSession(TReadSessionSettings()
+        .ConsumerName("bench-consumer")
+        .AppendTopics(TTopicReadSettings(Topic))
+        .Decompress(false));
+
+    std::uint64_t received = 0;
+
+    for (auto _ : state) {
+        const auto target = received + messagesPerIteration;
+        while (received < target) {
+            for (auto& event : session->GetEvents(true)) {
+                if (auto* data = std::get_if<TReadSessionEvent::TDataReceivedEvent>(&event)) {
+                    received += data->GetMessagesCount();
+                } else if (auto* start = std::get_if<TReadSessionEvent::TStartPartitionSessionEvent>(&event)) {
+                    start->Confirm();
+                } else if (auto* stop = std::get_if<TReadSessionEvent::TStopPartitionSessionEvent>(&event)) {
+                    stop->Confirm();
+                } else if (auto* closed = std::get_if<TSessionClosedEvent>(&event)) {
+                    state.SkipWithError(closed->DebugString().c_str());
+                    break;
+                }
+            }
+            if (state.error_occurred()) {
+                break;
+            }
+        }
+    }
+
+    session->Close(TDuration::Zero());
+    driver.Stop(true);
+
+    state.SetItemsProcessed(received);
+    state.SetBytesProcessed(received * messageSize);
+}
+
+} // namespace
+
+BENCHMARK(BM_TopicWriteSession)->Arg(100)->Arg(4_KB)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TopicReadSession)->Arg(100)->Arg(4_KB)->Unit(benchmark::kMillisecond);
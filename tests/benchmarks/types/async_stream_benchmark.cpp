@@ -0,0 +1,166 @@
+#include <ydb-cpp-sdk/client/topic/async_event_stream.h>
+#include <ydb-cpp-sdk/client/types/async_stream.h>
+#include <ydb-cpp-sdk/client/types/status/status.h>
+
+#include <tests/benchmarks/common/allocations.h>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+using namespace NYdb;
+using NYdb::NBenchmarks::TAllocationCounter;
+
+namespace {
+
+struct TFakePart : public TStreamPartStatus {
+    explicit TFakePart(EStatus status)
+        : TStreamPartStatus(TStatus(status, {}))
+    {}
+};
+
+// Iterator that returns parts pushed by the benchmark loop.
+class TFakePartIterator {
+    struct TState {
+        NThreading::TPromise<TFakePart> NextPart = NThreading::NewPromise<TFakePart>();
+    };
+
+public:
+    NThreading::TFuture<TFakePart> ReadNext() {
+        return State_->NextPart.GetFuture();
+    }
+
+    void Push(EStatus status = EStatus::SUCCESS) {
+        auto promise = std::exchange(State_->NextPart, NThreading::NewPromise<TFakePart>());
+        promise.SetValue(TFakePart(status));
+    }
+
+private:
+    std::shared_ptr<TState> State_ = std::make_shared<TState>();
+};
+
+NThreading::TFuture<void> ConsumeWithCoroutine(TFakePartIterator iterator, size_t& count) {
+    auto stream = MakeAsyncStream(std::move(iterator));
+    while (auto part = co_await stream.Next()) {
+        benchmark::DoNotOptimize(++count);
+    }
+}
+
+// Session with events pushed by the benchmark loop, see TAsyncEventStream
+class TFakeSession {
+public:
+    using TEvent = std::variant<size_t, NTopic::TSessionClosedEvent>;
+
+    std::optional<TEvent> GetEvent(bool) {
+        if (Events_.empty()) {
+            return std::nullopt;
+        }
+        auto event = std::move(Events_.front());
+        Events_.pop_front();
+        return event;
+    }
+
+    NThreading::TFuture<void> WaitEvent() {
+        return Events_.empty() ? Waiter_.GetFuture() : NThreading::MakeFuture();
+    }
+
+    void Push(TEvent event) {
+        Events_.push_back(std::move(event));
+        std::exchange(Waiter_, NThreading::NewPromise<void>()).SetValue();
+    }
+
+private:
+    std::deque<TEvent> Events_;
+    NThreading::TPromise<void> Waiter_ = NThreading::NewPromise<void>();
+};
+
+NThreading::TFuture<void> ConsumeEventsWithCoroutine(std::shared_ptr<TFakeSession> session, size_t& count) {
+    auto events = NTopic::MakeAsyncEventStream(std::move(session));
+    while (auto event = co_await events.Next()) {
+        benchmark::DoNotOptimize(++count);
+    }
+}
+
+} // namespace
+
+static void BM_ReadPartsSubscribe(benchmark::State& state) {
+    TFakePartIterator iterator;
+    size_t count = 0;
+    std::function<void(const NThreading::TFuture<TFakePart>&)> onPart = [&](const NThreading::TFuture<TFakePart>& part) {
+        if (!part.GetValue().EOS()) {
+            benchmark::DoNotOptimize(++count);
+            iterator.ReadNext().Subscribe(onPart);
+        }
+    };
+
+    iterator.ReadNext().Subscribe(onPart);
+    {
+        TAllocationCounter counter(state);
+        for (auto _ : state) {
+            iterator.Push();
+        }
+    }
+    iterator.Push(EStatus::CLIENT_OUT_OF_RANGE);
+}
+
+static void BM_ReadPartsCoroutine(benchmark::State& state) {
+    TFakePartIterator iterator;
+    size_t count = 0;
+
+    auto done = ConsumeWithCoroutine(iterator, count);
+    {
+        TAllocationCounter counter(state);
+        for (auto _ : state) {
+            iterator.Push();
+        }
+    }
+    iterator.Push(EStatus::CLIENT_OUT_OF_RANGE);
+    done.GetValueSync();
+}
+
+static void BM_ReadEventsWaitEvent(benchmark::State& state) {
+    auto session = std::make_shared<TFakeSession>();
+    size_t count = 0;
+    std::function<void(const NThreading::TFuture<void>&)> onEvent = [&](const NThreading::TFuture<void>&) {
+        while (auto event = session->GetEvent(false)) {
+            if (std::holds_alternative<NTopic::TSessionClosedEvent>(*event)) {
+                return;
+            }
+            benchmark::DoNotOptimize(++count);
+        }
+        session->WaitEvent().Subscribe(onEvent);
+    };
+
+    session->WaitEvent().Subscribe(onEvent);
+    {
+        TAllocationCounter counter(state);
+        size_t i = 0;
+        for (auto _ : state) {
+            session->Push(i++);
+        }
+    }
+    session->Push(NTopic::TSessionClosedEvent(EStatus::SUCCESS, {}));
+}
+
+static void BM_ReadEventsCoroutine(benchmark::State& state) {
+    auto session = std::make_shared<TFakeSession>();
+    size_t count = 0;
+
+    auto done = ConsumeEventsWithCoroutine(session, count);
+    {
+        TAllocationCounter counter(state);
+        size_t i = 0;
+        for (auto _ : state) {
+            session->Push(i++);
+        }
+    }
+    session->Push(NTopic::TSessionClosedEvent(EStatus::SUCCESS, {}));
+    done.GetValueSync();
+}
+
+// allocs_per_iter of the coroutine benchmarks is compared with the Subscribe ones:
+// awaiting an item should allocate nothing besides the future of the item and its callback
+BENCHMARK(BM_ReadPartsSubscribe);
+BENCHMARK(BM_ReadPartsCoroutine);
+BENCHMARK(BM_ReadEventsWaitEvent);
+BENCHMARK(BM_ReadEventsCoroutine);
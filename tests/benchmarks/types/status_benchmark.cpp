@@ -0,0 +1,55 @@
+#include <ydb-cpp-sdk/client/types/status/status.h>
+
+#define INCLUDE_YDB_INTERNAL_H
+#include <src/client/impl/ydb_internal/plain_status/status.h>
+#undef INCLUDE_YDB_INTERNAL_H
+
+#include <tests/benchmarks/common/allocations.h>
+
+using namespace NYdb;
+using NYdb::NBenchmarks::TAllocationCounter;
+
+namespace {
+
+const std::string Endpoint = "ydb-node-01.example.net:2135";
+
+} // namespace
+
+static void BM_StatusSuccess(benchmark::State& state) {
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TStatus status(EStatus::SUCCESS, {});
+        benchmark::DoNotOptimize(status.IsSuccess());
+    }
+}
+BENCHMARK(BM_StatusSuccess);
+
+static void BM_StatusSuccessFromEndpoint(benchmark::State& state) {
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TPlainStatus plain;
+        plain.Endpoint = Endpoint;
+        TStatus status(std::move(plain));
+        benchmark::DoNotOptimize(status.GetEndpoint().data());
+    }
+}
+BENCHMARK(BM_StatusSuccessFromEndpoint);
+
+static void BM_StatusCopy(benchmark::State& state) {
+    TStatus source(EStatus::SUCCESS, {});
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TStatus status = source;
+        benchmark::DoNotOptimize(status.GetStatus());
+    }
+}
+BENCHMARK(BM_StatusCopy);
+
+static void BM_StatusError(benchmark::State& state) {
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TStatus status(EStatus::UNAVAILABLE, {});
+        benchmark::DoNotOptimize(status.IsSuccess());
+    }
+}
+BENCHMARK(BM_StatusError);
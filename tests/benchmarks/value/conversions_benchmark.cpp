@@ -0,0 +1,106 @@
+#include <ydb-cpp-sdk/client/value/value.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+#include <src/library/decimal/yql_decimal.h>
+#include <src/library/uuid/uuid.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <random>
+
+using namespace NYdb;
+
+namespace {
+
+std::vector<ui64> MakeHalfs(size_t count) {
+    std::mt19937_64 random(1);
+    std::vector<ui64> halfs(count * 2);
+    for (auto& half : halfs) {
+        half = random();
+    }
+    return halfs;
+}
+
+// Values of 1 to 35 digits
+std::vector<NDecimal::TInt128> MakeDecimals(size_t count) {
+    std::mt19937_64 random(2);
+    std::vector<NDecimal::TInt128> values(count);
+    for (auto& value : values) {
+        value = NDecimal::FromHalfs(random(), random() >> 1) % NDecimal::Inf();
+        for (size_t i = random() % 3; i; --i) {
+            value /= NDecimal::TInt128(random() >> (random() % 64)) + NDecimal::TInt128(1);
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+static void BM_UuidValueToString(benchmark::State& state) {
+    const auto halfs = MakeHalfs(1000);
+    for (auto _ : state) {
+        for (size_t i = 0; i < halfs.size(); i += 2) {
+            benchmark::DoNotOptimize(TUuidValue(halfs[i], halfs[i + 1]).ToString());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * halfs.size() / 2);
+}
+BENCHMARK(BM_UuidValueToString);
+
+static void BM_UuidsBytesToChars(benchmark::State& state) {
+    const auto halfs = MakeHalfs(state.range(0));
+    std::string text(state.range(0) * NUuid::UUID_TEXT_LEN, '\0');
+    for (auto _ : state) {
+        NUuid::UuidsBytesToChars(reinterpret_cast<const char*>(halfs.data()), state.range(0), text.data());
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UuidsBytesToChars)->Arg(1)->Arg(1000);
+
+static void BM_UuidValueParse(benchmark::State& state) {
+    const auto halfs = MakeHalfs(1000);
+    std::vector<std::string> texts;
+    for (size_t i = 0; i < halfs.size(); i += 2) {
+        texts.push_back(TUuidValue(halfs[i], halfs[i + 1]).ToString());
+    }
+    for (auto _ : state) {
+        for (const auto& text : texts) {
+            benchmark::DoNotOptimize(TUuidValue(text));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * texts.size());
+}
+BENCHMARK(BM_UuidValueParse);
+
+static void BM_DecimalToString(benchmark::State& state) {
+    const auto values = MakeDecimals(1000);
+    const ui8 scale = state.range(0);
+    for (auto _ : state) {
+        for (const auto& value : values) {
+            benchmark::DoNotOptimize(NDecimal::ToString(value, NDecimal::MaxPrecision, scale));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_DecimalToString)->Arg(0)->Arg(9);
+
+static void BM_DecimalValueToString(benchmark::State& state) {
+    std::vector<TDecimalValue> values;
+    for (const auto& value : MakeDecimals(1000)) {
+        ui64 halfs[2];
+        std::memcpy(halfs, &value, sizeof(halfs));
+        Ydb::Value proto;
+        proto.set_low_128(halfs[0]);
+        proto.set_high_128(halfs[1]);
+        values.emplace_back(proto, TDecimalType(NDecimal::MaxPrecision, 9));
+    }
+    for (auto _ : state) {
+        for (const auto& value : values) {
+            benchmark::DoNotOptimize(value.ToString());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_DecimalValueToString);
@@ -0,0 +1,247 @@
+#include <ydb-cpp-sdk/client/params/params.h>
+#include <ydb-cpp-sdk/client/proto/accessor.h>
+#include <ydb-cpp-sdk/client/result/result.h>
+#include <ydb-cpp-sdk/client/value/value.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+
+#include <tests/benchmarks/common/allocations.h>
+
+using namespace NYdb;
+using NYdb::NBenchmarks::TAllocationCounter;
+
+namespace {
+
+const std::string RowName = "name of the row";
+
+// List<Struct<id: Uint64, name: Utf8, score: Double?>>
+TValue MakeRows(size_t rowsCount) {
+    TValueBuilder builder;
+    builder.BeginList();
+    for (size_t i = 0; i < rowsCount; ++i) {
+        builder.AddListItem()
+            .BeginStruct()
+                .AddMember("id").Uint64(i)
+                .AddMember("name").Utf8(RowName)
+                .AddMember("score").OptionalDouble(i % 2 ? std::optional<double>(i * 0.5) : std::nullopt)
+            .EndStruct();
+    }
+    builder.EndList();
+    return builder.Build();
+}
+
+TResultSet MakeResultSet(size_t rowsCount) {
+    Ydb::ResultSet proto;
+
+    auto& idColumn = *proto.add_columns();
+    idColumn.set_name("id");
+    idColumn.mutable_type()->set_type_id(Ydb::Type::UINT64);
+
+    auto& nameColumn = *proto.add_columns();
+    nameColumn.set_name("name");
+    nameColumn.mutable_type()->set_type_id(Ydb::Type::UTF8);
+
+    auto& scoreColumn = *proto.add_columns();
+    scoreColumn.set_name("score");
+    scoreColumn.mutable_type()->mutable_optional_type()->mutable_item()->set_type_id(Ydb::Type::DOUBLE);
+
+    for (size_t i = 0; i < rowsCount; ++i) {
+        auto& row = *proto.add_rows();
+        row.add_items()->set_uint64_value(i);
+        row.add_items()->set_text_value(RowName);
+        if (i % 2) {
+            row.add_items()->set_double_value(i * 0.5);
+        } else {
+            row.add_items()->set_null_flag_value(google::protobuf::NULL_VALUE);
+        }
+    }
+
+    return TResultSet(std::move(proto));
+}
+
+} // namespace
+
+static void BM_ValueBuilderStructList(benchmark::State& state) {
+    const size_t rowsCount = state.range(0);
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        auto value = MakeRows(rowsCount);
+        benchmark::DoNotOptimize(TProtoAccessor::GetProto(value).ByteSizeLong());
+    }
+    state.SetItemsProcessed(state.iterations() * rowsCount);
+}
+BENCHMARK(BM_ValueBuilderStructList)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_ValueParserStructList(benchmark::State& state) {
+    const size_t rowsCount = state.range(0);
+    const auto value = MakeRows(rowsCount);
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TValueParser parser(value);
+        uint64_t sum = 0;
+        parser.OpenList();
+        while (parser.TryNextListItem()) {
+            parser.OpenStruct();
+            while (parser.TryNextMember()) {
+                const auto& name = parser.GetMemberName();
+                if (name == "id") {
+                    sum += parser.GetUint64();
+                } else if (name == "name") {
+                    sum += parser.GetUtf8().size();
+                } else {
+                    sum += parser.GetOptionalDouble().value_or(0);
+                }
+            }
+            parser.CloseStruct();
+        }
+        parser.CloseList();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * rowsCount);
+}
+BENCHMARK(BM_ValueParserStructList)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_ResultSetParser(benchmark::State& state) {
+    const size_t rowsCount = state.range(0);
+    const auto resultSet = MakeResultSet(rowsCount);
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TResultSetParser parser(resultSet);
+        const auto idIndex = parser.ColumnIndex("id");
+        const auto nameIndex = parser.ColumnIndex("name");
+        const auto scoreIndex = parser.ColumnIndex("score");
+        uint64_t sum = 0;
+        while (parser.TryNextRow()) {
+            sum += parser.ColumnParser(idIndex).GetUint64();
+            sum += parser.ColumnParser(nameIndex).GetUtf8().size();
+            sum += parser.ColumnParser(scoreIndex).GetOptionalDouble().value_or(0);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * rowsCount);
+}
+BENCHMARK(BM_ResultSetParser)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_ParamsBuilder(benchmark::State& state) {
+    const size_t paramsCount = state.range(0);
+    std::vector<std::string> names;
+    for (size_t i = 0; i < paramsCount; ++i) {
+        names.push_back("$param" + std::to_string(i));
+    }
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TParamsBuilder builder;
+        for (size_t i = 0; i < paramsCount; ++i) {
+            if (i % 2) {
+                builder.AddParam(names[i]).Uint64(i).Build();
+            } else {
+                builder.AddParam(names[i]).Utf8(RowName).Build();
+            }
+        }
+        auto params = builder.Build();
+        benchmark::DoNotOptimize(params.Empty());
+    }
+    state.SetItemsProcessed(state.iterations() * paramsCount);
+}
+BENCHMARK(BM_ParamsBuilder)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_ParamsBuilderListParam(benchmark::State& state) {
+    const size_t rowsCount = state.range(0);
+    TAllocationCounter counter(state);
+    for (auto _ : state) {
+        TParamsBuilder builder;
+        auto& param = builder.AddParam("$rows").BeginList();
+        for (size_t i = 0; i < rowsCount; ++i) {
+            param.AddListItem()
+                .BeginStruct()
+                    .AddMember("id").Uint64(i)
+                    .AddMember("name").Utf8(RowName)
+                .EndStruct();
+        }
+        param.EndList().Build();
+        auto params = builder.Build();
+        benchmark::DoNotOptimize(params.Empty());
+    }
+    state.SetItemsProcessed(state.iterations() * rowsCount);
+}
+BENCHMARK(BM_ParamsBuilderListParam)->Arg(100)->Arg(10000);
+
+namespace {
+
+// Parameters of a small point query: $id Uint64, $name Utf8?, $ts Timestamp
+std::map<std::string, TType> MakeSmallQueryTypes() {
+    std::map<std::string, TType> types;
+    types.emplace("$id", TTypeBuilder().Primitive(EPrimitiveType::Uint64).Build());
+    types.emplace("$name", TTypeBuilder().BeginOptional().Primitive(EPrimitiveType::Utf8).EndOptional().Build());
+    types.emplace("$ts", TTypeBuilder().Primitive(EPrimitiveType::Timestamp).Build());
+    return types;
+}
+
+} // namespace
+
+// Every iteration builds the parameters of one query execution and moves them into the request map,
+// as TSession::ExecuteDataQuery(TParams&&) does
+static void BM_ParamsBuilderSmallQuery(benchmark::State& state) {
+    const auto types = MakeSmallQueryTypes();
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> request;
+    TAllocationCounter counter(state);
+    uint64_t i = 0;
+    for (auto _ : state) {
+        auto params = TParamsBuilder(types)
+            .AddParam("$id").Uint64(i).Build()
+            .AddParam("$name").OptionalUtf8(i % 2 ? std::optional<std::string>(RowName) : std::nullopt).Build()
+            .AddParam("$ts").Timestamp(TInstant::MicroSeconds(i)).Build()
+            .Build();
+        request.swap(*TProtoAccessor::GetProtoMapPtr(params));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParamsBuilderSmallQuery)->Iterations(1000000);
+
+static void BM_ParamsTemplateSmallQuery(benchmark::State& state) {
+    const TParamsTemplate paramsTemplate(MakeSmallQueryTypes());
+    const size_t idSlot = paramsTemplate.GetSlot("$id");
+    const size_t nameSlot = paramsTemplate.GetSlot("$name");
+    const size_t tsSlot = paramsTemplate.GetSlot("$ts");
+    auto builder = paramsTemplate.CreateBuilder();
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> request;
+    TAllocationCounter counter(state);
+    uint64_t i = 0;
+    for (auto _ : state) {
+        builder.Uint64(idSlot, i).Timestamp(tsSlot, TInstant::MicroSeconds(i));
+        if (i % 2) {
+            builder.Utf8(nameSlot, RowName);
+        }
+        auto params = builder.Build();
+        request.swap(*TProtoAccessor::GetProtoMapPtr(params));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParamsTemplateSmallQuery)->Iterations(1000000);
+
+// The request map swapped out by the previous iteration is given back to the builder,
+// as if the params were executed by const reference
+static void BM_ParamsTemplateSmallQueryRecycled(benchmark::State& state) {
+    const TParamsTemplate paramsTemplate(MakeSmallQueryTypes());
+    const size_t idSlot = paramsTemplate.GetSlot("$id");
+    const size_t nameSlot = paramsTemplate.GetSlot("$name");
+    const size_t tsSlot = paramsTemplate.GetSlot("$ts");
+    auto builder = paramsTemplate.CreateBuilder();
+    ::google::protobuf::Map<TStringType, Ydb::TypedValue> request;
+    TAllocationCounter counter(state);
+    uint64_t i = 0;
+    for (auto _ : state) {
+        builder.Uint64(idSlot, i).Timestamp(tsSlot, TInstant::MicroSeconds(i));
+        if (i % 2) {
+            builder.Utf8(nameSlot, RowName);
+        }
+        auto params = builder.Build();
+        request.swap(*TProtoAccessor::GetProtoMapPtr(params));
+        builder.Recycle(std::move(params));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParamsTemplateSmallQueryRecycled)->Iterations(1000000);
@@ -0,0 +1,830 @@
+#include "fake_server.h"
+
+#include <src/api/grpc/ydb_discovery_v1.grpc.pb.h>
+#include <src/api/grpc/ydb_query_v1.grpc.pb.h>
+#include <src/api/grpc/ydb_table_v1.grpc.pb.h>
+#include <src/api/grpc/ydb_topic_v1.grpc.pb.h>
+
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace NYdb::inline V3::NTests {
+
+namespace {
+
+constexpr std::uint64_t FAKE_NODE_ID = 1;
+// Partition session ids are FAKE_PARTITION_SESSION_ID + partition id
+constexpr std::int64_t FAKE_PARTITION_SESSION_ID = 1;
+constexpr std::int32_t CODEC_RAW = 1;
+
+// State shared by all services: settings, pregenerated payloads and counters
+struct TServerState {
+    explicit TServerState(const TFakeServerSettings& settings)
+        : Settings(settings)
+        , TopicMessageData(settings.TopicMessageSize_, 'm')
+        , Payload(settings.ResultPayloadSize_, 'p')
+    {
+        auto* idColumn = ResultSet.add_columns();
+        idColumn->set_name("id");
+        idColumn->mutable_type()->set_type_id(Ydb::Type::UINT64);
+
+        auto* payloadColumn = ResultSet.add_columns();
+        payloadColumn->set_name("payload");
+        payloadColumn->mutable_type()->set_type_id(Ydb::Type::UTF8);
+
+        for (std::uint64_t i = 0; i < settings.ResultRows_; ++i) {
+            AddRow(ResultSet, i);
+        }
+    }
+
+    void AddRow(Ydb::ResultSet& resultSet, std::uint64_t id) const {
+        auto* row = resultSet.add_rows();
+        row->add_items()->set_uint64_value(id);
+        row->add_items()->set_text_value(Payload);
+    }
+
+    // Accounts a call, sleeps the configured latency and decides whether the call fails
+    Ydb::StatusIds::StatusCode BeginCall() {
+        ++Calls;
+        return NextResponse();
+    }
+
+    // Sleeps the configured latency and decides whether the next response of a call fails
+    Ydb::StatusIds::StatusCode NextResponse() {
+        Delay();
+
+        if (Settings.ErrorRate_ > 0.0 && Random() < Settings.ErrorRate_) {
+            ++InjectedErrors;
+            return static_cast<Ydb::StatusIds::StatusCode>(Settings.ErrorStatus_);
+        }
+        return Ydb::StatusIds::SUCCESS;
+    }
+
+    void Delay() {
+        auto delay = Settings.Latency_;
+        if (Settings.LatencyJitter_) {
+            delay += TDuration::MicroSeconds(Random() * Settings.LatencyJitter_.MicroSeconds());
+        }
+        if (delay) {
+            std::this_thread::sleep_for(std::chrono::microseconds(delay.MicroSeconds()));
+        }
+    }
+
+    // Blocks while writes are held, returns at once when the server stops
+    void WaitWritesReleased() {
+        std::unique_lock lock(WritesLock);
+        WritesReleased.wait(lock, [this] { return !WritesHeld || Stopping; });
+    }
+
+    void HoldWrites(bool hold) {
+        {
+            std::lock_guard lock(WritesLock);
+            WritesHeld = hold;
+        }
+        WritesReleased.notify_all();
+    }
+
+    double Random() {
+        thread_local std::mt19937_64 generator{std::random_device{}()};
+        return std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+    }
+
+    std::string NewSessionId() {
+        return "ydb://session/3?node_id=" + std::to_string(FAKE_NODE_ID) + "&id=fake-" + std::to_string(++SessionsCreated);
+    }
+
+    std::string NewTxId() {
+        return "fake-tx-" + std::to_string(++TxCount);
+    }
+
+    const TFakeServerSettings Settings;
+    const std::string TopicMessageData;
+    const std::string Payload;
+    Ydb::ResultSet ResultSet;
+
+    std::string Address;
+    int Port = 0;
+    std::atomic_bool Stopping = false;
+
+    std::mutex WritesLock;
+    std::condition_variable WritesReleased;
+    bool WritesHeld = false;
+
+    std::atomic<std::uint64_t> Calls = 0;
+    std::atomic<std::uint64_t> InjectedErrors = 0;
+    std::atomic<std::uint64_t> SessionsCreated = 0;
+    std::atomic<std::uint64_t> TxCount = 0;
+    std::atomic<std::uint64_t> UpsertedRows = 0;
+    std::atomic<std::uint64_t> WrittenMessages = 0;
+    std::atomic<std::uint64_t> ReadMessages = 0;
+};
+
+// Fills Ydb.Operations.Operation of a unary response, the result is packed only on success
+template <class TResponse>
+grpc::Status FinishOperation(TResponse* response, Ydb::StatusIds::StatusCode status,
+    const google::protobuf::Message* result = nullptr)
+{
+    auto* op = response->mutable_operation();
+    op->set_ready(true);
+    op->set_status(status);
+    if (status == Ydb::StatusIds::SUCCESS && result) {
+        op->mutable_result()->PackFrom(*result);
+    }
+    return grpc::Status::OK;
+}
+
+class TDiscoveryService : public Ydb::Discovery::V1::DiscoveryService::Service {
+public:
+    explicit TDiscoveryService(TServerState& state)
+        : State_(state)
+    {}
+
+    grpc::Status ListEndpoints(
+            grpc::ServerContext*,
+            const Ydb::Discovery::ListEndpointsRequest*,
+            Ydb::Discovery::ListEndpointsResponse* response) override
+    {
+        // Discovery is never delayed or failed, otherwise the driver could not start at all
+        ++State_.Calls;
+
+        Ydb::Discovery::ListEndpointsResult result;
+        auto* endpoint = result.add_endpoints();
+        endpoint->set_address(State_.Address);
+        endpoint->set_port(State_.Port);
+        endpoint->set_node_id(FAKE_NODE_ID);
+        endpoint->set_load_factor(0);
+        result.set_self_location("local");
+
+        return FinishOperation(response, Ydb::StatusIds::SUCCESS, &result);
+    }
+
+private:
+    TServerState& State_;
+};
+
+class TTableService : public Ydb::Table::V1::TableService::Service {
+public:
+    explicit TTableService(TServerState& state)
+        : State_(state)
+    {}
+
+    grpc::Status CreateSession(
+            grpc::ServerContext*,
+            const Ydb::Table::CreateSessionRequest*,
+            Ydb::Table::CreateSessionResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+
+        Ydb::Table::CreateSessionResult result;
+        if (status == Ydb::StatusIds::SUCCESS) {
+            result.set_session_id(State_.NewSessionId());
+        }
+        return FinishOperation(response, status, &result);
+    }
+
+    grpc::Status DeleteSession(
+            grpc::ServerContext*,
+            const Ydb::Table::DeleteSessionRequest*,
+            Ydb::Table::DeleteSessionResponse* response) override
+    {
+        ++State_.Calls;
+        return FinishOperation(response, Ydb::StatusIds::SUCCESS);
+    }
+
+    grpc::Status KeepAlive(
+            grpc::ServerContext*,
+            const Ydb::Table::KeepAliveRequest*,
+            Ydb::Table::KeepAliveResponse* response) override
+    {
+        ++State_.Calls;
+
+        Ydb::Table::KeepAliveResult result;
+        result.set_session_status(Ydb::Table::KeepAliveResult::SESSION_STATUS_READY);
+        return FinishOperation(response, Ydb::StatusIds::SUCCESS, &result);
+    }
+
+    grpc::Status ExecuteDataQuery(
+            grpc::ServerContext*,
+            const Ydb::Table::ExecuteDataQueryRequest* request,
+            Ydb::Table::ExecuteDataQueryResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+        if (status != Ydb::StatusIds::SUCCESS) {
+            return FinishOperation(response, status);
+        }
+
+        Ydb::Table::ExecuteQueryResult result;
+        *result.add_result_sets() = State_.ResultSet;
+
+        const auto& txControl = request->tx_control();
+        if (!txControl.commit_tx()) {
+            result.mutable_tx_meta()->set_id(txControl.has_begin_tx() ? State_.NewTxId() : txControl.tx_id());
+        }
+        return FinishOperation(response, status, &result);
+    }
+
+    grpc::Status BeginTransaction(
+            grpc::ServerContext*,
+            const Ydb::Table::BeginTransactionRequest*,
+            Ydb::Table::BeginTransactionResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+
+        Ydb::Table::BeginTransactionResult result;
+        result.mutable_tx_meta()->set_id(State_.NewTxId());
+        return FinishOperation(response, status, &result);
+    }
+
+    grpc::Status CommitTransaction(
+            grpc::ServerContext*,
+            const Ydb::Table::CommitTransactionRequest*,
+            Ydb::Table::CommitTransactionResponse* response) override
+    {
+        return FinishOperation(response, State_.BeginCall());
+    }
+
+    grpc::Status RollbackTransaction(
+            grpc::ServerContext*,
+            const Ydb::Table::RollbackTransactionRequest*,
+            Ydb::Table::RollbackTransactionResponse* response) override
+    {
+        ++State_.Calls;
+        return FinishOperation(response, Ydb::StatusIds::SUCCESS);
+    }
+
+    grpc::Status BulkUpsert(
+            grpc::ServerContext*,
+            const Ydb::Table::BulkUpsertRequest* request,
+            Ydb::Table::BulkUpsertResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+        if (status == Ydb::StatusIds::SUCCESS && request->has_csv_settings()) {
+            // Every CSV row is expected to end with a line break
+            const auto& data = request->data();
+            const auto lines = std::count(data.begin(), data.end(), '\n');
+            State_.UpsertedRows += lines - (request->csv_settings().header() && lines ? 1 : 0);
+        } else if (status == Ydb::StatusIds::SUCCESS) {
+            State_.UpsertedRows += request->rows().value().items_size();
+        }
+
+        Ydb::Table::BulkUpsertResult result;
+        return FinishOperation(response, status, &result);
+    }
+
+    grpc::Status DescribeTable(
+            grpc::ServerContext*,
+            const Ydb::Table::DescribeTableRequest* request,
+            Ydb::Table::DescribeTableResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+
+        Ydb::Table::DescribeTableResult result;
+        result.mutable_self()->set_name(request->path().substr(request->path().rfind('/') + 1));
+        result.mutable_self()->set_type(Ydb::Scheme::Entry::TABLE);
+        for (const auto& column : State_.ResultSet.columns()) {
+            auto* meta = result.add_columns();
+            meta->set_name(column.name());
+            *meta->mutable_type()->mutable_optional_type()->mutable_item() = column.type();
+        }
+        result.add_primary_key("id");
+
+        if (request->include_shard_key_bounds()) {
+            const auto shards = std::max<std::uint64_t>(State_.Settings.TableShards_, 1);
+            const auto step = std::numeric_limits<std::uint64_t>::max() / shards;
+            for (std::uint64_t i = 1; i < shards; ++i) {
+                auto* bound = result.add_shard_key_bounds();
+                bound->mutable_type()->mutable_tuple_type()->add_elements()
+                    ->mutable_optional_type()->mutable_item()->set_type_id(Ydb::Type::UINT64);
+                bound->mutable_value()->add_items()->set_uint64_value(step * i);
+            }
+        }
+        return FinishOperation(response, status, &result);
+    }
+
+    grpc::Status StreamReadTable(
+            grpc::ServerContext*,
+            const Ydb::Table::ReadTableRequest* request,
+            grpc::ServerWriter<Ydb::Table::ReadTableResponse>* writer) override
+    {
+        const auto status = State_.BeginCall();
+
+        Ydb::Table::ReadTableResponse part;
+        part.set_status(status);
+        if (status != Ydb::StatusIds::SUCCESS) {
+            writer->Write(part);
+            return grpc::Status::OK;
+        }
+
+        // Inclusive bounds of the requested ids
+        std::uint64_t from = 0;
+        std::uint64_t to = std::numeric_limits<std::uint64_t>::max();
+        const auto& range = request->key_range();
+        auto key = [](const Ydb::TypedValue& bound) {
+            return bound.value().items_size() ? bound.value().items(0).uint64_value() : 0;
+        };
+        if (range.has_greater()) {
+            if (key(range.greater()) == to) {
+                return grpc::Status::OK;
+            }
+            from = key(range.greater()) + 1;
+        } else if (range.has_greater_or_equal()) {
+            from = key(range.greater_or_equal());
+        }
+        if (range.has_less()) {
+            if (key(range.less()) == 0) {
+                return grpc::Status::OK;
+            }
+            to = key(range.less()) - 1;
+        } else if (range.has_less_or_equal()) {
+            to = key(range.less_or_equal());
+        }
+
+        const auto shards = std::max<std::uint64_t>(State_.Settings.TableShards_, 1);
+        const auto step = std::numeric_limits<std::uint64_t>::max() / shards;
+        const auto partRows = std::max<std::uint64_t>(State_.Settings.ResultRows_, 1);
+        const auto shardRows = partRows * State_.Settings.ResultParts_;
+
+        bool first = true;
+        auto* resultSet = part.mutable_result()->mutable_result_set();
+        auto flush = [&]() {
+            if (!first) {
+                const auto status = State_.NextResponse();
+                if (status != Ydb::StatusIds::SUCCESS) {
+                    Ydb::Table::ReadTableResponse error;
+                    error.set_status(status);
+                    writer->Write(error);
+                    return false;
+                }
+            }
+            first = false;
+            const bool written = writer->Write(part);
+            resultSet->clear_rows();
+            return written;
+        };
+
+        *resultSet->mutable_columns() = State_.ResultSet.columns();
+        for (std::uint64_t shard = 0; shard < shards; ++shard) {
+            const auto begin = std::max(from, shard * step);
+            const auto end = std::min(to, shard * step + shardRows - 1);
+            for (auto id = begin; id <= end && shardRows; ++id) {
+                State_.AddRow(*resultSet, id);
+                if (static_cast<std::uint64_t>(resultSet->rows_size()) == partRows && !flush()) {
+                    return grpc::Status::OK;
+                }
+            }
+        }
+        if (resultSet->rows_size()) {
+            flush();
+        }
+        return grpc::Status::OK;
+    }
+
+private:
+    TServerState& State_;
+};
+
+class TQueryService : public Ydb::Query::V1::QueryService::Service {
+public:
+    explicit TQueryService(TServerState& state)
+        : State_(state)
+    {}
+
+    grpc::Status CreateSession(
+            grpc::ServerContext*,
+            const Ydb::Query::CreateSessionRequest*,
+            Ydb::Query::CreateSessionResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+        response->set_status(status);
+        if (status == Ydb::StatusIds::SUCCESS) {
+            response->set_session_id(State_.NewSessionId());
+            response->set_node_id(FAKE_NODE_ID);
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status DeleteSession(
+            grpc::ServerContext*,
+            const Ydb::Query::DeleteSessionRequest*,
+            Ydb::Query::DeleteSessionResponse* response) override
+    {
+        ++State_.Calls;
+        response->set_status(Ydb::StatusIds::SUCCESS);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status AttachSession(
+            grpc::ServerContext* context,
+            const Ydb::Query::AttachSessionRequest*,
+            grpc::ServerWriter<Ydb::Query::SessionState>* writer) override
+    {
+        ++State_.Calls;
+
+        Ydb::Query::SessionState state;
+        state.set_status(Ydb::StatusIds::SUCCESS);
+        if (!writer->Write(state)) {
+            return grpc::Status::OK;
+        }
+
+        // The session lives as long as its attach stream, keep it open until the client goes away
+        while (!context->IsCancelled() && !State_.Stopping) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status ExecuteQuery(
+            grpc::ServerContext*,
+            const Ydb::Query::ExecuteQueryRequest* request,
+            grpc::ServerWriter<Ydb::Query::ExecuteQueryResponsePart>* writer) override
+    {
+        const auto status = State_.BeginCall();
+
+        Ydb::Query::ExecuteQueryResponsePart part;
+        part.set_status(status);
+        if (status != Ydb::StatusIds::SUCCESS) {
+            writer->Write(part);
+            return grpc::Status::OK;
+        }
+
+        const auto& txControl = request->tx_control();
+        if (!txControl.commit_tx() && (txControl.has_begin_tx() || !txControl.tx_id().empty())) {
+            part.mutable_tx_meta()->set_id(txControl.has_begin_tx() ? State_.NewTxId() : txControl.tx_id());
+        }
+
+        for (std::uint64_t i = 0; i < State_.Settings.ResultParts_; ++i) {
+            if (i > 0) {
+                State_.Delay();
+            }
+            part.set_result_set_index(0);
+            *part.mutable_result_set() = State_.ResultSet;
+            if (!writer->Write(part)) {
+                break;
+            }
+            part.clear_tx_meta();
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status BeginTransaction(
+            grpc::ServerContext*,
+            const Ydb::Query::BeginTransactionRequest*,
+            Ydb::Query::BeginTransactionResponse* response) override
+    {
+        const auto status = State_.BeginCall();
+        response->set_status(status);
+        response->mutable_tx_meta()->set_id(State_.NewTxId());
+        return grpc::Status::OK;
+    }
+
+    grpc::Status CommitTransaction(
+            grpc::ServerContext*,
+            const Ydb::Query::CommitTransactionRequest*,
+            Ydb::Query::CommitTransactionResponse* response) override
+    {
+        response->set_status(State_.BeginCall());
+        return grpc::Status::OK;
+    }
+
+    grpc::Status RollbackTransaction(
+            grpc::ServerContext*,
+            const Ydb::Query::RollbackTransactionRequest*,
+            Ydb::Query::RollbackTransactionResponse* response) override
+    {
+        ++State_.Calls;
+        response->set_status(Ydb::StatusIds::SUCCESS);
+        return grpc::Status::OK;
+    }
+
+private:
+    TServerState& State_;
+};
+
+class TTopicService : public Ydb::Topic::V1::TopicService::Service {
+    using TWriteStream = grpc::ServerReaderWriter<Ydb::Topic::StreamWriteMessage::FromServer, Ydb::Topic::StreamWriteMessage::FromClient>;
+    using TReadStream = grpc::ServerReaderWriter<Ydb::Topic::StreamReadMessage::FromServer, Ydb::Topic::StreamReadMessage::FromClient>;
+
+public:
+    explicit TTopicService(TServerState& state)
+        : State_(state)
+    {}
+
+    // Acknowledges every message as written to partition 0, offsets grow per stream
+    grpc::Status StreamWrite(grpc::ServerContext*, TWriteStream* stream) override {
+        Ydb::Topic::StreamWriteMessage::FromClient request;
+        std::int64_t nextOffset = 0;
+
+        while (stream->Read(&request)) {
+            Ydb::Topic::StreamWriteMessage::FromServer response;
+
+            switch (request.client_message_case()) {
+            case Ydb::Topic::StreamWriteMessage::FromClient::kInitRequest: {
+                const auto status = State_.BeginCall();
+                response.set_status(status);
+                if (status != Ydb::StatusIds::SUCCESS) {
+                    stream->Write(response);
+                    return grpc::Status::OK;
+                }
+
+                auto* init = response.mutable_init_response();
+                init->set_session_id("fake-write-session-" + std::to_string(++State_.SessionsCreated));
+                init->set_partition_id(0);
+                init->set_last_seq_no(0);
+                init->mutable_supported_codecs()->add_codecs(CODEC_RAW);
+                break;
+            }
+            case Ydb::Topic::StreamWriteMessage::FromClient::kWriteRequest: {
+                State_.Delay();
+                State_.WaitWritesReleased();
+
+                response.set_status(Ydb::StatusIds::SUCCESS);
+                auto* write = response.mutable_write_response();
+                write->set_partition_id(0);
+                for (const auto& message : request.write_request().messages()) {
+                    auto* ack = write->add_acks();
+                    ack->set_seq_no(message.seq_no());
+                    ack->mutable_written()->set_offset(nextOffset++);
+                }
+                State_.WrittenMessages += request.write_request().messages_size();
+                break;
+            }
+            case Ydb::Topic::StreamWriteMessage::FromClient::kUpdateTokenRequest:
+                response.set_status(Ydb::StatusIds::SUCCESS);
+                response.mutable_update_token_response();
+                break;
+            default:
+                continue;
+            }
+
+            if (!stream->Write(response)) {
+                break;
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    // Serves endless partitions of the first requested topic, data of a partition is sent
+    // as soon as the client has started its partition session and has read budget
+    grpc::Status StreamRead(grpc::ServerContext*, TReadStream* stream) override {
+        Ydb::Topic::StreamReadMessage::FromClient request;
+        std::int64_t budget = 0;
+        const auto partitions = std::max<std::uint64_t>(State_.Settings.TopicPartitions_, 1);
+        std::vector<std::int64_t> nextOffsets(partitions, 0);
+        std::vector<bool> partitionStarted(partitions, false);
+        std::uint64_t startedCount = 0;
+        std::uint64_t nextPartition = 0;
+        auto partitionOf = [partitions](std::int64_t partitionSessionId) -> std::optional<std::uint64_t> {
+            const auto partition = static_cast<std::uint64_t>(partitionSessionId - FAKE_PARTITION_SESSION_ID);
+            if (partition >= partitions) {
+                return std::nullopt;
+            }
+            return partition;
+        };
+
+        while (stream->Read(&request)) {
+            Ydb::Topic::StreamReadMessage::FromServer response;
+            response.set_status(Ydb::StatusIds::SUCCESS);
+
+            switch (request.client_message_case()) {
+            case Ydb::Topic::StreamReadMessage::FromClient::kInitRequest: {
+                const auto status = State_.BeginCall();
+                response.set_status(status);
+                if (status != Ydb::StatusIds::SUCCESS) {
+                    stream->Write(response);
+                    return grpc::Status::OK;
+                }
+
+                response.mutable_init_response()->set_session_id("fake-read-session-" + std::to_string(++State_.SessionsCreated));
+                if (!stream->Write(response)) {
+                    return grpc::Status::OK;
+                }
+
+                const auto& topics = request.init_request().topics_read_settings();
+                for (std::uint64_t partition = 0; partition < partitions; ++partition) {
+                    Ydb::Topic::StreamReadMessage::FromServer start;
+                    start.set_status(Ydb::StatusIds::SUCCESS);
+                    auto* startRequest = start.mutable_start_partition_session_request();
+                    auto* partitionSession = startRequest->mutable_partition_session();
+                    partitionSession->set_partition_session_id(FAKE_PARTITION_SESSION_ID + partition);
+                    partitionSession->set_path(topics.empty() ? std::string() : topics.Get(0).path());
+                    partitionSession->set_partition_id(partition);
+                    startRequest->set_committed_offset(0);
+                    startRequest->mutable_partition_offsets()->set_start(0);
+                    startRequest->mutable_partition_offsets()->set_end(std::numeric_limits<std::int64_t>::max());
+                    if (!stream->Write(start)) {
+                        return grpc::Status::OK;
+                    }
+                }
+                continue;
+            }
+            case Ydb::Topic::StreamReadMessage::FromClient::kReadRequest:
+                budget += request.read_request().bytes_size();
+                break;
+            case Ydb::Topic::StreamReadMessage::FromClient::kStartPartitionSessionResponse: {
+                const auto& started = request.start_partition_session_response();
+                const auto partition = partitionOf(started.partition_session_id());
+                if (!partition) {
+                    break;
+                }
+                if (!partitionStarted[*partition]) {
+                    partitionStarted[*partition] = true;
+                    ++startedCount;
+                }
+                if (started.has_read_offset()) {
+                    nextOffsets[*partition] = started.read_offset();
+                }
+                break;
+            }
+            case Ydb::Topic::StreamReadMessage::FromClient::kCommitOffsetRequest: {
+                auto* commit = response.mutable_commit_offset_response();
+                for (const auto& partition : request.commit_offset_request().commit_offsets()) {
+                    std::int64_t committed = 0;
+                    for (const auto& range : partition.offsets()) {
+                        committed = std::max(committed, range.end());
+                    }
+                    auto* committedOffset = commit->add_partitions_committed_offsets();
+                    committedOffset->set_partition_session_id(partition.partition_session_id());
+                    committedOffset->set_committed_offset(committed);
+                }
+                if (!stream->Write(response)) {
+                    return grpc::Status::OK;
+                }
+                break;
+            }
+            case Ydb::Topic::StreamReadMessage::FromClient::kPartitionSessionStatusRequest: {
+                const auto partitionSessionId = request.partition_session_status_request().partition_session_id();
+                const auto partition = partitionOf(partitionSessionId);
+                auto* status = response.mutable_partition_session_status_response();
+                status->set_partition_session_id(partitionSessionId);
+                status->mutable_partition_offsets()->set_start(0);
+                status->mutable_partition_offsets()->set_end(partition ? nextOffsets[*partition] : 0);
+                if (!stream->Write(response)) {
+                    return grpc::Status::OK;
+                }
+                break;
+            }
+            case Ydb::Topic::StreamReadMessage::FromClient::kUpdateTokenRequest:
+                response.mutable_update_token_response();
+                if (!stream->Write(response)) {
+                    return grpc::Status::OK;
+                }
+                break;
+            default:
+                break;
+            }
+
+            while (startedCount && budget > 0) {
+                State_.Delay();
+
+                while (!partitionStarted[nextPartition]) {
+                    nextPartition = (nextPartition + 1) % partitions;
+                }
+                auto& nextOffset = nextOffsets[nextPartition];
+
+                Ydb::Topic::StreamReadMessage::FromServer data;
+                data.set_status(Ydb::StatusIds::SUCCESS);
+                const auto bytes = FillBatch(*data.mutable_read_response(), FAKE_PARTITION_SESSION_ID + nextPartition, nextOffset);
+                nextOffset += State_.Settings.TopicMessagesPerBatch_;
+                nextPartition = (nextPartition + 1) % partitions;
+                budget -= bytes;
+
+                if (!stream->Write(data)) {
+                    return grpc::Status::OK;
+                }
+                State_.ReadMessages += State_.Settings.TopicMessagesPerBatch_;
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+private:
+    std::int64_t FillBatch(Ydb::Topic::StreamReadMessage::ReadResponse& response,
+        std::int64_t partitionSessionId, std::int64_t firstOffset)
+    {
+        auto* partitionData = response.add_partition_data();
+        partitionData->set_partition_session_id(partitionSessionId);
+
+        auto* batch = partitionData->add_batches();
+        batch->set_producer_id("fake-producer");
+        batch->set_codec(CODEC_RAW);
+        batch->mutable_written_at()->set_seconds(TInstant::Now().Seconds());
+
+        std::int64_t bytes = 0;
+        for (std::uint64_t i = 0; i < State_.Settings.TopicMessagesPerBatch_; ++i) {
+            auto* message = batch->add_message_data();
+            message->set_offset(firstOffset + i);
+            message->set_seq_no(firstOffset + i + 1);
+            *message->mutable_created_at() = batch->written_at();
+            message->set_data(State_.TopicMessageData);
+            message->set_uncompressed_size(State_.TopicMessageData.size());
+            bytes += State_.TopicMessageData.size();
+        }
+        response.set_bytes_size(bytes);
+        return bytes;
+    }
+
+    TServerState& State_;
+};
+
+} // namespace
+
+class TFakeServer::TImpl {
+public:
+    explicit TImpl(const TFakeServerSettings& settings)
+        : State_(settings)
+        , DiscoveryService_(State_)
+        , TableService_(State_)
+        , QueryService_(State_)
+        , TopicService_(State_)
+    {
+        State_.Address = "127.0.0.1";
+
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(State_.Address + ":0", grpc::InsecureServerCredentials(), &State_.Port);
+        builder.RegisterService(&DiscoveryService_);
+        builder.RegisterService(&TableService_);
+        builder.RegisterService(&QueryService_);
+        builder.RegisterService(&TopicService_);
+        Server_ = builder.BuildAndStart();
+
+        if (!Server_ || State_.Port == 0) {
+            throw std::runtime_error("Failed to start fake YDB server");
+        }
+        Endpoint_ = State_.Address + ":" + std::to_string(State_.Port);
+    }
+
+    ~TImpl() {
+        Stop();
+    }
+
+    void Stop() {
+        if (State_.Stopping.exchange(true)) {
+            return;
+        }
+        State_.HoldWrites(false);
+        // Streams blocked in Read are cancelled once the deadline passes
+        Server_->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+        Server_->Wait();
+    }
+
+    TFakeServerStats GetStats() const {
+        TFakeServerStats stats;
+        stats.Calls = State_.Calls.load();
+        stats.InjectedErrors = State_.InjectedErrors.load();
+        stats.SessionsCreated = State_.SessionsCreated.load();
+        stats.UpsertedRows = State_.UpsertedRows.load();
+        stats.WrittenMessages = State_.WrittenMessages.load();
+        stats.ReadMessages = State_.ReadMessages.load();
+        return stats;
+    }
+
+    TServerState State_;
+    std::string Endpoint_;
+
+private:
+    TDiscoveryService DiscoveryService_;
+    TTableService TableService_;
+    TQueryService QueryService_;
+    TTopicService TopicService_;
+    std::unique_ptr<grpc::Server> Server_;
+};
+
+TFakeServer::TFakeServer(const TFakeServerSettings& settings)
+    : Impl_(std::make_unique<TImpl>(settings))
+{}
+
+TFakeServer::~TFakeServer() = default;
+
+const std::string& TFakeServer::GetEndpoint() const {
+    return Impl_->Endpoint_;
+}
+
+const std::string& TFakeServer::GetDatabase() const {
+    return Impl_->State_.Settings.Database_;
+}
+
+TFakeServerStats TFakeServer::GetStats() const {
+    return Impl_->GetStats();
+}
+
+void TFakeServer::HoldWrites(bool hold) {
+    Impl_->State_.HoldWrites(hold);
+}
+
+void TFakeServer::Stop() {
+    Impl_->Stop();
+}
+
+} // namespace NYdb::NTests
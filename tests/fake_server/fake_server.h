@@ -0,0 +1,102 @@
+#pragma once
+
+#include <ydb-cpp-sdk/client/types/fluent_settings_helpers.h>
+#include <ydb-cpp-sdk/client/types/status_codes.h>
+
+#include <util/datetime/base.h>
+#include <util/generic/size_literals.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NYdb::inline V3::NTests {
+
+//! Behaviour of the in-process fake server
+struct TFakeServerSettings {
+    using TSelf = TFakeServerSettings;
+
+    //! Database reported by discovery
+    FLUENT_SETTING_DEFAULT(std::string, Database, "/Root/Fake");
+
+    //! Delay added to every unary call and to every stream response
+    FLUENT_SETTING_DEFAULT(TDuration, Latency, TDuration::Zero());
+
+    //! Upper bound of uniformly distributed extra delay added to Latency
+    FLUENT_SETTING_DEFAULT(TDuration, LatencyJitter, TDuration::Zero());
+
+    //! Probability in [0, 1] of answering a call with ErrorStatus,
+    //! ReadTable streams also break off with it before every next part
+    FLUENT_SETTING_DEFAULT(double, ErrorRate, 0.0);
+
+    //! Status of injected errors
+    FLUENT_SETTING_DEFAULT(EStatus, ErrorStatus, EStatus::OVERLOADED);
+
+    //! Rows in every generated result set, columns are `id Uint64` and `payload Utf8`
+    FLUENT_SETTING_DEFAULT(std::uint64_t, ResultRows, 100);
+
+    //! Size of the payload column in generated rows
+    FLUENT_SETTING_DEFAULT(std::uint64_t, ResultPayloadSize, 32);
+
+    //! Number of result set parts streamed by the query service ExecuteQuery and by every ReadTable stream
+    FLUENT_SETTING_DEFAULT(std::uint64_t, ResultParts, 1);
+
+    //! Number of shards reported by DescribeTable, split evenly by the `id` key.
+    //! Every shard holds ResultRows * ResultParts rows with distinct ids from its start,
+    //! ReadTable streams the rows of the requested key range in key order by ResultRows.
+    FLUENT_SETTING_DEFAULT(std::uint64_t, TableShards, 1);
+
+    //! Size of every generated topic message
+    FLUENT_SETTING_DEFAULT(std::uint64_t, TopicMessageSize, 1_KB);
+
+    //! Number of messages in a generated topic batch
+    FLUENT_SETTING_DEFAULT(std::uint64_t, TopicMessagesPerBatch, 16);
+
+    //! Number of endless partitions served to every read session, batches of
+    //! started partitions are sent in turn
+    FLUENT_SETTING_DEFAULT(std::uint64_t, TopicPartitions, 1);
+};
+
+//! Counters of the work done by the fake server
+struct TFakeServerStats {
+    std::uint64_t Calls = 0;
+    std::uint64_t InjectedErrors = 0;
+    std::uint64_t SessionsCreated = 0;
+    std::uint64_t UpsertedRows = 0;
+    std::uint64_t WrittenMessages = 0;
+    std::uint64_t ReadMessages = 0;
+};
+
+//! In-process gRPC server that answers the discovery, table, query and topic
+//! calls of the SDK with generated data. It does not store anything and is meant
+//! for benchmarks, load tests and tests of the client side logic.
+//!
+//! The server listens on a single local port and reports itself as the only
+//! endpoint of the database, so a driver created with GetEndpoint() and
+//! GetDatabase() sends all traffic to it.
+class TFakeServer {
+public:
+    explicit TFakeServer(const TFakeServerSettings& settings = {});
+    ~TFakeServer();
+
+    TFakeServer(const TFakeServer&) = delete;
+    TFakeServer& operator=(const TFakeServer&) = delete;
+
+    const std::string& GetEndpoint() const;
+    const std::string& GetDatabase() const;
+
+    TFakeServerStats GetStats() const;
+
+    //! While writes are held topic write streams accept messages but neither
+    //! acknowledge nor count them
+    void HoldWrites(bool hold);
+
+    //! Cancels open streams and stops listening, called by the destructor
+    void Stop();
+
+private:
+    class TImpl;
+    std::unique_ptr<TImpl> Impl_;
+};
+
+} // namespace NYdb::NTests
@@ -13,6 +13,8 @@
 #include <library/cpp/testing/unittest/tests_data.h>
 #include <util/generic/mapfindptr.h>
 
+#include <optional>
+
 using namespace NYdb;
 using namespace NYdb::NCoordination;
 
@@ -99,6 +101,67 @@ namespace {
         std::atomic<uint64_t> LastSessionId{ 0 };
     };
 
+    class TMockSemaphoreService : public Ydb::Coordination::V1::CoordinationService::Service {
+    public:
+        grpc::Status Session(
+                grpc::ServerContext* context,
+                grpc::ServerReaderWriter<
+                    Ydb::Coordination::SessionResponse,
+                    Ydb::Coordination::SessionRequest>* stream) override
+        {
+            Y_UNUSED(context);
+
+            Ydb::Coordination::SessionRequest request;
+            while (stream->Read(&request)) {
+                std::cerr << "Session request: " << request.ShortDebugString() << std::endl;
+                Ydb::Coordination::SessionResponse response;
+                switch (request.request_case()) {
+                    case Ydb::Coordination::SessionRequest::kSessionStart: {
+                        auto* started = response.mutable_session_started();
+                        started->set_session_id(1);
+                        started->set_timeout_millis(request.session_start().timeout_millis());
+                        break;
+                    }
+                    case Ydb::Coordination::SessionRequest::kPing: {
+                        response.mutable_pong()->set_opaque(request.ping().opaque());
+                        break;
+                    }
+                    case Ydb::Coordination::SessionRequest::kAcquireSemaphore: {
+                        ++AcquireRequests;
+                        auto* result = response.mutable_acquire_semaphore_result();
+                        result->set_req_id(request.acquire_semaphore().req_id());
+                        result->set_status(Ydb::StatusIds::SUCCESS);
+                        result->set_acquired(true);
+                        break;
+                    }
+                    case Ydb::Coordination::SessionRequest::kReleaseSemaphore: {
+                        ++ReleaseRequests;
+                        FirstRelease.TrySetValue();
+                        auto* result = response.mutable_release_semaphore_result();
+                        result->set_req_id(request.release_semaphore().req_id());
+                        result->set_status(Ydb::StatusIds::SUCCESS);
+                        result->set_released(true);
+                        break;
+                    }
+                    case Ydb::Coordination::SessionRequest::kSessionStop: {
+                        response.mutable_session_stopped()->set_session_id(1);
+                        break;
+                    }
+                    default:
+                        Y_ABORT("Unexpected session request");
+                }
+                stream->Write(response);
+                request.Clear();
+            }
+
+            return grpc::Status::OK;
+        }
+
+        std::atomic<uint64_t> AcquireRequests{ 0 };
+        std::atomic<uint64_t> ReleaseRequests{ 0 };
+        NThreading::TPromise<void> FirstRelease = NThreading::NewPromise();
+    };
+
     template<class TService>
     std::unique_ptr<grpc::Server> StartGrpcServer(const std::string& address, TService& service) {
         grpc::ServerBuilder builder;
@@ -107,6 +170,49 @@ namespace {
         return builder.BuildAndStart();
     }
 
+    // Session of a client connected to TMockSemaphoreService through a fake discovery
+    struct TSemaphoreLeaseEnv {
+        explicit TSemaphoreLeaseEnv(TDuration idleTimeout) {
+            ui16 coordinationPort = PortManager.GetPort();
+            CoordinationServer = StartGrpcServer(
+                    TStringBuilder() << "0.0.0.0:" << coordinationPort,
+                    CoordinationService);
+
+            auto& dbResult = DiscoveryService.MockResults["/Root/My/DB"];
+            auto* endpoint = dbResult.add_endpoints();
+            endpoint->set_address("localhost");
+            endpoint->set_port(coordinationPort);
+
+            ui16 discoveryPort = PortManager.GetPort();
+            DiscoveryServer = StartGrpcServer(
+                    TStringBuilder() << "0.0.0.0:" << discoveryPort,
+                    DiscoveryService);
+
+            Driver.emplace(TDriverConfig()
+                .SetEndpoint(TStringBuilder() << "localhost:" << discoveryPort)
+                .SetDatabase("/Root/My/DB"));
+            Client.emplace(*Driver);
+
+            auto res = Client->StartSession("/Some/Path", TSessionSettings()
+                .SemaphoreLeaseIdleTimeout(idleTimeout)).ExtractValueSync();
+            UNIT_ASSERT_VALUES_EQUAL_C(res.GetStatus(), EStatus::SUCCESS, res.GetIssues().ToString());
+            Session = res.ExtractResult();
+        }
+
+        ~TSemaphoreLeaseEnv() {
+            Session.Close().ExtractValueSync();
+        }
+
+        TPortManager PortManager;
+        TMockSemaphoreService CoordinationService;
+        TMockDiscoveryService DiscoveryService;
+        std::unique_ptr<grpc::Server> CoordinationServer;
+        std::unique_ptr<grpc::Server> DiscoveryServer;
+        std::optional<TDriver> Driver;
+        std::optional<TClient> Client;
+        TSession Session;
+    };
+
 } // namespace
 
 Y_UNIT_TEST_SUITE(Coordination) {
@@ -295,4 +401,122 @@ Y_UNIT_TEST_SUITE(Coordination) {
         UNIT_ASSERT_VALUES_EQUAL_C(res2.GetStatus(), EStatus::CLIENT_CANCELLED, res2.GetIssues().ToString());
     }
 
+    Y_UNIT_TEST(SemaphoreLeaseReusesAcquisition) {
+        TSemaphoreLeaseEnv env(TDuration::MilliSeconds(200));
+        auto& session = env.Session;
+        const auto exclusive = TAcquireSemaphoreSettings().Exclusive();
+
+        // A concurrent acquirer waits until the first holder releases the lease
+        const uint64_t hold1 = session.AcquireSemaphoreLease("Lock", exclusive).ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold1);
+        auto acquired2 = session.AcquireSemaphoreLease("Lock", exclusive);
+        auto acquired3 = session.AcquireSemaphoreLease("Lock", exclusive);
+        UNIT_ASSERT(!acquired2.HasValue());
+        UNIT_ASSERT(!acquired3.HasValue());
+
+        // Different count cannot share the lease in use
+        auto shared = session.AcquireSemaphoreLease("Lock", TAcquireSemaphoreSettings().Shared()).ExtractValueSync();
+        UNIT_ASSERT_VALUES_EQUAL(shared.GetStatus(), EStatus::BAD_REQUEST);
+
+        // Only the holder can release the lease
+        UNIT_ASSERT(!session.ReleaseSemaphoreLease("Lock", hold1 + 100).ExtractValueSync().GetResult());
+        UNIT_ASSERT(!acquired2.HasValue());
+
+        // The lease is handed over to the waiters one by one
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold1).ExtractValueSync().GetResult());
+        const uint64_t hold2 = acquired2.ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold2);
+        UNIT_ASSERT(!acquired3.HasValue());
+        UNIT_ASSERT(!session.ReleaseSemaphoreLease("Lock", hold1).ExtractValueSync().GetResult());
+        UNIT_ASSERT(!acquired3.HasValue());
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold2).ExtractValueSync().GetResult());
+        const uint64_t hold3 = acquired3.ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold3);
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold3).ExtractValueSync().GetResult());
+        UNIT_ASSERT(!session.ReleaseSemaphoreLease("Lock", hold3).ExtractValueSync().GetResult());
+
+        // Short critical sections reuse the lease while it is not idle for too long
+        for (int i = 0; i < 100; ++i) {
+            const uint64_t hold = session.AcquireSemaphoreLease("Lock", exclusive).ExtractValueSync().GetResult();
+            UNIT_ASSERT(hold);
+            UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold).ExtractValueSync().GetResult());
+        }
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.AcquireRequests.load(), 1u);
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.ReleaseRequests.load(), 0u);
+
+        // Idle lease is eventually released on the server
+        UNIT_ASSERT(env.CoordinationService.FirstRelease.GetFuture().Wait(TDuration::Seconds(5)));
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.ReleaseRequests.load(), 1u);
+    }
+
+    Y_UNIT_TEST(SemaphoreLeaseSharesCount) {
+        TSemaphoreLeaseEnv env(TDuration::Hours(1));
+        auto& session = env.Session;
+        const auto settings = TAcquireSemaphoreSettings().Count(2);
+
+        // Two holders share the acquired count, the third one waits
+        const uint64_t hold1 = session.AcquireSemaphoreLease("Lock", settings).ExtractValueSync().GetResult();
+        const uint64_t hold2 = session.AcquireSemaphoreLease("Lock", settings).ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold1);
+        UNIT_ASSERT(hold2);
+        UNIT_ASSERT_UNEQUAL(hold1, hold2);
+        auto acquired3 = session.AcquireSemaphoreLease("Lock", settings);
+        UNIT_ASSERT(!acquired3.HasValue());
+
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold2).ExtractValueSync().GetResult());
+        const uint64_t hold3 = acquired3.ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold3);
+
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold1).ExtractValueSync().GetResult());
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold3).ExtractValueSync().GetResult());
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.AcquireRequests.load(), 1u);
+    }
+
+    Y_UNIT_TEST(SemaphoreLeaseWaiterTimeout) {
+        TSemaphoreLeaseEnv env(TDuration::Hours(1));
+        auto& session = env.Session;
+        const auto exclusive = TAcquireSemaphoreSettings().Exclusive();
+
+        const uint64_t hold = session.AcquireSemaphoreLease("Lock", exclusive).ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold);
+
+        // Acquirers give up after their timeout, as with AcquireSemaphore
+        auto noWait = session.AcquireSemaphoreLease("Lock", TAcquireSemaphoreSettings(exclusive)
+            .Timeout(TDuration::Zero())).ExtractValueSync();
+        UNIT_ASSERT_VALUES_EQUAL_C(noWait.GetStatus(), EStatus::SUCCESS, noWait.GetIssues().ToString());
+        UNIT_ASSERT_VALUES_EQUAL(noWait.GetResult(), 0u);
+
+        auto timedOut = session.AcquireSemaphoreLease("Lock", TAcquireSemaphoreSettings(exclusive)
+            .Timeout(TDuration::MilliSeconds(50)));
+        auto waiting = session.AcquireSemaphoreLease("Lock", exclusive);
+        auto result = timedOut.ExtractValueSync();
+        UNIT_ASSERT_VALUES_EQUAL_C(result.GetStatus(), EStatus::SUCCESS, result.GetIssues().ToString());
+        UNIT_ASSERT_VALUES_EQUAL(result.GetResult(), 0u);
+        UNIT_ASSERT(!waiting.HasValue());
+
+        // The waiter behind the timed out one gets the lease
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold).ExtractValueSync().GetResult());
+        const uint64_t next = waiting.ExtractValueSync().GetResult();
+        UNIT_ASSERT(next);
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", next).ExtractValueSync().GetResult());
+    }
+
+    Y_UNIT_TEST(SemaphoreLeaseChangesCountWhenIdle) {
+        TSemaphoreLeaseEnv env(TDuration::Hours(1));
+        auto& session = env.Session;
+
+        const uint64_t hold = session.AcquireSemaphoreLease("Lock", TAcquireSemaphoreSettings().Exclusive())
+            .ExtractValueSync().GetResult();
+        UNIT_ASSERT(hold);
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", hold).ExtractValueSync().GetResult());
+
+        // The idle lease is released and acquired again with the new count
+        auto shared = session.AcquireSemaphoreLease("Lock", TAcquireSemaphoreSettings().Shared()).ExtractValueSync();
+        UNIT_ASSERT_VALUES_EQUAL_C(shared.GetStatus(), EStatus::SUCCESS, shared.GetIssues().ToString());
+        UNIT_ASSERT(shared.GetResult());
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.ReleaseRequests.load(), 1u);
+        UNIT_ASSERT_VALUES_EQUAL(env.CoordinationService.AcquireRequests.load(), 2u);
+        UNIT_ASSERT(session.ReleaseSemaphoreLease("Lock", shared.GetResult()).ExtractValueSync().GetResult());
+    }
+
 }
@@ -11,6 +11,7 @@
 
 #include <library/cpp/testing/unittest/registar.h>
 #include <library/cpp/testing/unittest/tests_data.h>
+#include <util/folder/tempdir.h>
 #include <util/generic/mapfindptr.h>
 
 #include <atomic>
@@ -233,4 +234,53 @@ Y_UNIT_TEST_SUITE(CppGrpcClientSimpleTest) {
         UNIT_ASSERT_VALUES_EQUAL(session.GetId(), "my-session-id");
     }
 
+    Y_UNIT_TEST(DiscoveryCache) {
+        TPortManager pm;
+        TTempDir cacheDir;
+
+        TMockTableService tableService;
+        ui16 tablePort = pm.GetPort();
+        auto tableServer = StartGrpcServer(
+                TStringBuilder() << "127.0.0.1:" << tablePort,
+                tableService);
+
+        TMockDiscoveryService discoveryService;
+        {
+            auto& dbResult = discoveryService.MockResults["/Root/My/DB"];
+            auto* endpoint = dbResult.add_endpoints();
+            endpoint->set_address("127.0.0.1");
+            endpoint->set_port(tablePort);
+        }
+        ui16 discoveryPort = pm.GetPort();
+        auto discoveryServer = StartGrpcServer(
+                TStringBuilder() << "0.0.0.0:" << discoveryPort,
+                discoveryService);
+
+        auto config = TDriverConfig()
+            .SetEndpoint(TStringBuilder() << "localhost:" << discoveryPort)
+            .SetDatabase("/Root/My/DB")
+            .SetDiscoveryMode(EDiscoveryMode::Async)
+            .SetDiscoveryCachePath(cacheDir.Name());
+
+        {
+            auto driver = TDriver(config);
+            auto client = NTable::TTableClient(driver);
+            auto sessionResult = client.CreateSession().ExtractValueSync();
+            UNIT_ASSERT_C(sessionResult.IsSuccess(), sessionResult.GetIssues().ToString());
+            driver.Stop(true);
+        }
+
+        // Discovery is unavailable now, endpoints must come from the cache
+        discoveryServer->Shutdown();
+
+        auto driver = TDriver(config);
+        auto client = NTable::TTableClient(driver);
+        auto sessionFuture = client.CreateSession();
+
+        UNIT_ASSERT(sessionFuture.Wait(TDuration::Seconds(10)));
+        auto sessionResult = sessionFuture.ExtractValueSync();
+        UNIT_ASSERT_C(sessionResult.IsSuccess(), sessionResult.GetIssues().ToString());
+        UNIT_ASSERT_VALUES_EQUAL(sessionResult.GetSession().GetId(), "my-session-id");
+    }
+
 }
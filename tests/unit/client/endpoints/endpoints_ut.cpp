@@ -144,6 +144,21 @@ Y_UNIT_TEST_SUITE(EndpointElector) {
         UNIT_ASSERT_VALUES_EQUAL(elector.GetPessimizationRatio(), 0);
     }
 
+    Y_UNIT_TEST(BestEndpoints) {
+        TEndpointElectorSafe elector;
+        elector.SetNewState(std::vector<TEndpointRecord>{{"Two", 2}, {"One", 1}, {"Three", 3}});
+        auto best = elector.GetBestEndpoints(2);
+        UNIT_ASSERT_VALUES_EQUAL(best.size(), 2);
+        UNIT_ASSERT_VALUES_EQUAL(best[0].Endpoint, "One");
+        UNIT_ASSERT_VALUES_EQUAL(best[1].Endpoint, "Two");
+
+        elector.PessimizeEndpoint("One");
+        elector.PessimizeEndpoint("Three");
+        best = elector.GetBestEndpoints(10);
+        UNIT_ASSERT_VALUES_EQUAL(best.size(), 1);
+        UNIT_ASSERT_VALUES_EQUAL(best[0].Endpoint, "Two");
+    }
+
     Y_UNIT_TEST(Election) {
         TEndpointElectorSafe elector;
         elector.SetNewState(std::vector<TEndpointRecord>{{"Two", 2}, {"One_A", 1}, {"Three", 3}, {"One_B", 1}});
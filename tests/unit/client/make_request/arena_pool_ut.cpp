@@ -0,0 +1,64 @@
+#define INCLUDE_YDB_INTERNAL_H
+#include <src/client/impl/ydb_internal/make_request/arena_pool.h>
+#undef INCLUDE_YDB_INTERNAL_H
+
+#include <src/api/protos/ydb_value.pb.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace NYdb;
+
+namespace {
+
+// Drops the arena on a thread of its own, as the gRPC and response threads do
+void ReleaseOnOtherThread(std::shared_ptr<google::protobuf::Arena>&& arena) {
+    std::thread([arena = std::move(arena)]() mutable {
+        arena.reset();
+    }).join();
+}
+
+} // namespace
+
+TEST(ArenaPool, ReusesArenaReleasedOnOtherThread) {
+    auto arena = TArenaPool::Acquire();
+    const auto* acquired = arena.get();
+    const size_t freeCount = TArenaPool::GetFreeCount();
+
+    ReleaseOnOtherThread(std::move(arena));
+    EXPECT_EQ(TArenaPool::GetFreeCount(), freeCount + 1);
+
+    auto reused = TArenaPool::Acquire();
+    EXPECT_EQ(reused.get(), acquired);
+    EXPECT_EQ(TArenaPool::GetFreeCount(), freeCount);
+}
+
+TEST(ArenaPool, ReleasedArenaIsReset) {
+    auto arena = TArenaPool::Acquire();
+    const auto* acquired = arena.get();
+    for (size_t i = 0; i < 1000; ++i) {
+        auto* value = google::protobuf::Arena::CreateMessage<Ydb::Value>(arena.get());
+        value->set_text_value(std::string(100, 'x'));
+    }
+    ASSERT_GT(arena->SpaceUsed(), TArenaPool::INITIAL_BLOCK_SIZE);
+
+    ReleaseOnOtherThread(std::move(arena));
+    auto reused = TArenaPool::Acquire();
+    ASSERT_EQ(reused.get(), acquired);
+    EXPECT_EQ(reused->SpaceUsed(), 0u);
+}
+
+TEST(ArenaPool, KeepsAtMostMaxFreeArenas) {
+    std::vector<std::shared_ptr<google::protobuf::Arena>> arenas;
+    for (size_t i = 0; i < TArenaPool::MAX_FREE_ARENAS * 2; ++i) {
+        arenas.push_back(TArenaPool::Acquire());
+    }
+    EXPECT_EQ(TArenaPool::GetFreeCount(), 0u);
+
+    std::thread([arenas = std::move(arenas)]() mutable {
+        arenas.clear();
+    }).join();
+    EXPECT_EQ(TArenaPool::GetFreeCount(), TArenaPool::MAX_FREE_ARENAS);
+}
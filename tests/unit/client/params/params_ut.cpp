@@ -239,3 +239,122 @@ TEST(ParamsBuilder, TypeMismatchFromValue) {
             .Build();
     }, TExpectedErrorException);
 }
+
+namespace {
+
+TParamsTemplate MakeParamsTemplate() {
+    std::map<std::string, TType> paramsMap;
+    paramsMap.emplace("$id", TTypeBuilder().Primitive(EPrimitiveType::Uint64).Build());
+    paramsMap.emplace("$name", TTypeBuilder()
+        .BeginOptional()
+            .Primitive(EPrimitiveType::Utf8)
+        .EndOptional()
+        .Build());
+    paramsMap.emplace("$tags", TTypeBuilder()
+        .BeginList()
+            .Primitive(EPrimitiveType::String)
+        .EndList()
+        .Build());
+    return TParamsTemplate(paramsMap);
+}
+
+} // namespace
+
+TEST(ParamsTemplate, Build) {
+    auto paramsTemplate = MakeParamsTemplate();
+    ASSERT_EQ(paramsTemplate.GetSlotsCount(), 3u);
+    const size_t id = paramsTemplate.GetSlot("$id");
+    const size_t name = paramsTemplate.GetSlot("$name");
+    const size_t tags = paramsTemplate.GetSlot("$tags");
+
+    auto tagsValue = TValueBuilder()
+        .BeginList()
+        .AddListItem()
+            .String("tag")
+        .EndList()
+        .Build();
+
+    auto builder = paramsTemplate.CreateBuilder();
+    auto params = builder
+        .Uint64(id, 10)
+        .Utf8(name, "test")
+        .Value(tags, tagsValue)
+        .Build();
+
+    ASSERT_EQ(FormatType(params.GetValue("$id")->GetType()), "Uint64");
+    CheckProtoValue(params.GetValue("$id")->GetProto(), "uint64_value: 10\n");
+    ASSERT_EQ(FormatType(params.GetValue("$name")->GetType()), "Utf8?");
+    CheckProtoValue(params.GetValue("$name")->GetProto(), "text_value: \"test\"\n");
+    ASSERT_EQ(FormatType(params.GetValue("$tags")->GetType()), "List<String>");
+    CheckProtoValue(params.GetValue("$tags")->GetProto(),
+        "items {\n"
+        "  bytes_value: \"tag\"\n"
+        "}\n");
+
+    // The builder is reused, unset optional parameters are null
+    auto nextParams = builder
+        .Uint64(id, 11)
+        .Value(tags, tagsValue)
+        .Build();
+
+    CheckProtoValue(nextParams.GetValue("$id")->GetProto(), "uint64_value: 11\n");
+    CheckProtoValue(nextParams.GetValue("$name")->GetProto(), "null_flag_value: NULL_VALUE\n");
+    CheckProtoValue(params.GetValue("$id")->GetProto(), "uint64_value: 10\n");
+}
+
+TEST(ParamsTemplate, Errors) {
+    auto paramsTemplate = MakeParamsTemplate();
+    const size_t id = paramsTemplate.GetSlot("$id");
+    const size_t tags = paramsTemplate.GetSlot("$tags");
+
+    ASSERT_THROW(paramsTemplate.GetSlot("$missing"), TExpectedErrorException);
+
+    auto builder = paramsTemplate.CreateBuilder();
+    ASSERT_THROW(builder.Int64(id, 10), TExpectedErrorException);
+    ASSERT_THROW(builder.Null(id), TExpectedErrorException);
+    ASSERT_THROW(builder.Uint64(paramsTemplate.GetSlotsCount(), 10), TExpectedErrorException);
+    ASSERT_THROW(builder.Value(tags, TValueBuilder().Uint64(1).Build()), TExpectedErrorException);
+
+    // $tags is not set
+    builder.Uint64(id, 10);
+    ASSERT_THROW(builder.Build(), TExpectedErrorException);
+}
+
+TEST(ParamsTemplate, Recycle) {
+    auto paramsTemplate = MakeParamsTemplate();
+    const size_t id = paramsTemplate.GetSlot("$id");
+    const size_t name = paramsTemplate.GetSlot("$name");
+    const size_t tags = paramsTemplate.GetSlot("$tags");
+    const auto tagsValue = TValueBuilder().EmptyList(TTypeBuilder().Primitive(EPrimitiveType::String).Build()).Build();
+
+    auto builder = paramsTemplate.CreateBuilder();
+    auto params = builder
+        .Uint64(id, 10)
+        .Utf8(name, "test")
+        .Value(tags, tagsValue)
+        .Build();
+    builder.Recycle(std::move(params));
+
+    // Values of the recycled params are not carried over
+    auto nextParams = builder
+        .Uint64(id, 11)
+        .Value(tags, tagsValue)
+        .Build();
+    ASSERT_EQ(nextParams.GetValues().size(), 3u);
+    ASSERT_EQ(FormatType(nextParams.GetValue("$name")->GetType()), "Utf8?");
+    CheckProtoValue(nextParams.GetValue("$id")->GetProto(), "uint64_value: 11\n");
+    CheckProtoValue(nextParams.GetValue("$name")->GetProto(), "null_flag_value: NULL_VALUE\n");
+
+    // Params of another shape and params shared with a copy are not taken
+    builder.Recycle(TParamsBuilder().AddParam("$id").Uint64(1).Build().Build());
+    auto copy = nextParams;
+    builder.Recycle(std::move(nextParams));
+    CheckProtoValue(copy.GetValue("$id")->GetProto(), "uint64_value: 11\n");
+
+    auto lastParams = builder
+        .Uint64(id, 12)
+        .Value(tags, tagsValue)
+        .Build();
+    ASSERT_EQ(lastParams.GetValues().size(), 3u);
+    CheckProtoValue(lastParams.GetValue("$id")->GetProto(), "uint64_value: 12\n");
+}
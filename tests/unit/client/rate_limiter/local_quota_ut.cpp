@@ -0,0 +1,119 @@
+#include <ydb-cpp-sdk/client/rate_limiter/rate_limiter.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace NYdb;
+using namespace NYdb::NRateLimiter;
+
+namespace {
+
+// Local fake of coordination node that grants all requested units.
+struct TFakeResource {
+    std::atomic<uint64_t> Requests = 0;
+    std::atomic<uint64_t> AcquiredUnits = 0;
+    // If set, requests wait for this promise.
+    NThreading::TPromise<TStatus> Pending;
+
+    TLocalQuota::TAcquireBatch MakeAcquireBatch() {
+        return [this](uint64_t amount) -> TAsyncStatus {
+            ++Requests;
+            if (Pending.Initialized()) {
+                return Pending.GetFuture().Apply([this, amount](const TAsyncStatus& future) {
+                    if (future.GetValue().IsSuccess()) {
+                        AcquiredUnits += amount;
+                    }
+                    return future.GetValue();
+                });
+            }
+            AcquiredUnits += amount;
+            return NThreading::MakeFuture(TStatus(EStatus::SUCCESS, {}));
+        };
+    }
+};
+
+} // namespace
+
+TEST(LocalQuota, AcquiresInBatches) {
+    TFakeResource resource;
+    TLocalQuota quota(resource.MakeAcquireBatch(), TLocalQuotaSettings().BatchSize(100));
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(quota.Acquire().GetValueSync().IsSuccess());
+    }
+
+    ASSERT_LE(resource.Requests.load(), 11u);
+    // Units are never granted locally without being acquired from the resource.
+    ASSERT_GE(resource.AcquiredUnits.load(), 1000u);
+    ASSERT_EQ(resource.AcquiredUnits.load() - 1000u, quota.GetAvailable());
+}
+
+TEST(LocalQuota, LargeAmount) {
+    TFakeResource resource;
+    TLocalQuota quota(resource.MakeAcquireBatch(), TLocalQuotaSettings().BatchSize(10));
+
+    ASSERT_TRUE(quota.Acquire(25).GetValueSync().IsSuccess());
+    ASSERT_EQ(resource.AcquiredUnits.load(), 25u);
+}
+
+TEST(LocalQuota, WaitsForRefill) {
+    TFakeResource resource;
+    resource.Pending = NThreading::NewPromise<TStatus>();
+    TLocalQuota quota(resource.MakeAcquireBatch(), TLocalQuotaSettings().BatchSize(10));
+
+    ASSERT_FALSE(quota.TryAcquire(1));
+    auto first = quota.Acquire(4);
+    auto second = quota.Acquire(4);
+    ASSERT_FALSE(first.HasValue());
+    ASSERT_FALSE(second.HasValue());
+    // Only one refill request is in flight.
+    ASSERT_EQ(resource.Requests.load(), 1u);
+
+    resource.Pending.SetValue(TStatus(EStatus::SUCCESS, {}));
+    ASSERT_TRUE(first.GetValueSync().IsSuccess());
+    ASSERT_TRUE(second.GetValueSync().IsSuccess());
+    ASSERT_EQ(quota.GetAvailable(), 2u);
+}
+
+TEST(LocalQuota, RefillFailure) {
+    TFakeResource resource;
+    resource.Pending = NThreading::NewPromise<TStatus>();
+    TLocalQuota quota(resource.MakeAcquireBatch(), TLocalQuotaSettings().BatchSize(10));
+
+    auto result = quota.Acquire(1);
+    resource.Pending.SetValue(TStatus(EStatus::OVERLOADED, {}));
+    ASSERT_EQ(result.GetValueSync().GetStatus(), EStatus::OVERLOADED);
+    ASSERT_EQ(quota.GetAvailable(), 0u);
+}
+
+TEST(LocalQuota, ConcurrentAcquire) {
+    constexpr size_t threadsCount = 8;
+    constexpr uint64_t acquisitionsPerThread = 10000;
+    constexpr uint64_t batchSize = 500;
+
+    TFakeResource resource;
+    TLocalQuota quota(resource.MakeAcquireBatch(), TLocalQuotaSettings().BatchSize(batchSize));
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&quota] {
+            for (uint64_t j = 0; j < acquisitionsPerThread; ++j) {
+                if (!quota.TryAcquire()) {
+                    ASSERT_TRUE(quota.Acquire().GetValueSync().IsSuccess());
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const uint64_t granted = threadsCount * acquisitionsPerThread;
+    ASSERT_GE(resource.AcquiredUnits.load(), granted);
+    ASSERT_EQ(resource.AcquiredUnits.load() - granted, quota.GetAvailable());
+    // Prefetch never holds more than one extra batch.
+    ASSERT_LE(quota.GetAvailable(), batchSize);
+    ASSERT_LE(resource.Requests.load(), granted / batchSize + 1);
+}
@@ -234,4 +234,45 @@ Y_UNIT_TEST_SUITE(CppGrpcClientResultSetTest) {
         
         UNIT_ASSERT_EXCEPTION_CONTAINS(rsParser.TryNextRow(), TContractViolation, "Corrupted data: row 0 contains 1 column(s), but metadata contains 2 column(s)");
     }
+
+    Y_UNIT_TEST(ArenaResultSet) {
+        const std::string resultSetString =
+            "columns {\n"
+            "  name: \"colName\"\n"
+            "  type {\n"
+            "    type_id: UTF8\n"
+            "  }\n"
+            "}\n"
+            "rows {\n"
+            "  items {\n"
+            "    text_value: \"first\"\n"
+            "  }\n"
+            "}\n"
+            "rows {\n"
+            "  items {\n"
+            "    text_value: \"second\"\n"
+            "  }\n"
+            "}\n";
+
+        std::optional<NYdb::TResultSet> rs;
+        {
+            auto arena = std::make_shared<google::protobuf::Arena>();
+            auto* rsProto = google::protobuf::Arena::CreateMessage<Ydb::ResultSet>(arena.get());
+            google::protobuf::TextFormat::ParseFromString(TStringType{resultSetString}, rsProto);
+            rs.emplace(rsProto, arena);
+        }
+
+        // The result set owns the arena now
+        auto copy = *rs;
+        rs.reset();
+
+        NYdb::TResultSetParser rsParser(copy);
+        UNIT_ASSERT_EQUAL(rsParser.ColumnsCount(), 1);
+        UNIT_ASSERT_EQUAL(rsParser.RowsCount(), 2);
+        UNIT_ASSERT(rsParser.TryNextRow());
+        UNIT_ASSERT_EQUAL(rsParser.ColumnParser(0).GetUtf8(), "first");
+        UNIT_ASSERT(rsParser.TryNextRow());
+        UNIT_ASSERT_EQUAL(rsParser.ColumnParser(0).GetUtf8(), "second");
+        UNIT_ASSERT(!rsParser.TryNextRow());
+    }
 }
@@ -0,0 +1,167 @@
+#include <ydb-cpp-sdk/client/result/result.h>
+#include <ydb-cpp-sdk/client/result/writer.h>
+#include <ydb-cpp-sdk/type_switcher.h>
+
+#include <src/api/protos/ydb_value.pb.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+
+#include <google/protobuf/text_format.h>
+
+#include <util/stream/str.h>
+
+using namespace NYdb;
+
+namespace {
+
+TResultSet ParseResultSet(const std::string& text) {
+    Ydb::ResultSet proto;
+    Y_ABORT_UNLESS(google::protobuf::TextFormat::ParseFromString(TStringType{text}, &proto));
+    return TResultSet(std::move(proto));
+}
+
+const std::string PrimitiveResultSet =
+    "columns { name: \"id\" type { type_id: UINT64 } }\n"
+    "columns { name: \"name\" type { optional_type { item { type_id: UTF8 } } } }\n"
+    "columns { name: \"ts\" type { type_id: TIMESTAMP } }\n"
+    "columns { name: \"score\" type { type_id: DOUBLE } }\n"
+    "rows {\n"
+    "  items { uint64_value: 1 }\n"
+    "  items { text_value: \"plain\" }\n"
+    "  items { uint64_value: 0 }\n"
+    "  items { double_value: 0.5 }\n"
+    "}\n"
+    "rows {\n"
+    "  items { uint64_value: 2 }\n"
+    "  items { text_value: \"with, \\\"quotes\\\"\" }\n"
+    "  items { uint64_value: 1700000000123456 }\n"
+    "  items { double_value: -2 }\n"
+    "}\n"
+    "rows {\n"
+    "  items { uint64_value: 3 }\n"
+    "  items { null_flag_value: NULL_VALUE }\n"
+    "  items { uint64_value: 951782400000000 }\n"
+    "  items { double_value: 1e100 }\n"
+    "}\n";
+
+} // namespace
+
+Y_UNIT_TEST_SUITE(ResultSetWriterTest) {
+    Y_UNIT_TEST(CsvPrimitives) {
+        TString out;
+        TStringOutput stream(out);
+        auto writer = CreateCsvWriter(stream, TCsvWriterSettings().NullValue("\\N"));
+        writer->Write(ParseResultSet(PrimitiveResultSet));
+
+        UNIT_ASSERT_VALUES_EQUAL(out,
+            "id,name,ts,score\n"
+            "1,plain,1970-01-01T00:00:00.000000Z,0.5\n"
+            "2,\"with, \"\"quotes\"\"\",2023-11-14T22:13:20.123456Z,-2\n"
+            "3,\\N,2000-02-29T00:00:00.000000Z,1e+100\n");
+    }
+
+    Y_UNIT_TEST(CsvSeveralParts) {
+        TString out;
+        TStringOutput stream(out);
+        auto writer = CreateCsvWriter(stream, TCsvWriterSettings().Delimiter('\t').Header(false));
+        writer->Write(ParseResultSet(PrimitiveResultSet));
+        writer->Write(ParseResultSet(PrimitiveResultSet));
+
+        UNIT_ASSERT_VALUES_EQUAL(std::count(out.cbegin(), out.cend(), '\n'), 6);
+        UNIT_ASSERT(out.StartsWith("1\tplain\t"));
+
+        auto other = ParseResultSet("columns { name: \"id\" type { type_id: UINT64 } }");
+        UNIT_ASSERT_EXCEPTION(writer->Write(other), yexception);
+    }
+
+    Y_UNIT_TEST(JsonLinesPrimitives) {
+        TString out;
+        TStringOutput stream(out);
+        auto writer = CreateJsonLinesWriter(stream);
+        writer->Write(ParseResultSet(PrimitiveResultSet));
+
+        UNIT_ASSERT_VALUES_EQUAL(out,
+            "{\"id\":1,\"name\":\"plain\",\"ts\":\"1970-01-01T00:00:00.000000Z\",\"score\":0.5}\n"
+            "{\"id\":2,\"name\":\"with, \\\"quotes\\\"\",\"ts\":\"2023-11-14T22:13:20.123456Z\",\"score\":-2}\n"
+            "{\"id\":3,\"name\":null,\"ts\":\"2000-02-29T00:00:00.000000Z\",\"score\":1e+100}\n");
+    }
+
+    Y_UNIT_TEST(DatesAndSpecialTypes) {
+        const std::string resultSet =
+            "columns { name: \"date\" type { type_id: DATE } }\n"
+            "columns { name: \"date32\" type { type_id: DATE32 } }\n"
+            "columns { name: \"datetime\" type { type_id: DATETIME } }\n"
+            "columns { name: \"interval\" type { type_id: INTERVAL } }\n"
+            "columns { name: \"uuid\" type { type_id: UUID } }\n"
+            "columns { name: \"decimal\" type { decimal_type { precision: 22 scale: 9 } } }\n"
+            "columns { name: \"bytes\" type { type_id: STRING } }\n"
+            "rows {\n"
+            "  items { uint32_value: 19723 }\n"
+            "  items { int32_value: -1 }\n"
+            "  items { uint32_value: 86399 }\n"
+            "  items { int64_value: -1500000 }\n"
+            "  items { low_128: 0x4e09a3e4c7eb7a70 high_128: 0x9e2c48a1e2d5d3b5 }\n"
+            "  items { low_128: 1500000000 high_128: 0 }\n"
+            "  items { bytes_value: \"\\x01\\x02\" }\n"
+            "}\n";
+
+        TString out;
+        TStringOutput stream(out);
+        auto writer = CreateJsonLinesWriter(stream, TJsonLinesWriterSettings().BinaryAsBase64(true));
+        writer->Write(ParseResultSet(resultSet));
+
+        UNIT_ASSERT_VALUES_EQUAL(out,
+            "{\"date\":\"2024-01-01\",\"date32\":\"1969-12-31\",\"datetime\":\"1970-01-01T23:59:59Z\","
+            "\"interval\":-1500000,\"uuid\":\"c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9e\",\"decimal\":\"1.5\","
+            "\"bytes\":\"AQI=\"}\n");
+    }
+
+    Y_UNIT_TEST(CsvDecimalAndUuid) {
+        const std::string resultSet =
+            "columns { name: \"decimal\" type { optional_type { item { decimal_type { precision: 35 scale: 10 } } } } }\n"
+            "columns { name: \"uuid\" type { type_id: UUID } }\n"
+            "rows {\n"
+            "  items { low_128: 0x055690dc2f8be401 high_128: 0x1a }\n"
+            "  items { low_128: 0x4e09a3e4c7eb7a70 high_128: 0x9e2c48a1e2d5d3b5 }\n"
+            "}\n"
+            "rows {\n"
+            "  items { low_128: 0xfffffffffffffff6 high_128: 0xffffffffffffffff }\n"
+            "  items { low_128: 0 high_128: 0 }\n"
+            "}\n";
+
+        TString out;
+        TStringOutput stream(out);
+        CreateCsvWriter(stream, TCsvWriterSettings().Header(false))->Write(ParseResultSet(resultSet));
+        UNIT_ASSERT_VALUES_EQUAL(out,
+            "48000000001.0000000001,c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9e\n"
+            "-0.000000001,00000000-0000-0000-0000-000000000000\n");
+    }
+
+    Y_UNIT_TEST(Containers) {
+        const std::string resultSet =
+            "columns { name: \"list\" type { list_type { item { optional_type { item { type_id: INT32 } } } } } }\n"
+            "columns { name: \"struct\" type { struct_type {\n"
+            "  members { name: \"a\" type { type_id: UTF8 } }\n"
+            "  members { name: \"b\" type { type_id: BOOL } }\n"
+            "} } }\n"
+            "columns { name: \"dict\" type { dict_type { key { type_id: UTF8 } payload { type_id: UINT32 } } } }\n"
+            "rows {\n"
+            "  items { items { int32_value: 1 } items { null_flag_value: NULL_VALUE } }\n"
+            "  items { items { text_value: \"x,y\" } items { bool_value: true } }\n"
+            "  items { pairs { key { text_value: \"k\" } payload { uint32_value: 7 } } }\n"
+            "}\n";
+
+        TString csv;
+        TStringOutput csvStream(csv);
+        CreateCsvWriter(csvStream)->Write(ParseResultSet(resultSet));
+        UNIT_ASSERT_VALUES_EQUAL(csv,
+            "list,struct,dict\n"
+            "\"[1,null]\",\"{\"\"a\"\":\"\"x,y\"\",\"\"b\"\":true}\",\"[[\"\"k\"\",7]]\"\n");
+
+        TString jsonLines;
+        TStringOutput jsonLinesStream(jsonLines);
+        CreateJsonLinesWriter(jsonLinesStream)->Write(ParseResultSet(resultSet));
+        UNIT_ASSERT_VALUES_EQUAL(jsonLines,
+            "{\"list\":[1,null],\"struct\":{\"a\":\"x,y\",\"b\":true},\"dict\":[[\"k\",7]]}\n");
+    }
+}
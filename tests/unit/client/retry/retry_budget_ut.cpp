@@ -0,0 +1,86 @@
+#include <ydb-cpp-sdk/client/retry/retry.h>
+
+#include <gtest/gtest.h>
+
+using namespace NYdb;
+using namespace NYdb::NRetry;
+
+TEST(RetryBudget, LimitsRetriesBySuccesses) {
+    TRetryBudget budget(TRetryBudgetSettings()
+        .MaxTokens(2)
+        .RetryRatio(0.5)
+        .MinRetriesPerSecond(0)
+        .CircuitBreakerThreshold(0));
+
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::BudgetExhausted);
+
+    // Two successes pay for one retry.
+    budget.OnSuccess("a");
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::BudgetExhausted);
+    budget.OnSuccess("a");
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::Allow);
+
+    for (int i = 0; i < 100; ++i) {
+        budget.OnSuccess("a");
+    }
+    ASSERT_DOUBLE_EQ(budget.GetAvailableTokens(), 2.0);
+}
+
+TEST(RetryBudget, CircuitBreaker) {
+    TRetryBudget budget(TRetryBudgetSettings()
+        .MaxTokens(1000)
+        .CircuitBreakerThreshold(3)
+        .CircuitBreakerOpenDuration(TDuration::MilliSeconds(100)));
+
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::CircuitOpen);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::CircuitOpen);
+
+    // Other endpoints and statuses are not affected.
+    ASSERT_EQ(budget.OnFailure("b", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::UNAVAILABLE), ERetryDecision::Allow);
+
+    // Half-open: one failure is retried, the next one opens the circuit again.
+    Sleep(TDuration::MilliSeconds(150));
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::CircuitOpen);
+
+    // Success closes the circuit.
+    budget.OnSuccess("a");
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+}
+
+TEST(RetryBudget, IdleBreakersAreForgotten) {
+    TRetryBudget budget(TRetryBudgetSettings()
+        .MaxTokens(1000)
+        .CircuitBreakerThreshold(3)
+        .CircuitBreakerOpenDuration(TDuration::MilliSeconds(50)));
+
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+
+    // Failures separated by an idle period are not consecutive.
+    Sleep(TDuration::MilliSeconds(120));
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::Allow);
+    ASSERT_EQ(budget.OnFailure("a", EStatus::OVERLOADED), ERetryDecision::CircuitOpen);
+}
+
+TEST(RetryBudget, TakeRetryBypassesCircuitBreaker) {
+    TRetryBudget budget(TRetryBudgetSettings()
+        .MaxTokens(12)
+        .MinRetriesPerSecond(0)
+        .CircuitBreakerThreshold(2));
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(budget.TakeRetry(), ERetryDecision::Allow);
+    }
+
+    // None of the retries was accounted as a failure of the breaker.
+    ASSERT_EQ(budget.OnFailure({}, EStatus::UNAVAILABLE), ERetryDecision::Allow);
+    ASSERT_EQ(budget.TakeRetry(), ERetryDecision::Allow);
+    ASSERT_EQ(budget.TakeRetry(), ERetryDecision::BudgetExhausted);
+}
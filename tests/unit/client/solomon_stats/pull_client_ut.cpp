@@ -0,0 +1,104 @@
+#include <ydb-cpp-sdk/client/extensions/solomon_stats/pull_client.h>
+
+#include <library/cpp/http/simple/http_client.h>
+#include <library/cpp/testing/common/network.h>
+
+#include <util/stream/str.h>
+
+#include <gtest/gtest.h>
+
+using namespace NSolomonStatExtension;
+
+namespace {
+
+// Stands for the driver: reads the registry the extension gives it
+class TFakeStatApi : public NYdb::NSdkStats::IStatApi {
+public:
+    void SetMetricRegistry(NMonitoring::IMetricRegistry* registry) override {
+        Registry = static_cast<NMonitoring::TMetricRegistry*>(registry);
+    }
+
+    void Accept(NMonitoring::IMetricConsumer* consumer) const override {
+        Registry->Accept(TInstant::Zero(), consumer);
+    }
+
+    NMonitoring::TMetricRegistry* Registry = nullptr;
+};
+
+struct TResponse {
+    TString ContentType;
+    TString Body;
+};
+
+class TPullExtensionTest : public testing::Test {
+protected:
+    TPullExtensionTest()
+        : Port_(NTesting::GetFreePort())
+        , Extension_(TSolomonStatPullExtension::TParams("localhost", Port_, "project", "service", "cluster"), &Api_)
+    {
+        Api_.Registry->IntGauge({{"sensor", "test_gauge"}})->Set(42);
+    }
+
+    TResponse Get(TStringBuf path, const TString& accept = {}) {
+        TKeepAliveHttpClient client("localhost", Port_);
+        TKeepAliveHttpClient::THeaders headers;
+        if (accept) {
+            headers["Accept"] = accept;
+        }
+
+        TStringStream body;
+        THttpHeaders responseHeaders;
+        const auto code = client.DoGet(path, &body, headers, &responseHeaders);
+        EXPECT_EQ(code, 200u);
+
+        TResponse response;
+        response.Body = body.Str();
+        if (auto* header = responseHeaders.FindHeader("Content-Type")) {
+            response.ContentType = header->Value();
+        }
+        return response;
+    }
+
+private:
+    NTesting::TPortHolder Port_;
+    TFakeStatApi Api_;
+    TSolomonStatPullExtension Extension_;
+};
+
+void ExpectPrometheus(const TResponse& response) {
+    EXPECT_EQ(response.ContentType, "text/plain");
+    EXPECT_NE(response.Body.find("# TYPE test_gauge gauge"), TString::npos) << response.Body;
+    EXPECT_NE(response.Body.find("test_gauge{"), TString::npos) << response.Body;
+    EXPECT_NE(response.Body.find("} 42"), TString::npos) << response.Body;
+}
+
+} // namespace
+
+TEST_F(TPullExtensionTest, StatsDefaultToJson) {
+    auto response = Get("/stats");
+    EXPECT_EQ(response.ContentType, "application/json");
+    EXPECT_NE(response.Body.find("\"test_gauge\""), TString::npos) << response.Body;
+
+    // Formats the page does not serve fall back to JSON too
+    response = Get("/stats", "application/x-solomon-txt");
+    EXPECT_EQ(response.ContentType, "application/json");
+}
+
+TEST_F(TPullExtensionTest, StatsNegotiateFormat) {
+    ExpectPrometheus(Get("/stats", "text/plain"));
+
+    const auto spack = Get("/stats", "application/x-solomon-spack, application/json;q=0.5");
+    EXPECT_EQ(spack.ContentType, "application/x-solomon-spack");
+    ASSERT_GE(spack.Body.size(), 2u);
+    EXPECT_EQ(spack.Body.substr(0, 2), "SP");
+
+    // Each format has its own cached encoding
+    EXPECT_EQ(Get("/stats", "application/json").ContentType, "application/json");
+    ExpectPrometheus(Get("/stats", "text/plain"));
+}
+
+TEST_F(TPullExtensionTest, MetricsAreAlwaysPrometheus) {
+    ExpectPrometheus(Get("/metrics"));
+    ExpectPrometheus(Get("/metrics", "application/json"));
+    ExpectPrometheus(Get("/metrics", "application/x-solomon-spack"));
+}
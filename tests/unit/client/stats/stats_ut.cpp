@@ -0,0 +1,273 @@
+#include <src/client/impl/ydb_stats/stats.h>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace NYdb;
+using namespace NYdb::NSdkStats;
+
+namespace {
+
+const std::string Database = "/Root/Test";
+
+::NMonitoring::THistogram* GetPhaseHistogram(::NMonitoring::TMetricRegistry& registry, const std::string& sensor) {
+    // Returns the already registered histogram, the collector is ignored in that case
+    return registry.HistogramRate({ {"database", Database}, {"sensor", sensor} },
+        ::NMonitoring::ExponentialHistogram(25, 2, 1));
+}
+
+ui64 GetTotalCount(::NMonitoring::THistogram* histogram) {
+    auto snapshot = histogram->TakeSnapshot();
+    ui64 count = 0;
+    for (ui32 i = 0; i < snapshot->Count(); ++i) {
+        count += snapshot->Value(i);
+    }
+    return count;
+}
+
+ui64 GetBucketWithValue(::NMonitoring::THistogram* histogram) {
+    auto snapshot = histogram->TakeSnapshot();
+    for (ui32 i = 0; i < snapshot->Count(); ++i) {
+        if (snapshot->Value(i)) {
+            return snapshot->UpperBound(i);
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+TEST(RequestPhases, DisabledByDefault) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector collector(Database, &registry);
+
+    EXPECT_TRUE(collector.IsCollecting());
+    EXPECT_FALSE(collector.IsCollectingRequestPhases());
+
+    TStatCollector::TSessionPoolStatCollector sessionPool = collector.GetSessionPoolStatCollector("Table");
+    EXPECT_EQ(sessionPool.AcquireLatency, nullptr);
+}
+
+TEST(RequestPhases, NoRegistry) {
+    TStatCollector collector(Database, nullptr, true);
+
+    EXPECT_FALSE(collector.IsCollectingRequestPhases());
+
+    // Must be a no-op without histograms
+    TRequestPhaseTimestamps timestamps;
+    timestamps.Start = TInstant::MilliSeconds(1);
+    timestamps.Admitted = TInstant::MilliSeconds(2);
+    collector.RecordRequestPhases(timestamps, TInstant::Zero(), TInstant::Zero());
+}
+
+TEST(RequestPhases, RecordsEveryPhase) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector collector(Database, &registry, true);
+    ASSERT_TRUE(collector.IsCollectingRequestPhases());
+
+    const auto start = TInstant::Seconds(100);
+    TRequestPhaseTimestamps timestamps;
+    timestamps.Start = start;
+    timestamps.Admitted = start + TDuration::MicroSeconds(3);
+    timestamps.Sent = start + TDuration::MicroSeconds(10);
+    timestamps.Received = start + TDuration::MicroSeconds(1010);
+    const auto callbackStart = start + TDuration::MicroSeconds(1100);
+    const auto callbackEnd = start + TDuration::MicroSeconds(1130);
+
+    collector.RecordRequestPhases(timestamps, callbackStart, callbackEnd);
+
+    struct TExpected {
+        std::string Sensor;
+        ui64 Bound;
+    };
+    const std::vector<TExpected> expected = {
+        {"Request/Phase/Admission", 4},        // 3us
+        {"Request/Phase/Credentials", 8},      // 7us
+        {"Request/Phase/Transport", 1024},     // 1000us
+        {"Request/Phase/ResponseQueue", 128},  // 90us
+        {"Request/Phase/Callback", 32},        // 30us
+    };
+    for (const auto& [sensor, bound] : expected) {
+        auto* histogram = GetPhaseHistogram(registry, sensor);
+        EXPECT_EQ(GetTotalCount(histogram), 1u) << sensor;
+        EXPECT_EQ(GetBucketWithValue(histogram), bound) << sensor;
+    }
+}
+
+TEST(RequestPhases, SkipsPhasesWithoutBounds) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector collector(Database, &registry, true);
+
+    // Request failed before an endpoint was chosen
+    TRequestPhaseTimestamps timestamps;
+    timestamps.Start = TInstant::Seconds(100);
+    timestamps.Admitted = TInstant::Seconds(101);
+
+    collector.RecordRequestPhases(timestamps, TInstant::Seconds(101), TInstant::Seconds(102));
+
+    EXPECT_EQ(GetTotalCount(GetPhaseHistogram(registry, "Request/Phase/Admission")), 1u);
+    EXPECT_EQ(GetTotalCount(GetPhaseHistogram(registry, "Request/Phase/Credentials")), 0u);
+    EXPECT_EQ(GetTotalCount(GetPhaseHistogram(registry, "Request/Phase/Transport")), 0u);
+    EXPECT_EQ(GetTotalCount(GetPhaseHistogram(registry, "Request/Phase/ResponseQueue")), 0u);
+    EXPECT_EQ(GetTotalCount(GetPhaseHistogram(registry, "Request/Phase/Callback")), 1u);
+}
+
+TEST(RequestPhases, SessionAcquireHistogram) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector collector(Database, &registry, true);
+
+    TStatCollector::TSessionPoolStatCollector sessionPool = collector.GetSessionPoolStatCollector("Query");
+    ASSERT_NE(sessionPool.AcquireLatency, nullptr);
+
+    auto* histogram = registry.HistogramRate(
+        { {"database", Database}, {"ydb_client", "Query"}, {"sensor", "Request/Phase/SessionAcquire"} },
+        ::NMonitoring::ExponentialHistogram(25, 2, 1));
+    EXPECT_EQ(histogram, sessionPool.AcquireLatency);
+}
+
+TEST(ShardedStats, CounterSumsAllThreads) {
+    TShardedCounter counter;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&counter]() {
+            for (size_t j = 0; j < 1000; ++j) {
+                counter.Inc();
+            }
+            counter.Add(10);
+            counter.Dec();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.Get(), 8 * (1000 + 10 - 1));
+}
+
+TEST(ShardedStats, HistogramMatchesRegularCollector) {
+    auto regular = ::NMonitoring::ExponentialHistogram(20, 2, 32);
+    auto sharded = ShardedExponentialHistogram(20, 2, 32)();
+
+    const std::vector<double> values = {0, 1, 32, 33, 100, 1000, 4096, 1e9};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&sharded, &values]() {
+            for (double value : values) {
+                sharded->Collect(value, 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (double value : values) {
+        regular->Collect(value, 8);
+    }
+
+    auto expected = regular->Snapshot();
+    auto actual = sharded->Snapshot();
+    ASSERT_EQ(actual->Count(), expected->Count());
+    for (ui32 i = 0; i < expected->Count(); ++i) {
+        EXPECT_EQ(actual->UpperBound(i), expected->UpperBound(i)) << i;
+        EXPECT_EQ(actual->Value(i), expected->Value(i)) << i;
+    }
+
+    sharded->Reset();
+    EXPECT_EQ(sharded->Snapshot()->Value(0), 0u);
+}
+
+TEST(ShardedStats, SameLabelsShareCounter) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector first(Database, &registry);
+    TStatCollector second(Database, &registry);
+
+    first.IncGRpcInFlight();
+    first.IncGRpcInFlight();
+    second.IncGRpcInFlight();
+    second.DecGRpcInFlight();
+
+    auto* counter = ShardedIntGauge(registry, { {"database", Database}, {"sensor", "Grpc/InFlight"} });
+    EXPECT_EQ(counter->Get(), 2);
+
+    // The lazy gauge registered by the collectors reads the same shards
+    auto* gauge = registry.LazyIntGauge({ {"database", Database}, {"sensor", "Grpc/InFlight"} }, []() { return i64(0); });
+    EXPECT_EQ(gauge->Get(), 2);
+}
+
+TEST(ShardedStats, CountersAreFreedWithRegistry) {
+    const ::NMonitoring::TLabels labels = { {"database", Database}, {"sensor", "Request/Bytes"} };
+
+    // The second registry is created at the address of the first one
+    std::optional<::NMonitoring::TMetricRegistry> registry;
+    registry.emplace();
+    auto* counter = ShardedRate(*registry, labels);
+    counter->Add(5);
+    auto counterCopy = ShardedRate(*registry, labels);
+    EXPECT_EQ(counterCopy, counter);
+
+    registry.reset();
+    registry.emplace();
+    auto* freshCounter = ShardedRate(*registry, labels);
+    EXPECT_EQ(freshCounter->Get(), 0);
+
+    auto* rate = registry->LazyRate(labels, []() { return ui64(0); });
+    freshCounter->Add(2);
+    EXPECT_EQ(rate->Get(), 2u);
+}
+
+TEST(LatencyQuantiles, InterpolatesInsideBucket) {
+    const std::vector<::NMonitoring::TBucketBound> bounds = {10, 20, 40, ::NMonitoring::HISTOGRAM_INF_BOUND};
+
+    EXPECT_EQ(GetHistogramQuantile(bounds, {0, 0, 0, 0}, 0.5), 0);
+    EXPECT_DOUBLE_EQ(GetHistogramQuantile(bounds, {0, 10, 0, 0}, 0.5), 15);
+    EXPECT_DOUBLE_EQ(GetHistogramQuantile(bounds, {50, 40, 10, 0}, 0.5), 10);
+    EXPECT_DOUBLE_EQ(GetHistogramQuantile(bounds, {50, 40, 10, 0}, 0.99), 38);
+    // Values above the last finite bound are reported as the bound
+    EXPECT_DOUBLE_EQ(GetHistogramQuantile(bounds, {0, 0, 0, 5}, 0.999), 40);
+}
+
+TEST(LatencyQuantiles, LogLinearBounds) {
+    auto snapshot = ShardedLogLinearHistogram(3, 2, 8)()->Snapshot();
+
+    const std::vector<::NMonitoring::TBucketBound> expected = {8, 12, 16, 24, 32, 48, 64, ::NMonitoring::HISTOGRAM_INF_BOUND};
+    ASSERT_EQ(snapshot->Count(), expected.size());
+    for (ui32 i = 0; i < snapshot->Count(); ++i) {
+        EXPECT_EQ(snapshot->UpperBound(i), expected[i]) << i;
+    }
+}
+
+TEST(LatencyQuantiles, ReportsLastWindow) {
+    ::NMonitoring::TMetricRegistry registry;
+    TStatCollector collector(Database, &registry);
+
+    auto* histogram = registry.HistogramRate({ {"database", Database}, {"sensor", "Request/LatencyUs"} },
+        ::NMonitoring::ExponentialHistogram(2, 2, 1));
+    TWindowedQuantiles quantiles(histogram);
+
+    for (size_t i = 0; i < 100; ++i) {
+        collector.IncRequestLatency(TDuration::MicroSeconds(100));
+    }
+    const auto now = TInstant::Seconds(100);
+    const double first = quantiles.Get(0.5, now);
+    EXPECT_GT(first, 64);
+    EXPECT_LE(first, 128);
+
+    // Cached within the refresh interval
+    for (size_t i = 0; i < 100; ++i) {
+        collector.IncRequestLatency(TDuration::MilliSeconds(10));
+    }
+    EXPECT_EQ(quantiles.Get(0.5, now + TDuration::MilliSeconds(10)), first);
+
+    // Only the requests since the previous refresh
+    const double second = quantiles.Get(0.5, now + TWindowedQuantiles::RefreshInterval);
+    EXPECT_GT(second, 8192);
+    EXPECT_LE(second, 12288);
+
+    auto* p99 = registry.LazyGauge({ {"database", Database}, {"sensor", "Request/LatencyUs/Quantile"}, {"quantile", "0.99"} },
+        []() { return 0.0; });
+    EXPECT_NE(p99, nullptr);
+}
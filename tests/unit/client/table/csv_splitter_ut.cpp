@@ -0,0 +1,290 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/table/csv_upsert.h>
+
+#include <src/client/table/impl/csv_splitter.h>
+
+#include <util/stream/mem.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+
+using namespace NYdb;
+using namespace NYdb::NTable;
+
+namespace {
+
+Ydb::Formats::CsvSettings MakeCsvSettings(bool quoting = true) {
+    Ydb::Formats::CsvSettings settings;
+    settings.mutable_quoting()->set_disabled(!quoting);
+    return settings;
+}
+
+// Positions after unquoted line breaks, found char by char
+std::set<size_t> ReferenceRowEnds(std::string_view data, bool quoting) {
+    std::set<size_t> ends;
+    bool inQuotes = false;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (quoting && data[i] == '"') {
+            inQuotes = !inQuotes;
+        } else if (data[i] == '\n' && !inQuotes) {
+            ends.insert(i + 1);
+        }
+    }
+    return ends;
+}
+
+// Rows with plain fields, quoted line breaks and doubled quotes
+std::string MakeCsv(std::mt19937_64& random, size_t rows, bool trailingNewline = true) {
+    std::string data;
+    for (size_t row = 0; row < rows; ++row) {
+        const size_t fields = 1 + random() % 4;
+        for (size_t field = 0; field < fields; ++field) {
+            if (field) {
+                data += ',';
+            }
+            switch (random() % 4) {
+                case 0:
+                    data += "value" + std::to_string(random() % 1000);
+                    break;
+                case 1:
+                    data += "\"multi\nline\n\"";
+                    break;
+                case 2:
+                    data += "\"say \"\"hi\"\"\"";
+                    break;
+                default:
+                    break;
+            }
+        }
+        data += '\n';
+    }
+    if (!trailingNewline && !data.empty()) {
+        data.pop_back();
+    }
+    return data;
+}
+
+// Chunks must cover the data and end at unquoted row ends, except the end of data
+void CheckCuts(std::string_view data, const std::vector<size_t>& cuts, bool quoting) {
+    ASSERT_FALSE(cuts.empty());
+    ASSERT_EQ(cuts.back(), data.size());
+
+    const auto rowEnds = ReferenceRowEnds(data, quoting);
+    std::string joined;
+    size_t begin = 0;
+    for (size_t i = 0; i < cuts.size(); ++i) {
+        ASSERT_LE(begin, cuts[i]);
+        if (i + 1 < cuts.size()) {
+            ASSERT_TRUE(rowEnds.contains(cuts[i])) << "cut " << cuts[i] << " is not a row end";
+        }
+        joined += data.substr(begin, cuts[i] - begin);
+        begin = cuts[i];
+    }
+    ASSERT_EQ(joined, data);
+}
+
+std::vector<std::string> ReadStream(const std::string& input, const Ydb::Formats::CsvSettings& settings,
+    uint64_t chunkSize, std::string* header = nullptr)
+{
+    TMemoryInput stream(input.data(), input.size());
+    const TCsvFormat format(settings);
+    TCsvStreamSplitter splitter(stream, settings, format, chunkSize);
+    if (header) {
+        *header = splitter.GetHeader();
+    }
+
+    std::vector<std::string> chunks;
+    std::string_view chunk;
+    while (splitter.Next(chunk)) {
+        chunks.emplace_back(chunk);
+    }
+    return chunks;
+}
+
+void CheckChunks(std::string_view body, const std::vector<std::string>& chunks, uint64_t chunkSize, bool quoting) {
+    std::vector<size_t> cuts;
+    size_t end = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        ASSERT_FALSE(chunks[i].empty());
+        if (i + 1 < chunks.size()) {
+            ASSERT_GE(chunks[i].size(), chunkSize);
+        }
+        end += chunks[i].size();
+        cuts.push_back(end);
+    }
+    if (cuts.empty()) {
+        cuts.push_back(0);
+    }
+    CheckCuts(body, cuts, quoting);
+}
+
+} // namespace
+
+TEST(CsvSplitter, FindRowEnd) {
+    const TCsvFormat format(MakeCsvSettings());
+    const std::string data = "a,\"b\nc\",\"d\"\"\ne\"\nf\n";
+
+    bool inQuotes = false;
+    const size_t first = format.FindRowEnd(data, 0, inQuotes);
+    ASSERT_EQ(first, data.find("f"));
+    ASSERT_FALSE(inQuotes);
+    ASSERT_EQ(format.FindRowEnd(data, first, inQuotes), data.size());
+
+    // Search from inside a quoted field
+    inQuotes = true;
+    ASSERT_EQ(format.FindRowEnd(data, data.find("c"), inQuotes), data.find("f"));
+
+    // No row end, the state at the end of data is kept
+    inQuotes = false;
+    ASSERT_EQ(format.FindRowEnd("x,\"y\nz", 0, inQuotes), std::string::npos);
+    ASSERT_TRUE(inQuotes);
+
+    // Quotes are plain characters without quoting
+    const TCsvFormat plain(MakeCsvSettings(false));
+    inQuotes = false;
+    ASSERT_EQ(plain.FindRowEnd(data, 0, inQuotes), data.find("c"));
+    ASSERT_FALSE(plain.ChangesQuoteState("\""));
+}
+
+TEST(CsvSplitter, CountRows) {
+    const TCsvFormat format(MakeCsvSettings());
+    ASSERT_EQ(format.CountRows(""), 0u);
+    ASSERT_EQ(format.CountRows("a\n\"b\nc\"\n"), 2u);
+    ASSERT_EQ(format.CountRows("a\nb"), 2u);
+}
+
+TEST(CsvSplitter, SplitRowsAcrossRegionsAndChunks) {
+    std::mt19937_64 random(1);
+    for (bool trailingNewline : {true, false}) {
+        const auto data = MakeCsv(random, 500, trailingNewline);
+        const TCsvFormat format(MakeCsvSettings());
+        for (uint64_t chunkSize : {1, 7, 64, 1000}) {
+            for (uint32_t threads : {1, 3, 8}) {
+                SCOPED_TRACE(testing::Message() << "chunk " << chunkSize << " threads " << threads);
+                const auto cuts = SplitCsvRows(data, format, chunkSize, threads);
+                CheckCuts(data, cuts, true);
+                ASSERT_GT(cuts.size(), 1u);
+            }
+        }
+    }
+}
+
+TEST(CsvSplitter, SplitRowsSmallData) {
+    const TCsvFormat format(MakeCsvSettings());
+
+    // Regions are smaller than a chunk
+    const std::string data = "a,\"b\nc\"\nd\n";
+    ASSERT_EQ(SplitCsvRows(data, format, 1 << 20, 8), std::vector<size_t>{data.size()});
+
+    // Empty body
+    ASSERT_EQ(SplitCsvRows("", format, 16, 4), std::vector<size_t>{0});
+
+    // A single row longer than a chunk is not split
+    const std::string longRow = "\"" + std::string(100, '\n') + "\"\n";
+    ASSERT_EQ(SplitCsvRows(longRow, format, 10, 4), std::vector<size_t>{longRow.size()});
+}
+
+TEST(CsvSplitter, SplitRowsWithoutQuoting) {
+    std::mt19937_64 random(2);
+    const auto data = MakeCsv(random, 200);
+    const TCsvFormat format(MakeCsvSettings(false));
+    CheckCuts(data, SplitCsvRows(data, format, 16, 4), false);
+}
+
+TEST(CsvSplitter, Preamble) {
+    auto settings = MakeCsvSettings();
+    const TCsvFormat format(settings);
+    std::string header;
+
+    // Nothing to skip
+    ASSERT_EQ(ParseCsvPreamble("a\n", settings, format, header), 0u);
+
+    settings.set_skip_rows(2);
+    settings.set_header(true);
+    const std::string data = "skip \"1\nskip 2\n\"id\nx\",name\n1,a\n";
+    const auto bodyStart = ParseCsvPreamble(data, settings, format, header);
+    ASSERT_EQ(bodyStart, data.find("1,a"));
+    ASSERT_EQ(header, "\"id\nx\",name\n");
+
+    // Header only, with and without the line break
+    ASSERT_EQ(ParseCsvPreamble("s\ns\nid\n", settings, format, header), 7u);
+    ASSERT_EQ(ParseCsvPreamble("s\ns\nid", settings, format, header), std::nullopt);
+    ASSERT_EQ(ParseCsvPreamble("s\n", settings, format, header), std::nullopt);
+}
+
+TEST(CsvSplitter, StreamCarriesIncompleteRows) {
+    std::mt19937_64 random(3);
+    for (bool trailingNewline : {true, false}) {
+        const auto data = MakeCsv(random, 300, trailingNewline);
+        for (uint64_t chunkSize : {1, 5, 33, 256, 1 << 20}) {
+            SCOPED_TRACE(testing::Message() << "chunk " << chunkSize);
+            CheckChunks(data, ReadStream(data, MakeCsvSettings(), chunkSize), chunkSize, true);
+            CheckChunks(data, ReadStream(data, MakeCsvSettings(false), chunkSize), chunkSize, false);
+        }
+    }
+}
+
+TEST(CsvSplitter, StreamPreamble) {
+    auto settings = MakeCsvSettings();
+    settings.set_skip_rows(1);
+    settings.set_header(true);
+
+    std::mt19937_64 random(4);
+    const auto body = MakeCsv(random, 100);
+    const std::string preamble = "# comment\n\"id\n2\",name\n";
+    for (uint64_t chunkSize : {1, 4, 64}) {
+        std::string header;
+        const auto chunks = ReadStream(preamble + body, settings, chunkSize, &header);
+        ASSERT_EQ(header, "\"id\n2\",name\n");
+        CheckChunks(body, chunks, chunkSize, true);
+    }
+
+    // Header only and empty input have no rows
+    std::string header;
+    ASSERT_TRUE(ReadStream(preamble, settings, 4, &header).empty());
+    ASSERT_EQ(header, "\"id\n2\",name\n");
+    ASSERT_TRUE(ReadStream("", settings, 4).empty());
+}
+
+TEST(CsvUpsert, File) {
+    NTests::TFakeServer server;
+    TDriver driver(TDriverConfig()
+        .SetEndpoint(server.GetEndpoint())
+        .SetDatabase(server.GetDatabase()));
+    TTableClient client(driver);
+
+    Ydb::Formats::CsvSettings csvSettings;
+    csvSettings.set_header(true);
+    const auto settings = TCsvUpsertSettings()
+        .ChunkSize(64)
+        .BulkUpsertSettings(TBulkUpsertSettings().FormatSettings(csvSettings.SerializeAsString()));
+
+    const auto path = (std::filesystem::temp_directory_path() / "csv_upsert_ut.csv").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "id,name\n";
+        for (int i = 0; i < 100; ++i) {
+            file << i << ",name" << i << '\n';
+        }
+    }
+
+    auto result = BulkUpsertCsvFile(client, "/Root/Fake/table", path, settings);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(result.IsSuccess()) << result.GetIssues().ToString();
+    ASSERT_EQ(result.GetProgress().Rows, 100u);
+    ASSERT_GT(result.GetProgress().Requests, 1u);
+    ASSERT_EQ(server.GetStats().UpsertedRows, 100u);
+
+    // A file that can't be mapped fails the upsert instead of throwing
+    auto missing = BulkUpsertCsvFile(client, "/Root/Fake/table", path + ".missing", settings);
+    ASSERT_EQ(missing.GetStatus(), EStatus::BAD_REQUEST);
+    ASSERT_EQ(missing.GetProgress().Requests, 0u);
+
+    driver.Stop(true);
+}
@@ -0,0 +1,132 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/result/result.h>
+#include <ydb-cpp-sdk/client/table/table.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+
+using namespace NYdb;
+using namespace NYdb::NTable;
+
+namespace {
+
+constexpr std::uint64_t ROWS_PER_PART = 10;
+constexpr std::uint64_t PARTS_PER_SHARD = 5;
+
+// Reads the fake table and counts deliveries of every id
+std::map<std::uint64_t, int> ReadAll(const NTests::TFakeServerSettings& serverSettings,
+    const TParallelReadTableSettings& settings, TStatus* error = nullptr)
+{
+    NTests::TFakeServer server(serverSettings
+        .ResultRows(ROWS_PER_PART)
+        .ResultParts(PARTS_PER_SHARD));
+    TDriver driver(TDriverConfig()
+        .SetEndpoint(server.GetEndpoint())
+        .SetDatabase(server.GetDatabase()));
+    TTableClient client(driver);
+
+    std::map<std::uint64_t, int> ids;
+    auto iterator = client.ReadTableParallel("/Root/Fake/table", settings).GetValueSync();
+    if (!iterator.IsSuccess()) {
+        if (error) {
+            *error = iterator;
+        }
+        driver.Stop(true);
+        return ids;
+    }
+
+    std::optional<std::uint64_t> lastId;
+    for (;;) {
+        auto part = iterator.ReadNext().GetValueSync();
+        if (part.EOS()) {
+            break;
+        }
+        if (!part.IsSuccess()) {
+            if (error) {
+                *error = part;
+            }
+            break;
+        }
+
+        TResultSetParser parser(part.GetPart());
+        while (parser.TryNextRow()) {
+            const auto id = parser.ColumnParser("id").GetUint64();
+            if (settings.ReadTableSettings_.Ordered_) {
+                EXPECT_TRUE(!lastId || *lastId < id) << id;
+                lastId = id;
+            }
+            ++ids[id];
+        }
+    }
+    driver.Stop(true);
+    return ids;
+}
+
+void CheckExactlyOnce(const std::map<std::uint64_t, int>& ids, std::uint64_t shards) {
+    const auto step = std::numeric_limits<std::uint64_t>::max() / shards;
+    ASSERT_EQ(ids.size(), shards * ROWS_PER_PART * PARTS_PER_SHARD);
+    for (std::uint64_t shard = 0; shard < shards; ++shard) {
+        for (std::uint64_t i = 0; i < ROWS_PER_PART * PARTS_PER_SHARD; ++i) {
+            const auto it = ids.find(shard * step + i);
+            ASSERT_NE(it, ids.end()) << "shard " << shard << " row " << i;
+            ASSERT_EQ(it->second, 1) << "shard " << shard << " row " << i;
+        }
+    }
+}
+
+} // namespace
+
+TEST(ParallelReadTable, SingleShard) {
+    auto ids = ReadAll(NTests::TFakeServerSettings().TableShards(1), TParallelReadTableSettings());
+    CheckExactlyOnce(ids, 1);
+}
+
+TEST(ParallelReadTable, ManyShards) {
+    for (std::uint32_t streams : {1, 3, 16}) {
+        auto ids = ReadAll(NTests::TFakeServerSettings().TableShards(7),
+            TParallelReadTableSettings().MaxStreams(streams));
+        CheckExactlyOnce(ids, 7);
+    }
+}
+
+TEST(ParallelReadTable, Ordered) {
+    auto ids = ReadAll(NTests::TFakeServerSettings().TableShards(5),
+        TParallelReadTableSettings()
+            .ReadTableSettings(TReadTableSettings().Ordered())
+            .MaxStreams(3)
+            .MaxBufferedParts(1));
+    CheckExactlyOnce(ids, 5);
+}
+
+TEST(ParallelReadTable, ResumesBrokenStreams) {
+    // Streams break off before some of the parts and are resumed after the last received key
+    auto ids = ReadAll(NTests::TFakeServerSettings()
+            .TableShards(4)
+            .ErrorRate(0.1)
+            .ErrorStatus(EStatus::UNAVAILABLE),
+        TParallelReadTableSettings()
+            .ReadTableSettings(TReadTableSettings().Ordered())
+            .RetrySettings(TRetryOperationSettings()
+                .MaxRetries(100)
+                .FastBackoffSettings(TBackoffSettings().SlotDuration(TDuration::MilliSeconds(1)))));
+    CheckExactlyOnce(ids, 4);
+}
+
+TEST(ParallelReadTable, FailsWhenRetriesAreExhausted) {
+    TStatus error(EStatus::SUCCESS, {});
+    auto ids = ReadAll(NTests::TFakeServerSettings()
+            .TableShards(2)
+            .ErrorRate(1.0)
+            .ErrorStatus(EStatus::UNAVAILABLE),
+        TParallelReadTableSettings()
+            .RetrySettings(TRetryOperationSettings()
+                .MaxRetries(2)
+                .FastBackoffSettings(TBackoffSettings().SlotDuration(TDuration::MilliSeconds(1)))),
+        &error);
+    ASSERT_TRUE(ids.empty());
+    ASSERT_EQ(error.GetStatus(), EStatus::UNAVAILABLE);
+}
@@ -0,0 +1,177 @@
+#define INCLUDE_YDB_INTERNAL_H
+#include <src/client/impl/ydb_internal/thread_pool/pool.h>
+#undef INCLUDE_YDB_INTERNAL_H
+
+#include <util/system/event.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using namespace NYdb;
+
+namespace {
+
+class TRecordingTask : public IObjectInQueue {
+public:
+    TRecordingTask(ERequestPriority priority, std::mutex& lock, std::vector<ERequestPriority>& order,
+        TManualEvent* wait = nullptr, TManualEvent* started = nullptr)
+        : Priority_(priority)
+        , Lock_(lock)
+        , Order_(order)
+        , Wait_(wait)
+        , Started_(started)
+    { }
+
+    void Process(void*) override {
+        if (Started_) {
+            Started_->Signal();
+        }
+        if (Wait_) {
+            Wait_->WaitI();
+        }
+        {
+            std::lock_guard guard(Lock_);
+            Order_.push_back(Priority_);
+        }
+        delete this;
+    }
+
+private:
+    ERequestPriority Priority_;
+    std::mutex& Lock_;
+    std::vector<ERequestPriority>& Order_;
+    TManualEvent* Wait_;
+    TManualEvent* Started_;
+};
+
+// Pool whose drain tasks are run by the test. Rejected Add runs OnReject first,
+// as if a worker had run concurrently with the caller.
+class TManualPool : public IThreadPool {
+public:
+    bool Add(IObjectInQueue* obj) override {
+        if (Reject) {
+            if (OnReject) {
+                OnReject();
+            }
+            return false;
+        }
+        Tasks.push_back(obj);
+        return true;
+    }
+
+    void Start(size_t, size_t = 0) override {
+    }
+
+    void Stop() noexcept override {
+    }
+
+    size_t Size() const noexcept override {
+        return Tasks.size();
+    }
+
+    void RunOne() {
+        auto* task = Tasks.front();
+        Tasks.pop_front();
+        task->Process(nullptr);
+    }
+
+    bool Reject = false;
+    std::function<void()> OnReject;
+    std::deque<IObjectInQueue*> Tasks;
+};
+
+} // namespace
+
+TEST(PriorityThreadPool, WeightedFairDispatch) {
+    TPriorityThreadPool pool(NYdb::CreateThreadPool(1), {3, 1, 1});
+    pool.Start(1, 0);
+
+    std::mutex lock;
+    std::vector<ERequestPriority> order;
+    TManualEvent release;
+
+    // Occupy the only thread while the queues are filled
+    TManualEvent started;
+    ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Interactive, lock, order, &release, &started), ERequestPriority::Interactive));
+    started.WaitI();
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Background, lock, order), ERequestPriority::Background));
+    }
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Interactive, lock, order), ERequestPriority::Interactive));
+    }
+
+    release.Signal();
+    pool.Stop();
+
+    ASSERT_EQ(order.size(), 17u);
+
+    // Background objects were queued first, but interactive ones get three turns of four
+    size_t interactive = 0;
+    for (size_t i = 1; i <= 8; ++i) {
+        if (order[i] == ERequestPriority::Interactive) {
+            ++interactive;
+        }
+    }
+    ASSERT_EQ(interactive, 6u);
+
+    // And background class is not starved
+    ASSERT_EQ(order.back(), ERequestPriority::Background);
+}
+
+TEST(PriorityThreadPool, SingleClassKeepsFifoOrder) {
+    TPriorityThreadPool pool(NYdb::CreateThreadPool(1), {8, 2, 1});
+    pool.Start(1, 0);
+
+    std::mutex lock;
+    std::vector<ERequestPriority> order;
+    TManualEvent release;
+
+    TManualEvent started;
+    ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Batch, lock, order, &release, &started), ERequestPriority::Batch));
+    started.WaitI();
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Batch, lock, order), ERequestPriority::Batch));
+    }
+    EXPECT_EQ(pool.Size(ERequestPriority::Batch), 4u);
+
+    release.Signal();
+    pool.Stop();
+
+    ASSERT_EQ(order.size(), 5u);
+    EXPECT_EQ(pool.Size(ERequestPriority::Batch), 0u);
+}
+
+TEST(PriorityThreadPool, RejectedAddDoesNotStrandOtherObjects) {
+    auto manualPool = std::make_unique<TManualPool>();
+    auto* manual = manualPool.get();
+    TPriorityThreadPool pool(std::move(manualPool), {8, 2, 1});
+
+    std::mutex lock;
+    std::vector<ERequestPriority> order;
+
+    ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Background, lock, order), ERequestPriority::Background));
+    ASSERT_EQ(manual->Tasks.size(), 1u);
+
+    // The drain task of the background object takes the interactive one while its own task is rejected
+    manual->Reject = true;
+    manual->OnReject = [manual]() {
+        manual->RunOne();
+    };
+    ASSERT_TRUE(pool.Add(new TRecordingTask(ERequestPriority::Interactive, lock, order), ERequestPriority::Interactive));
+
+    // The background object is not left in the queue without a drain task
+    ASSERT_EQ(order, (std::vector<ERequestPriority>{ERequestPriority::Interactive, ERequestPriority::Background}));
+    ASSERT_EQ(pool.Size(ERequestPriority::Background), 0u);
+
+    // Without a concurrent drain task the rejected object is returned to the caller
+    manual->OnReject = nullptr;
+    auto* task = new TRecordingTask(ERequestPriority::Batch, lock, order);
+    ASSERT_FALSE(pool.Add(task, ERequestPriority::Batch));
+    ASSERT_EQ(pool.Size(ERequestPriority::Batch), 0u);
+    delete task;
+}
@@ -0,0 +1,111 @@
+#include <ydb-cpp-sdk/client/topic/async_event_stream.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+
+using namespace NYdb;
+using namespace NYdb::NTopic;
+
+namespace {
+
+// Session with the WaitEvent()/GetEvent() contract of the topic sessions
+class TFakeSession {
+public:
+    using TEvent = std::variant<int, TSessionClosedEvent>;
+
+    std::optional<TEvent> GetEvent(bool) {
+        if (Events_.empty()) {
+            return std::nullopt;
+        }
+        auto event = std::move(Events_.front());
+        Events_.pop_front();
+        return event;
+    }
+
+    NThreading::TFuture<void> WaitEvent() {
+        ++WaitCalls;
+        if (!Events_.empty()) {
+            return NThreading::MakeFuture();
+        }
+        if (ReadyWithoutEvents) {
+            // Another reader took the event after the future had become ready
+            --ReadyWithoutEvents;
+            return NThreading::MakeFuture();
+        }
+        return Waiter_.GetFuture();
+    }
+
+    void Push(TEvent event) {
+        Events_.push_back(std::move(event));
+        Wake();
+    }
+
+    void Wake() {
+        std::exchange(Waiter_, NThreading::NewPromise<void>()).SetValue();
+    }
+
+    size_t ReadyWithoutEvents = 0;
+    size_t WaitCalls = 0;
+
+private:
+    std::deque<TEvent> Events_;
+    NThreading::TPromise<void> Waiter_ = NThreading::NewPromise<void>();
+};
+
+NThreading::TFuture<void> Consume(std::shared_ptr<TFakeSession> session, std::vector<int>& values, bool& closed) {
+    auto events = MakeAsyncEventStream(session);
+    while (auto event = co_await events.Next()) {
+        if (auto* value = std::get_if<int>(&*event)) {
+            values.push_back(*value);
+        } else {
+            closed = true;
+        }
+    }
+    EXPECT_TRUE(events.IsFinished());
+    EXPECT_FALSE((co_await events.Next()).has_value());
+}
+
+} // namespace
+
+TEST(AsyncEventStream, YieldsEventsUntilSessionIsClosed) {
+    auto session = std::make_shared<TFakeSession>();
+    std::vector<int> values;
+    bool closed = false;
+
+    session->Push(1);
+    session->Push(2);
+    auto done = Consume(session, values, closed);
+    ASSERT_EQ(values, std::vector<int>({1, 2}));
+
+    session->Push(3);
+    ASSERT_EQ(values, std::vector<int>({1, 2, 3}));
+    ASSERT_FALSE(done.HasValue());
+
+    session->Push(TSessionClosedEvent(EStatus::SUCCESS, {}));
+    ASSERT_TRUE(done.HasValue());
+    ASSERT_TRUE(closed);
+}
+
+TEST(AsyncEventStream, WaitsAgainWhenEventIsTaken) {
+    auto session = std::make_shared<TFakeSession>();
+    std::vector<int> values;
+    bool closed = false;
+
+    // Deep enough to overflow the stack if every retry subscribed recursively
+    session->ReadyWithoutEvents = 1'000'000;
+    auto done = Consume(session, values, closed);
+    ASSERT_TRUE(values.empty());
+    ASSERT_GT(session->WaitCalls, 1'000'000u);
+
+    // Woken up without an event, then ready futures without events again
+    session->ReadyWithoutEvents = 1'000'000;
+    session->Wake();
+    ASSERT_TRUE(values.empty());
+
+    session->Push(1);
+    session->Push(TSessionClosedEvent(EStatus::SUCCESS, {}));
+    ASSERT_TRUE(done.HasValue());
+    ASSERT_EQ(values, std::vector<int>({1}));
+    ASSERT_TRUE(closed);
+}
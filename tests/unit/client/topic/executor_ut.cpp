@@ -0,0 +1,42 @@
+#include <src/client/topic/common/executor_impl.h>
+
+#include <gtest/gtest.h>
+
+#include <library/cpp/threading/future/future.h>
+
+using namespace NYdb::NTopic;
+
+TEST(SerialExecutor, PreservesOrder) {
+    auto threadPool = CreateThreadPoolExecutor(4);
+    threadPool->Start();
+
+    constexpr size_t serialExecutorsCount = 4;
+    constexpr size_t tasksCount = 1000;
+
+    std::vector<IExecutor::TPtr> serialExecutors;
+    std::vector<std::vector<size_t>> results(serialExecutorsCount);
+    std::vector<NThreading::TPromise<void>> done;
+    for (size_t i = 0; i < serialExecutorsCount; ++i) {
+        serialExecutors.push_back(MakeIntrusive<TSerialExecutor>(threadPool));
+        done.push_back(NThreading::NewPromise<void>());
+    }
+
+    for (size_t task = 0; task < tasksCount; ++task) {
+        for (size_t i = 0; i < serialExecutorsCount; ++i) {
+            serialExecutors[i]->Post([&results, &done, i, task]() {
+                results[i].push_back(task);
+                if (task + 1 == tasksCount) {
+                    done[i].SetValue();
+                }
+            });
+        }
+    }
+
+    for (size_t i = 0; i < serialExecutorsCount; ++i) {
+        done[i].GetFuture().Wait();
+        ASSERT_EQ(results[i].size(), tasksCount);
+        for (size_t task = 0; task < tasksCount; ++task) {
+            ASSERT_EQ(results[i][task], task);
+        }
+    }
+}
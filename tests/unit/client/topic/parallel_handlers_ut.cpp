@@ -0,0 +1,107 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <library/cpp/threading/future/future.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+using namespace NYdb;
+using namespace NYdb::NTopic;
+
+namespace {
+
+constexpr std::uint64_t BLOCKED_PARTITION = 0;
+constexpr std::size_t PROGRESS_MESSAGES = 100;
+
+// Shared with the handlers, they may still run after the session is closed
+struct THandlersState {
+    std::mutex Lock;
+    // Offsets of handled messages by partition id
+    std::map<std::uint64_t, std::vector<std::uint64_t>> Offsets;
+    // Handler calls by partition id
+    std::map<std::uint64_t, std::size_t> Calls;
+
+    NThreading::TPromise<void> Blocked = NThreading::NewPromise();
+    NThreading::TPromise<void> Unblock = NThreading::NewPromise();
+    NThreading::TPromise<void> OtherProgressed = NThreading::NewPromise();
+    NThreading::TPromise<void> BlockedProgressed = NThreading::NewPromise();
+
+    void OnData(TReadSessionEvent::TDataReceivedEvent& event) {
+        const auto partitionId = event.GetPartitionSession()->GetPartitionId();
+        std::size_t calls = 0;
+        std::size_t messages = 0;
+        {
+            std::lock_guard guard(Lock);
+            auto& offsets = Offsets[partitionId];
+            for (const auto& message : event.GetMessages()) {
+                offsets.push_back(message.GetOffset());
+            }
+            calls = ++Calls[partitionId];
+            messages = offsets.size();
+        }
+
+        if (partitionId == BLOCKED_PARTITION && calls == 1) {
+            Blocked.SetValue();
+            Unblock.GetFuture().Wait();
+        } else if (messages >= PROGRESS_MESSAGES) {
+            (partitionId == BLOCKED_PARTITION ? BlockedProgressed : OtherProgressed).TrySetValue();
+        }
+    }
+};
+
+} // namespace
+
+TEST(ParallelPartitionHandlers, BlockedPartitionDoesNotStopOthers) {
+    NTests::TFakeServer server(NTests::TFakeServerSettings()
+        .TopicPartitions(2)
+        .TopicMessagesPerBatch(4));
+    TDriver driver(TDriverConfig()
+        .SetEndpoint(server.GetEndpoint())
+        .SetDatabase(server.GetDatabase()));
+    TTopicClient client(driver);
+
+    auto state = std::make_shared<THandlersState>();
+    TReadSessionSettings settings;
+    settings
+        .ConsumerName("parallel-consumer")
+        .AppendTopics(TTopicReadSettings("parallel-topic"))
+        // Leaves the other partition enough budget while the blocked one holds its data
+        .MaxMemoryUsageBytes(4_MB);
+    settings.EventHandlers_
+        .SimpleDataHandlers([state](TReadSessionEvent::TDataReceivedEvent& event) {
+            state->OnData(event);
+        })
+        .HandlersExecutor(CreateThreadPoolExecutor(4))
+        .ParallelPartitionHandlers(true);
+    auto session = client.CreateReadSession(settings);
+
+    // The other partition keeps going while a handler of the blocked one waits
+    ASSERT_TRUE(state->Blocked.GetFuture().Wait(TDuration::Seconds(30)));
+    ASSERT_TRUE(state->OtherProgressed.GetFuture().Wait(TDuration::Seconds(30)));
+    {
+        std::lock_guard guard(state->Lock);
+        // Handlers of one partition are not run concurrently
+        ASSERT_EQ(state->Calls[BLOCKED_PARTITION], 1u);
+    }
+
+    state->Unblock.SetValue();
+    ASSERT_TRUE(state->BlockedProgressed.GetFuture().Wait(TDuration::Seconds(30)));
+    session->Close(TDuration::Zero());
+    driver.Stop(true);
+
+    // Every partition got its messages in order
+    std::lock_guard guard(state->Lock);
+    ASSERT_EQ(state->Offsets.size(), 2u);
+    for (const auto& [partitionId, offsets] : state->Offsets) {
+        ASSERT_GE(offsets.size(), PROGRESS_MESSAGES) << "partition " << partitionId;
+        for (std::size_t i = 0; i < offsets.size(); ++i) {
+            ASSERT_EQ(offsets[i], i) << "partition " << partitionId;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#include <ydb-cpp-sdk/client/topic/read_memory_governor.h>
+
+#include <gtest/gtest.h>
+
+using namespace NYdb::NTopic;
+
+TEST(ReadMemoryGovernor, FairShare) {
+    auto governor = CreateReadMemoryGovernor(100);
+
+    auto first = governor->RegisterSession({});
+    ASSERT_EQ(governor->GetSessionLimit(first), 100u);
+
+    auto second = governor->RegisterSession({});
+    ASSERT_EQ(governor->GetSessionsCount(), 2u);
+
+    governor->UpdateSessionUsage(first, 90);
+    ASSERT_EQ(governor->GetMemoryUsageBytes(), 90u);
+    ASSERT_EQ(governor->GetSessionLimit(first), 100u);
+    // Second session always gets its fair share even if the budget is exhausted by the first one.
+    ASSERT_EQ(governor->GetSessionLimit(second), 50u);
+
+    governor->UpdateSessionUsage(first, 20);
+    ASSERT_EQ(governor->GetSessionLimit(second), 80u);
+
+    governor->UnregisterSession(first);
+    ASSERT_EQ(governor->GetMemoryUsageBytes(), 0u);
+    ASSERT_EQ(governor->GetSessionLimit(second), 100u);
+}
+
+TEST(ReadMemoryGovernor, WakeUpThrottledSessions) {
+    auto counters = MakeIntrusive<::NMonitoring::TDynamicCounters>();
+    auto governor = CreateReadMemoryGovernor(100, counters);
+
+    size_t wokenUp = 0;
+    auto first = governor->RegisterSession([&wokenUp]() { ++wokenUp; });
+    auto second = governor->RegisterSession([&wokenUp]() { ++wokenUp; });
+
+    ASSERT_TRUE(governor->UpdateSessionUsage(first, 60).empty());
+    ASSERT_TRUE(governor->UpdateSessionUsage(second, 40).empty());
+    ASSERT_EQ(counters->GetCounter("throttledSessions")->Val(), 2);
+
+    // Not enough memory for a fair share: only the session that waits the longest is woken up.
+    auto wakeUps = governor->UpdateSessionUsage(second, 30);
+    ASSERT_EQ(wakeUps.size(), 1u);
+    for (auto& wakeUp : wakeUps) {
+        wakeUp();
+    }
+    ASSERT_EQ(wokenUp, 1u);
+
+    // Enough memory for a fair share: all throttled sessions are woken up.
+    wakeUps = governor->UpdateSessionUsage(first, 0);
+    ASSERT_EQ(wakeUps.size(), 1u);
+    ASSERT_EQ(counters->GetCounter("throttledSessions")->Val(), 0);
+    ASSERT_EQ(counters->GetCounter("memoryUsageBytes")->Val(), 30);
+    ASSERT_EQ(counters->GetCounter("wakeUps")->Val(), 2);
+}
@@ -0,0 +1,160 @@
+#include <tests/fake_server/fake_server.h>
+
+#include <ydb-cpp-sdk/client/driver/driver.h>
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <util/folder/tempdir.h>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <optional>
+
+using namespace NYdb;
+using namespace NYdb::NTopic;
+
+namespace {
+
+constexpr std::size_t MESSAGE_SIZE = 1_KB;
+constexpr std::uint64_t MEMORY_MESSAGES = 8;
+
+struct TWriteResult {
+    std::uint64_t WrittenBeforeFirstAck = 0;
+    std::vector<std::uint64_t> AckedSeqNos;
+    std::optional<std::string> Error;
+};
+
+// The fake server delays every write response by Latency, so the session
+// runs out of memory long before the first ack
+class TSpoolTest : public testing::Test {
+protected:
+    TSpoolTest()
+        : Server(NTests::TFakeServerSettings().Latency(TDuration::MilliSeconds(100)))
+        , Driver(TDriverConfig()
+            .SetEndpoint(Server.GetEndpoint())
+            .SetDatabase(Server.GetDatabase()))
+        , Client(Driver)
+    {}
+
+    ~TSpoolTest() {
+        Driver.Stop(true);
+    }
+
+    std::shared_ptr<IWriteSession> CreateSession(std::uint64_t maxSpoolSize = 1_GB) {
+        return Client.CreateWriteSession(TWriteSessionSettings()
+            .Path("spool-topic")
+            .ProducerId("spool-producer")
+            .MessageGroupId("spool-producer")
+            .DirectWriteToPartition(false)
+            .Codec(ECodec::RAW)
+            .BatchFlushInterval(TDuration::MilliSeconds(10))
+            .MaxMemoryUsage(MEMORY_MESSAGES * MESSAGE_SIZE)
+            .SpoolDirectory(SpoolDir.Name())
+            .MaxSpoolSize(maxSpoolSize)
+            .SpoolSegmentSize(4_KB));
+    }
+
+    // Writes as fast as the session issues continuation tokens and waits for all acks
+    TWriteResult WriteAll(IWriteSession& session, std::uint64_t count) {
+        const std::string payload(MESSAGE_SIZE, 'x');
+        std::optional<TContinuationToken> token;
+        std::uint64_t written = 0;
+        TWriteResult result;
+
+        while (result.AckedSeqNos.size() < count && !result.Error) {
+            if (token && written < count) {
+                session.Write(std::move(*token), payload);
+                token.reset();
+                ++written;
+            }
+
+            for (auto& event : session.GetEvents(!token || written == count)) {
+                if (auto* ready = std::get_if<TWriteSessionEvent::TReadyToAcceptEvent>(&event)) {
+                    token = std::move(ready->ContinuationToken);
+                } else if (auto* acks = std::get_if<TWriteSessionEvent::TAcksEvent>(&event)) {
+                    if (result.AckedSeqNos.empty()) {
+                        result.WrittenBeforeFirstAck = written;
+                    }
+                    for (const auto& ack : acks->Acks) {
+                        EXPECT_EQ(ack.State, TWriteSessionEvent::TWriteAck::EES_WRITTEN);
+                        result.AckedSeqNos.push_back(ack.SeqNo);
+                    }
+                } else if (auto* closed = std::get_if<TSessionClosedEvent>(&event)) {
+                    result.Error = closed->DebugString();
+                }
+            }
+        }
+        return result;
+    }
+
+    static void ExpectInOrder(const TWriteResult& result, std::uint64_t count) {
+        ASSERT_FALSE(result.Error) << *result.Error;
+        ASSERT_EQ(result.AckedSeqNos.size(), count);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ASSERT_EQ(result.AckedSeqNos[i], i + 1);
+        }
+    }
+
+    TTempDir SpoolDir;
+    NTests::TFakeServer Server;
+    TDriver Driver;
+    TTopicClient Client;
+};
+
+} // namespace
+
+TEST_F(TSpoolTest, DeliversEverythingInOrder) {
+    const std::uint64_t count = 100;
+    auto session = CreateSession();
+
+    const auto result = WriteAll(*session, count);
+    ExpectInOrder(result, count);
+    // Writes went on past the memory limit
+    ASSERT_GT(result.WrittenBeforeFirstAck, MEMORY_MESSAGES + 1);
+
+    ASSERT_TRUE(session->Close(TDuration::Seconds(30)));
+    ASSERT_EQ(Server.GetStats().WrittenMessages, count);
+}
+
+TEST_F(TSpoolTest, WithholdsTokenWhenSpoolIsFull) {
+    const std::uint64_t count = 60;
+    const std::uint64_t spoolMessages = 8;
+    auto session = CreateSession(spoolMessages * MESSAGE_SIZE);
+
+    const auto result = WriteAll(*session, count);
+    ExpectInOrder(result, count);
+    // The memory limit is exceeded by one message, then the spool is filled up and the token is
+    // withheld until acks drain it
+    ASSERT_GT(result.WrittenBeforeFirstAck, MEMORY_MESSAGES + 1);
+    ASSERT_LE(result.WrittenBeforeFirstAck, MEMORY_MESSAGES + 1 + spoolMessages);
+
+    ASSERT_TRUE(session->Close(TDuration::Seconds(30)));
+    ASSERT_EQ(Server.GetStats().WrittenMessages, count);
+}
+
+TEST_F(TSpoolTest, CloseWaitsForSpooledMessages) {
+    const std::uint64_t count = 50;
+    auto session = CreateSession();
+    Server.HoldWrites(true);
+
+    const std::string payload(MESSAGE_SIZE, 'x');
+    for (std::uint64_t written = 0; written < count;) {
+        for (auto& event : session->GetEvents(true)) {
+            if (auto* ready = std::get_if<TWriteSessionEvent::TReadyToAcceptEvent>(&event)) {
+                session->Write(std::move(ready->ContinuationToken), payload);
+                ++written;
+            } else if (auto* closed = std::get_if<TSessionClosedEvent>(&event)) {
+                FAIL() << closed->DebugString();
+            }
+        }
+    }
+    // Every message is still in memory or in the spool
+    ASSERT_EQ(Server.GetStats().WrittenMessages, 0u);
+
+    auto closed = std::async(std::launch::async, [&session] {
+        return session->Close(TDuration::Seconds(30));
+    });
+    Server.HoldWrites(false);
+    ASSERT_TRUE(closed.get());
+    ASSERT_EQ(Server.GetStats().WrittenMessages, count);
+}
@@ -0,0 +1,86 @@
+#include <src/client/topic/impl/write_spool.h>
+
+#include <util/folder/path.h>
+#include <util/folder/tempdir.h>
+#include <util/system/file.h>
+
+#include <gtest/gtest.h>
+
+using namespace NYdb::NTopic;
+
+namespace {
+
+size_t CountFiles(const TTempDir& dir) {
+    TVector<TString> children;
+    TFsPath(dir.Name()).ListNames(children);
+    return children.size();
+}
+
+} // namespace
+
+TEST(WriteSpool, KeepsOrderAcrossSegments) {
+    TTempDir dir;
+    TWriteSpool spool(dir.Name(), 64);
+    ASSERT_TRUE(spool.Empty());
+
+    for (size_t i = 0; i < 10; ++i) {
+        spool.Push(std::string(10 + i, 'a' + i));
+    }
+    ASSERT_FALSE(spool.Empty());
+    ASSERT_GT(spool.GetSize(), 0u);
+    ASSERT_GT(CountFiles(dir), 1u);
+
+    for (size_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(spool.Front(), std::string(10 + i, 'a' + i));
+        spool.Pop();
+    }
+    ASSERT_TRUE(spool.Empty());
+    ASSERT_EQ(spool.GetSize(), 0u);
+    // The last segment is kept for reuse
+    ASSERT_EQ(CountFiles(dir), 1u);
+}
+
+TEST(WriteSpool, LargeMessageGetsOwnSegment) {
+    TTempDir dir;
+    TWriteSpool spool(dir.Name(), 64);
+
+    const std::string large(1000, 'x');
+    spool.Push("small");
+    spool.Push(large);
+    spool.Push("tail");
+
+    ASSERT_EQ(spool.Front(), "small");
+    spool.Pop();
+    ASSERT_EQ(spool.Front(), large);
+    spool.Pop();
+    ASSERT_EQ(spool.Front(), "tail");
+    spool.Pop();
+    ASSERT_TRUE(spool.Empty());
+}
+
+TEST(WriteSpool, RemovesFilesOnDestruction) {
+    TTempDir dir;
+    {
+        TWriteSpool spool(dir.Name(), 64);
+        spool.Push("message");
+        ASSERT_EQ(CountFiles(dir), 1u);
+    }
+    ASSERT_EQ(CountFiles(dir), 0u);
+}
+
+TEST(WriteSpool, DetectsCorruption) {
+    TTempDir dir;
+    TWriteSpool spool(dir.Name(), 64);
+    spool.Push("message");
+
+    TVector<TString> children;
+    TFsPath(dir.Name()).ListNames(children);
+    ASSERT_EQ(children.size(), 1u);
+
+    // Flip a payload byte behind the spool, the segment is a shared mapping of the file
+    TFile file(TFsPath(dir.Name()) / children[0], OpenExisting | RdWr);
+    char byte = 'X';
+    file.Pwrite(&byte, 1, 10);
+
+    ASSERT_THROW(spool.Front(), TWriteSpoolError);
+}
@@ -0,0 +1,93 @@
+#include <ydb-cpp-sdk/client/types/async_stream.h>
+#include <ydb-cpp-sdk/client/types/status/status.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+
+using namespace NYdb;
+
+namespace {
+
+struct TFakePart : public TStreamPartStatus {
+    explicit TFakePart(EStatus status)
+        : TStreamPartStatus(TStatus(status, {}))
+    {}
+};
+
+// Iterator with parts pushed by the test, parts pushed before ReadNext() are returned ready
+class TFakePartIterator {
+    struct TState {
+        std::deque<NThreading::TPromise<TFakePart>> Promises;
+        size_t Reads = 0;
+        size_t Pushes = 0;
+    };
+
+public:
+    NThreading::TFuture<TFakePart> ReadNext() {
+        return GetPromise(State_->Reads++).GetFuture();
+    }
+
+    void Push(EStatus status = EStatus::SUCCESS) {
+        GetPromise(State_->Pushes++).SetValue(TFakePart(status));
+    }
+
+    size_t GetReads() const {
+        return State_->Reads;
+    }
+
+private:
+    NThreading::TPromise<TFakePart>& GetPromise(size_t index) {
+        while (State_->Promises.size() <= index) {
+            State_->Promises.push_back(NThreading::NewPromise<TFakePart>());
+        }
+        return State_->Promises[index];
+    }
+
+    std::shared_ptr<TState> State_ = std::make_shared<TState>();
+};
+
+NThreading::TFuture<void> Consume(TFakePartIterator iterator, std::vector<EStatus>& parts) {
+    auto stream = MakeAsyncStream(std::move(iterator));
+    while (auto part = co_await stream.Next()) {
+        parts.push_back(part->GetStatus());
+    }
+    EXPECT_TRUE(stream.IsFinished());
+    // The finished stream does not read the iterator anymore
+    EXPECT_FALSE((co_await stream.Next()).has_value());
+}
+
+} // namespace
+
+TEST(AsyncPartStream, ReadsUntilEndOfStream) {
+    TFakePartIterator iterator;
+    std::vector<EStatus> parts;
+
+    // Ready parts do not suspend the coroutine
+    iterator.Push();
+    iterator.Push();
+    auto done = Consume(iterator, parts);
+    ASSERT_EQ(parts.size(), 2u);
+
+    iterator.Push();
+    ASSERT_EQ(parts.size(), 3u);
+    ASSERT_FALSE(done.HasValue());
+
+    iterator.Push(EStatus::CLIENT_OUT_OF_RANGE);
+    ASSERT_TRUE(done.HasValue());
+    ASSERT_EQ(parts, std::vector<EStatus>(3, EStatus::SUCCESS));
+    ASSERT_EQ(iterator.GetReads(), 4u);
+}
+
+TEST(AsyncPartStream, StopsAfterError) {
+    TFakePartIterator iterator;
+    std::vector<EStatus> parts;
+
+    auto done = Consume(iterator, parts);
+    iterator.Push();
+    iterator.Push(EStatus::OVERLOADED);
+
+    ASSERT_TRUE(done.HasValue());
+    ASSERT_EQ(parts, std::vector<EStatus>({EStatus::SUCCESS, EStatus::OVERLOADED}));
+    ASSERT_EQ(iterator.GetReads(), 2u);
+}
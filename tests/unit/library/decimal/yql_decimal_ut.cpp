@@ -2,6 +2,8 @@
 
 #include <library/cpp/testing/unittest/registar.h>
 
+#include <random>
+
 namespace NYdb::NDecimal {
 
 Y_UNIT_TEST_SUITE(TYqlDecimalTest) {
@@ -190,6 +192,41 @@ Y_UNIT_TEST_SUITE(TYqlDecimalTest) {
             UNIT_ASSERT(ToString(i, MaxPrecision, 0) == nullptr);
         }
     }
+
+    Y_UNIT_TEST(TestToStringWideValues) {
+        const TInt128 e18 = 1000000000000000000LL;
+
+        UNIT_ASSERT_VALUES_EQUAL(ToString(e18 * e18 / 10000, MaxPrecision, 0), "100000000000000000000000000000000");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(e18 * 100 + 1, 22, 10), "10000000000.0000000001");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(-(e18 * 100 + 1), 22, 21), "-0.100000000000000000001");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(e18 * 100000, 35, 15), "100000000");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(Inf() - 1, MaxPrecision, MaxPrecision), "0.99999999999999999999999999999999999");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(-(Inf() - 1), MaxPrecision, 0), "-99999999999999999999999999999999999");
+        UNIT_ASSERT_VALUES_EQUAL(ToString(e18 * e18 / 1000, 32, 0), "");
+    }
+
+    Y_UNIT_TEST(TestToStringRoundTrip) {
+        std::mt19937_64 random(42);
+        for (size_t i = 0; i < 100000; ++i) {
+            TInt128 v = FromHalfs(random(), random() >> 1) % Inf();
+            // Values of any length
+            for (size_t j = random() % 3; j; --j) {
+                v /= TInt128((random() >> 1) >> (random() % 63)) + TInt128(1);
+            }
+            if (i % 3) {
+                v *= TInt128(10);
+                v %= Inf();
+            }
+            if (random() % 2) {
+                v = -v;
+            }
+            const ui8 scale = random() % (MaxPrecision + 1);
+
+            const char* result = ToString(v, MaxPrecision, scale);
+            UNIT_ASSERT(result != nullptr);
+            UNIT_ASSERT_C(FromString(result, MaxPrecision, scale) == v, result);
+        }
+    }
 }
 
 }
@@ -58,4 +58,34 @@ Y_UNIT_TEST_SUITE(ChannelPoolTests) {
         UNIT_ASSERT_C(allDeleted, "expired stubsHolders were not deleted after timeout");
 
     }
+
+    Y_UNIT_TEST(LeastOutstandingSubChannel) {
+        TGRpcClientConfig clientConfig("invalid_host:invalid_port");
+        TTcpKeepAliveSettings tcpKeepAliveSettings = {true, 30, 5, 10};
+        auto channelPool = TChannelPool(tcpKeepAliveSettings, TDuration::Minutes(6), 3, true);
+
+        std::vector<std::shared_ptr<void>> guards;
+        auto acquire = [&](EChannelClass channelClass) {
+            grpc::ChannelInterface* channel = nullptr;
+            channelPool.GetStubsHolderLocked("endpoint", channelClass, clientConfig, [&](TStubsHolder& holder) {
+                channel = holder.GetOrCreateStub<TTestStub>()->ChannelInterface.get();
+                guards.emplace_back(holder.AcquireInFlight());
+            });
+            return channel;
+        };
+
+        // Every busy sub-channel makes the next request go to a new one
+        auto* first = acquire(EChannelClass::Unary);
+        auto* second = acquire(EChannelClass::Unary);
+        auto* third = acquire(EChannelClass::Unary);
+        UNIT_ASSERT(first != second && second != third && first != third);
+
+        // The only idle sub-channel is picked
+        guards[1].reset();
+        UNIT_ASSERT_EQUAL(acquire(EChannelClass::Unary), second);
+
+        // Streaming calls never share connections with unary ones
+        auto* stream = acquire(EChannelClass::Streaming);
+        UNIT_ASSERT(stream != first && stream != second && stream != third);
+    }
 } // ChannelPoolTests ut suite
@@ -0,0 +1,160 @@
+#include <src/library/uuid/uuid.h>
+
+#include <library/cpp/testing/unittest/registar.h>
+
+#include <util/stream/str.h>
+
+#include <random>
+
+namespace NYdb::NUuid {
+
+namespace {
+
+// Digit by digit conversions the vectorized ones are checked against
+std::string ReferenceToString(const char* bytes) {
+    ui16 dw[8];
+    std::memcpy(dw, bytes, sizeof(dw));
+
+    std::string result;
+    auto writeHex = [&result](ui16 value, bool reverseBytes) {
+        if (reverseBytes) {
+            value = (value >> 8) | (value << 8);
+        }
+        for (int shift = 12; shift >= 0; shift -= 4) {
+            result.push_back("0123456789abcdef"[(value >> shift) & 0x0f]);
+        }
+    };
+
+    writeHex(dw[1], false);
+    writeHex(dw[0], false);
+    result.push_back('-');
+    writeHex(dw[2], false);
+    result.push_back('-');
+    writeHex(dw[3], false);
+    result.push_back('-');
+    writeHex(dw[4], true);
+    result.push_back('-');
+    writeHex(dw[5], true);
+    writeHex(dw[6], true);
+    writeHex(dw[7], true);
+    return result;
+}
+
+bool ReferenceParse(const std::string& text, bool shortForm, char* bytes) {
+    if (text.size() != (shortForm ? 32 : 36)) {
+        return false;
+    }
+
+    ui16 dw[8];
+    size_t partId = 0;
+    ui32 partValue = 0;
+    size_t digitCount = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (!shortForm && (i == 8 || i == 13 || i == 18 || i == 23)) {
+            if (text[i] != '-') {
+                return false;
+            }
+            continue;
+        }
+        ui32 digit = 0;
+        if (!GetDigit(text[i], digit)) {
+            return false;
+        }
+        partValue = partValue * 16 + digit;
+        if (++digitCount == 4) {
+            dw[partId++] = partValue;
+            partValue = 0;
+            digitCount = 0;
+        }
+    }
+
+    std::swap(dw[0], dw[1]);
+    for (ui32 i = 4; i < 8; ++i) {
+        dw[i] = (dw[i] >> 8) | (dw[i] << 8);
+    }
+    std::memcpy(bytes, dw, sizeof(dw));
+    return true;
+}
+
+} // namespace
+
+Y_UNIT_TEST_SUITE(UuidTest) {
+    Y_UNIT_TEST(Format) {
+        char text[UUID_TEXT_LEN];
+        UuidHalfsToChars(0x4e09a3e4c7eb7a70, 0x9e2c48a1e2d5d3b5, text);
+        UNIT_ASSERT_VALUES_EQUAL(std::string(text, UUID_TEXT_LEN), "c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9e");
+
+        TStringStream out;
+        UuidHalfsToString(0x4e09a3e4c7eb7a70, 0x9e2c48a1e2d5d3b5, out);
+        UNIT_ASSERT_VALUES_EQUAL(out.Str(), "c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9e");
+    }
+
+    Y_UNIT_TEST(Parse) {
+        ui16 dw[8];
+        UNIT_ASSERT(ParseUuidToArray(std::string("C7EB7A70-a3e4-4E09-b5d3-d5e2a1482c9e"), dw, false));
+        ui64 halfs[2];
+        std::memcpy(halfs, dw, sizeof(halfs));
+        UNIT_ASSERT_VALUES_EQUAL(halfs[0], 0x4e09a3e4c7eb7a70ull);
+        UNIT_ASSERT_VALUES_EQUAL(halfs[1], 0x9e2c48a1e2d5d3b5ull);
+
+        UNIT_ASSERT(ParseUuidToArray(std::string("c7eb7a70a3e44e09b5d3d5e2a1482c9e"), dw, true));
+        std::memcpy(halfs, dw, sizeof(halfs));
+        UNIT_ASSERT_VALUES_EQUAL(halfs[0], 0x4e09a3e4c7eb7a70ull);
+
+        UNIT_ASSERT(!ParseUuidToArray(std::string("c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9"), dw, false));
+        UNIT_ASSERT(!ParseUuidToArray(std::string("c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9g"), dw, false));
+        UNIT_ASSERT(!ParseUuidToArray(std::string("c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9e"), dw, true));
+        UNIT_ASSERT(!ParseUuidToArray(std::string("c7eb7a70a-3e4-4e09-b5d3-d5e2a1482c9e"), dw, false));
+        UNIT_ASSERT(!ParseUuidToArray(std::string("c7eb7a70-a3e4-4e09-b5d3-d5e2a1482c9\xe5"), dw, false));
+    }
+
+    Y_UNIT_TEST(Batch) {
+        std::mt19937_64 random(1);
+        constexpr size_t count = 100;
+        ui64 halfs[count * 2];
+        for (auto& half : halfs) {
+            half = random();
+        }
+
+        std::string text(count * UUID_TEXT_LEN, '\0');
+        UuidsBytesToChars(reinterpret_cast<const char*>(halfs), count, text.data());
+        for (size_t i = 0; i < count; ++i) {
+            UNIT_ASSERT_VALUES_EQUAL(text.substr(i * UUID_TEXT_LEN, UUID_TEXT_LEN),
+                ReferenceToString(reinterpret_cast<const char*>(halfs + i * 2)));
+        }
+    }
+
+    Y_UNIT_TEST(FuzzAgainstReference) {
+        std::mt19937_64 random(2);
+        // Hex digits of both cases, dashes and chars next to the hex ranges
+        const std::string alphabet = "0123456789abcdefABCDEF-/:@G`g \x80\xff";
+
+        for (size_t i = 0; i < 200000; ++i) {
+            const ui64 halfs[2] = {random(), random()};
+            const char* bytes = reinterpret_cast<const char*>(halfs);
+
+            char text[UUID_TEXT_LEN];
+            UuidBytesToChars(bytes, text);
+            std::string expected = ReferenceToString(bytes);
+            UNIT_ASSERT_VALUES_EQUAL(std::string(text, UUID_TEXT_LEN), expected);
+
+            const bool shortForm = i % 3 == 0;
+            if (shortForm) {
+                std::erase(expected, '-');
+            }
+            for (size_t j = random() % 4; j; --j) {
+                expected[random() % expected.size()] = alphabet[random() % alphabet.size()];
+            }
+
+            char parsed[UUID_LEN] = {};
+            char reference[UUID_LEN] = {};
+            const bool ok = ParseUuidToBytes(expected.data(), expected.size(), parsed, shortForm);
+            UNIT_ASSERT_VALUES_EQUAL_C(ok, ReferenceParse(expected, shortForm, reference), expected);
+            if (ok) {
+                UNIT_ASSERT_C(std::memcmp(parsed, reference, UUID_LEN) == 0, expected);
+            }
+        }
+    }
+}
+
+}